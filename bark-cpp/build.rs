@@ -3,7 +3,35 @@ fn main() {
     println!("cargo:rerun-if-changed=src/lib.rs");
     println!("cargo:rerun-if-changed=src/cxx.rs");
 
+    // The storage indexes are named after the bark persister they were made
+    // for, so they are dropped before a different one migrates the database
+    println!("cargo:rerun-if-changed=Cargo.lock");
+    println!(
+        "cargo:rustc-env=BARK_PERSIST_VERSION={}",
+        bark_persist_version().unwrap_or_else(|| std::env::var("CARGO_PKG_VERSION").unwrap())
+    );
+
     cxx_build::bridge("src/cxx.rs")
         .flag_if_supported("-std=c++17")
         .compile("arkcxxbridge");
 }
+
+/// Returns the locked version and commit of the bark-wallet package
+fn bark_persist_version() -> Option<String> {
+    let lock = std::fs::read_to_string("Cargo.lock").ok()?;
+    let package = lock
+        .split("[[package]]")
+        .find(|package| package.contains("\nname = \"bark-wallet\"\n"))?;
+    let field = |name: &str| {
+        package.lines().find_map(|line| {
+            line.strip_prefix(name)?
+                .strip_prefix(" = \"")?
+                .strip_suffix('"')
+        })
+    };
+    let version = field("version")?;
+    match field("source").and_then(|source| source.rsplit_once('#')) {
+        Some((_, commit)) => Some(format!("{}-{}", version, &commit[..commit.len().min(8)])),
+        None => Some(version.to_string()),
+    }
+}
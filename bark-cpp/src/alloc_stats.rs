@@ -0,0 +1,307 @@
+//! Allocation statistics of the native layer, for finding memory spikes.
+//!
+//! With the `alloc-profiling` feature a counting allocator wraps the system
+//! allocator. Each allocation is charged to the subsystem of the thread that
+//! made it:
+//! - wallet: inside a bridge call's future, which runs on the calling thread
+//! - runtime: on Tokio worker and blocking threads, i.e. background tasks
+//! - bridge: on any other thread, mostly converting arguments and results
+//!
+//! A block records its subsystem in a small header, so its free is charged
+//! to the same subsystem wherever it happens. Each bridge function also
+//! counts the allocations its future made on the calling thread.
+//!
+//! SQLite allocates through its own allocator, so its share is read from
+//! SQLite's memory statistics and is reported with or without the feature.
+
+use std::cell::Cell;
+
+#[cfg(feature = "alloc-profiling")]
+use std::collections::HashMap;
+#[cfg(feature = "alloc-profiling")]
+use std::sync::atomic::{AtomicU64, Ordering};
+#[cfg(feature = "alloc-profiling")]
+use std::sync::{LazyLock, Mutex, MutexGuard};
+
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+#[repr(u8)]
+pub(crate) enum Subsystem {
+    Bridge = 0,
+    Wallet = 1,
+    Runtime = 2,
+}
+
+impl Subsystem {
+    pub(crate) const ALL: [Subsystem; 3] =
+        [Subsystem::Bridge, Subsystem::Wallet, Subsystem::Runtime];
+
+    pub(crate) fn name(self) -> &'static str {
+        match self {
+            Subsystem::Bridge => "bridge",
+            Subsystem::Wallet => "wallet",
+            Subsystem::Runtime => "runtime",
+        }
+    }
+}
+
+#[derive(Clone, Debug, Default, PartialEq, Eq)]
+pub(crate) struct SubsystemStats {
+    pub name: &'static str,
+    pub current_bytes: u64,
+    pub peak_bytes: u64,
+    pub allocations: u64,
+}
+
+#[derive(Clone, Debug, Default, PartialEq, Eq)]
+pub(crate) struct CallStats {
+    pub calls: u64,
+    pub allocations: u64,
+    pub bytes: u64,
+}
+
+thread_local! {
+    static SUBSYSTEM: Cell<u8> = const { Cell::new(Subsystem::Bridge as u8) };
+    // Allocations and bytes allocated by this thread so far
+    #[cfg(feature = "alloc-profiling")]
+    static THREAD_TOTALS: Cell<(u64, u64)> = const { Cell::new((0, 0)) };
+}
+
+/// Charges the allocations of the current thread to `subsystem` until it is
+/// changed again, returning the previous one
+pub(crate) fn set_thread_subsystem(subsystem: Subsystem) -> Subsystem {
+    let previous = SUBSYSTEM.replace(subsystem as u8);
+    Subsystem::ALL
+        .into_iter()
+        .find(|s| *s as u8 == previous)
+        .unwrap_or(Subsystem::Bridge)
+}
+
+pub(crate) const fn enabled() -> bool {
+    cfg!(feature = "alloc-profiling")
+}
+
+/// Bytes SQLite holds now and at most since the last reset
+pub(crate) fn sqlite_stats() -> SubsystemStats {
+    let (current, peak) = unsafe {
+        (
+            rusqlite::ffi::sqlite3_memory_used(),
+            rusqlite::ffi::sqlite3_memory_highwater(0),
+        )
+    };
+    SubsystemStats {
+        name: "sqlite",
+        current_bytes: current.max(0) as u64,
+        peak_bytes: peak.max(0) as u64,
+        allocations: 0,
+    }
+}
+
+#[cfg(feature = "alloc-profiling")]
+struct Counters {
+    current: AtomicU64,
+    peak: AtomicU64,
+    allocations: AtomicU64,
+}
+
+#[cfg(feature = "alloc-profiling")]
+static COUNTERS: [Counters; Subsystem::ALL.len()] = [const {
+    Counters {
+        current: AtomicU64::new(0),
+        peak: AtomicU64::new(0),
+        allocations: AtomicU64::new(0),
+    }
+}; Subsystem::ALL.len()];
+
+#[cfg(feature = "alloc-profiling")]
+static CALLS: LazyLock<Mutex<HashMap<&'static str, CallStats>>> =
+    LazyLock::new(|| Mutex::new(HashMap::new()));
+
+#[cfg(feature = "alloc-profiling")]
+fn calls() -> MutexGuard<'static, HashMap<&'static str, CallStats>> {
+    CALLS.lock().unwrap_or_else(|e| e.into_inner())
+}
+
+#[cfg(feature = "alloc-profiling")]
+fn allocated(subsystem: u8, bytes: usize) {
+    let counters = &COUNTERS[subsystem as usize % COUNTERS.len()];
+    let current = counters.current.fetch_add(bytes as u64, Ordering::Relaxed) + bytes as u64;
+    counters.peak.fetch_max(current, Ordering::Relaxed);
+    counters.allocations.fetch_add(1, Ordering::Relaxed);
+    let _ = THREAD_TOTALS.try_with(|t| {
+        let (count, total) = t.get();
+        t.set((count + 1, total + bytes as u64));
+    });
+}
+
+#[cfg(feature = "alloc-profiling")]
+fn freed(subsystem: u8, bytes: usize) {
+    COUNTERS[subsystem as usize % COUNTERS.len()]
+        .current
+        .fetch_sub(bytes as u64, Ordering::Relaxed);
+}
+
+/// Allocations made by the current thread so far, `None` without the
+/// `alloc-profiling` feature
+#[cfg(test)]
+pub(crate) fn thread_allocations() -> Option<u64> {
+    #[cfg(feature = "alloc-profiling")]
+    {
+        Some(THREAD_TOTALS.get().0)
+    }
+
+    #[cfg(not(feature = "alloc-profiling"))]
+    None
+}
+
+/// Runs `f`, the bridge call `name`, charging its allocations to the wallet
+/// and counting them for `name`
+pub(crate) fn track_call<R>(name: &'static str, f: impl FnOnce() -> R) -> R {
+    #[cfg(not(feature = "alloc-profiling"))]
+    {
+        let _ = name;
+        f()
+    }
+
+    #[cfg(feature = "alloc-profiling")]
+    {
+        let (count_before, bytes_before) = THREAD_TOTALS.get();
+        let previous = set_thread_subsystem(Subsystem::Wallet);
+        let output = f();
+        set_thread_subsystem(previous);
+        let (count_after, bytes_after) = THREAD_TOTALS.get();
+
+        let mut calls = calls();
+        let call = calls.entry(name).or_default();
+        call.calls += 1;
+        call.allocations += count_after - count_before;
+        call.bytes += bytes_after - bytes_before;
+        output
+    }
+}
+
+/// Current and peak bytes per subsystem, SQLite last. Empty apart from
+/// SQLite without the `alloc-profiling` feature.
+pub(crate) fn subsystem_stats() -> Vec<SubsystemStats> {
+    #[allow(unused_mut)]
+    let mut stats = Vec::new();
+    #[cfg(feature = "alloc-profiling")]
+    for subsystem in Subsystem::ALL {
+        let counters = &COUNTERS[subsystem as usize];
+        stats.push(SubsystemStats {
+            name: subsystem.name(),
+            current_bytes: counters.current.load(Ordering::Relaxed),
+            peak_bytes: counters.peak.load(Ordering::Relaxed),
+            allocations: counters.allocations.load(Ordering::Relaxed),
+        });
+    }
+    stats.push(sqlite_stats());
+    stats
+}
+
+/// Allocation counts per bridge function, sorted by name
+pub(crate) fn call_stats() -> Vec<(&'static str, CallStats)> {
+    #[cfg(feature = "alloc-profiling")]
+    {
+        let mut stats = calls()
+            .iter()
+            .map(|(name, s)| (*name, s.clone()))
+            .collect::<Vec<_>>();
+        stats.sort_unstable_by_key(|(name, _)| *name);
+        stats
+    }
+
+    #[cfg(not(feature = "alloc-profiling"))]
+    Vec::new()
+}
+
+/// Lowers every peak to the current value and clears the call counts
+pub(crate) fn reset() {
+    unsafe { rusqlite::ffi::sqlite3_memory_highwater(1) };
+    #[cfg(feature = "alloc-profiling")]
+    {
+        for counters in &COUNTERS {
+            counters
+                .peak
+                .store(counters.current.load(Ordering::Relaxed), Ordering::Relaxed);
+            counters.allocations.store(0, Ordering::Relaxed);
+        }
+        calls().clear();
+    }
+}
+
+#[cfg(feature = "alloc-profiling")]
+mod counting {
+    use std::alloc::{GlobalAlloc, Layout, System};
+
+    use super::{SUBSYSTEM, allocated, freed};
+
+    // Room in front of every block for the subsystem it is charged to. The
+    // block keeps the caller's alignment, the header sits in the byte before.
+    const HEADER: usize = 16;
+
+    fn outer(layout: Layout) -> Option<(Layout, usize)> {
+        let offset = layout.align().max(HEADER);
+        let size = layout.size().checked_add(offset)?;
+        let outer = Layout::from_size_align(size, offset).ok()?;
+        Some((outer, offset))
+    }
+
+    struct Counting;
+
+    unsafe impl GlobalAlloc for Counting {
+        unsafe fn alloc(&self, layout: Layout) -> *mut u8 {
+            unsafe { alloc_with(layout, |outer| System.alloc(outer)) }
+        }
+
+        unsafe fn alloc_zeroed(&self, layout: Layout) -> *mut u8 {
+            unsafe { alloc_with(layout, |outer| System.alloc_zeroed(outer)) }
+        }
+
+        unsafe fn dealloc(&self, ptr: *mut u8, layout: Layout) {
+            // Allocated through `alloc_with`, so the outer layout is valid
+            let (outer, offset) = outer(layout).expect("layout was valid at allocation");
+            unsafe {
+                freed(*ptr.sub(1), layout.size());
+                System.dealloc(ptr.sub(offset), outer);
+            }
+        }
+
+        unsafe fn realloc(&self, ptr: *mut u8, layout: Layout, new_size: usize) -> *mut u8 {
+            let (outer, offset) = outer(layout).expect("layout was valid at allocation");
+            let Some(new_outer_size) = new_size.checked_add(offset) else {
+                return std::ptr::null_mut();
+            };
+            unsafe {
+                let subsystem = *ptr.sub(1);
+                let base = System.realloc(ptr.sub(offset), outer, new_outer_size);
+                if base.is_null() {
+                    return base;
+                }
+                // The header was moved along with the block
+                freed(subsystem, layout.size());
+                allocated(subsystem, new_size);
+                base.add(offset)
+            }
+        }
+    }
+
+    unsafe fn alloc_with(layout: Layout, alloc: impl FnOnce(Layout) -> *mut u8) -> *mut u8 {
+        let Some((outer, offset)) = outer(layout) else {
+            return std::ptr::null_mut();
+        };
+        let base = alloc(outer);
+        if base.is_null() {
+            return base;
+        }
+        let subsystem = SUBSYSTEM.try_with(|s| s.get()).unwrap_or(0);
+        allocated(subsystem, layout.size());
+        unsafe {
+            let ptr = base.add(offset);
+            *ptr.sub(1) = subsystem;
+            ptr
+        }
+    }
+
+    #[global_allocator]
+    static ALLOCATOR: Counting = Counting;
+}
@@ -0,0 +1,317 @@
+//! Benchmarks for the FFI layer against a regtest wallet.
+//!
+//! They are ignored tests so they share the test setup and need no extra
+//! dependencies. Run them in release mode, one at a time since they share the
+//! global wallet:
+//!
+//! ```sh
+//! cargo test --release -- --ignored --test-threads=1 bench_
+//! ```
+//!
+//! A wallet that already has funds is used when `BARK_BENCH_DATADIR` and
+//! `BARK_BENCH_MNEMONIC` are set, otherwise a fresh one is created. Its VTXOs
+//! and movements are repeated up to `BARK_BENCH_VTXOS` and
+//! `BARK_BENCH_MOVEMENTS` entries for the marshalling benchmarks. Every result
+//! is appended as one JSON line to `BARK_BENCH_OUT`, by default
+//! `target/bench/bark-cpp.jsonl`. Built with `--features alloc-profiling`,
+//! results also carry the allocations made per item.
+
+use crate::cxx::{self, ffi};
+use crate::{TOKIO_RUNTIME, alloc_stats, columnar, utils};
+use std::fs::{self, OpenOptions};
+use std::hint::black_box;
+use std::io::Write;
+use std::path::PathBuf;
+use std::time::{Duration, Instant, SystemTime, UNIX_EPOCH};
+
+const WARMUP_ITERATIONS: usize = 3;
+const DEFAULT_DATASET_SIZE: usize = 1000;
+
+fn env_usize(name: &str, default: usize) -> usize {
+    std::env::var(name)
+        .ok()
+        .and_then(|v| v.parse().ok())
+        .unwrap_or(default)
+}
+
+fn bench_opts(mnemonic: String) -> ffi::CreateOpts {
+    let env = |name: &str, default: &str| std::env::var(name).unwrap_or(default.to_string());
+    ffi::CreateOpts {
+        regtest: true,
+        signet: false,
+        bitcoin: false,
+        mnemonic,
+        birthday_height: std::ptr::null(),
+        config: ffi::ConfigOpts {
+            ark: env("BARK_BENCH_ARK", "http://127.0.0.1:50051"),
+            esplora: env("BARK_BENCH_ESPLORA", "http://127.0.0.1:3002"),
+            bitcoind: "".to_string(),
+            bitcoind_cookie: "".to_string(),
+            bitcoind_user: "".to_string(),
+            bitcoind_pass: "".to_string(),
+            vtxo_refresh_expiry_threshold: 3600,
+            fallback_fee_rate: 1,
+            htlc_recv_claim_delta: 18,
+            vtxo_exit_margin: 12,
+            round_tx_required_confirmations: 0,
+            storage: ffi::StorageOpts {
+                journal_mode: "".to_string(),
+                synchronous: "".to_string(),
+                mmap_size: 0,
+                cache_size_kib: 0,
+                page_size: 0,
+            },
+        },
+    }
+}
+
+/// Keeps the benchmark wallet loaded for the duration of one benchmark
+struct BenchWallet {
+    datadir: String,
+    mnemonic: String,
+    _temp_dir: Option<tempfile::TempDir>,
+}
+
+impl BenchWallet {
+    fn open() -> Self {
+        cxx::init_logger();
+        if cxx::is_wallet_loaded() {
+            cxx::close_wallet().unwrap();
+        }
+
+        let seeded = std::env::var("BARK_BENCH_DATADIR")
+            .ok()
+            .zip(std::env::var("BARK_BENCH_MNEMONIC").ok());
+        match seeded {
+            Some((datadir, mnemonic)) => {
+                cxx::load_wallet(&datadir, bench_opts(mnemonic.clone()))
+                    .expect("Failed to load the seeded bench wallet");
+                BenchWallet {
+                    datadir,
+                    mnemonic,
+                    _temp_dir: None,
+                }
+            }
+            None => {
+                let temp_dir = tempfile::tempdir().expect("Failed to create temp dir");
+                let datadir = temp_dir.path().to_str().unwrap().to_string();
+                let mnemonic = cxx::create_mnemonic().unwrap();
+                cxx::create_wallet(&datadir, bench_opts(mnemonic.clone()))
+                    .expect("Failed to create the bench wallet");
+                BenchWallet {
+                    datadir,
+                    mnemonic,
+                    _temp_dir: Some(temp_dir),
+                }
+            }
+        }
+    }
+}
+
+impl Drop for BenchWallet {
+    fn drop(&mut self) {
+        if cxx::is_wallet_loaded() {
+            let _ = cxx::close_wallet();
+        }
+    }
+}
+
+fn output_path() -> PathBuf {
+    std::env::var("BARK_BENCH_OUT")
+        .map(PathBuf::from)
+        .unwrap_or_else(|_| {
+            PathBuf::from(env!("CARGO_MANIFEST_DIR")).join("target/bench/bark-cpp.jsonl")
+        })
+}
+
+/// Times `routine` on fresh input from `setup`, which is not timed, and
+/// records the result under `name`. `items` is the number of entries one
+/// iteration processes, used for the throughput.
+fn measure_batched<I, O>(
+    name: &str,
+    items: usize,
+    iterations: usize,
+    mut setup: impl FnMut() -> I,
+    mut routine: impl FnMut(I) -> O,
+) {
+    for _ in 0..WARMUP_ITERATIONS {
+        black_box(routine(setup()));
+    }
+
+    let mut samples = Vec::with_capacity(iterations);
+    let mut allocations = Some(0);
+    for _ in 0..iterations {
+        let input = setup();
+        let allocations_before = alloc_stats::thread_allocations();
+        let started = Instant::now();
+        let output = routine(input);
+        samples.push(started.elapsed());
+        allocations = allocations
+            .zip(allocations_before)
+            .zip(alloc_stats::thread_allocations())
+            .map(|((total, before), after)| total + (after - before));
+        drop(black_box(output));
+    }
+    let allocations_per_item =
+        allocations.map(|a| a as f64 / (iterations.max(1) * items.max(1)) as f64);
+    record(name, items, &mut samples, allocations_per_item);
+}
+
+fn measure<O>(name: &str, items: usize, iterations: usize, mut routine: impl FnMut() -> O) {
+    measure_batched(name, items, iterations, || (), |()| routine());
+}
+
+fn record(name: &str, items: usize, samples: &mut [Duration], allocations_per_item: Option<f64>) {
+    samples.sort_unstable();
+    let ns = |d: Duration| d.as_nanos() as u64;
+    let median = samples[samples.len() / 2];
+    let p95 = samples[(samples.len() * 95 / 100).min(samples.len() - 1)];
+    let items_per_sec = if median.is_zero() {
+        0.0
+    } else {
+        items as f64 / median.as_secs_f64()
+    };
+
+    let result = serde_json::json!({
+        "name": name,
+        "version": env!("CARGO_PKG_VERSION"),
+        "timestamp": SystemTime::now().duration_since(UNIX_EPOCH).unwrap().as_secs(),
+        "iterations": samples.len(),
+        "items": items,
+        "min_ns": ns(samples[0]),
+        "median_ns": ns(median),
+        "p95_ns": ns(p95),
+        "max_ns": ns(samples[samples.len() - 1]),
+        "items_per_sec": items_per_sec,
+        "allocations_per_item": allocations_per_item,
+    });
+    println!("{}", result);
+
+    let path = output_path();
+    if let Some(dir) = path.parent() {
+        fs::create_dir_all(dir).expect("Failed to create the bench output directory");
+    }
+    let mut file = OpenOptions::new()
+        .create(true)
+        .append(true)
+        .open(&path)
+        .expect("Failed to open the bench output file");
+    writeln!(file, "{}", result).expect("Failed to write the bench result");
+}
+
+/// Repeats `entries` until there are `len` of them
+fn repeat_to<T: Clone>(entries: &[T], len: usize) -> Vec<T> {
+    entries.iter().cycle().take(len).cloned().collect()
+}
+
+#[test]
+#[ignore = "benchmark, requires live regtest backend"]
+fn bench_wallet_open() {
+    let wallet = BenchWallet::open();
+    let iterations = env_usize("BARK_BENCH_ITERATIONS", 10);
+
+    // Cold opens derive the seed again, warm ones reuse the cached seed
+    for (name, cold) in [("wallet_open/cold", true), ("wallet_open/warm", false)] {
+        measure_batched(
+            name,
+            1,
+            iterations,
+            || {
+                cxx::close_wallet().unwrap();
+                if cold {
+                    cxx::forget_cached_seed();
+                }
+                bench_opts(wallet.mnemonic.clone())
+            },
+            |opts| cxx::load_wallet(&wallet.datadir, opts).unwrap(),
+        );
+    }
+}
+
+#[test]
+#[ignore = "benchmark, requires live regtest backend"]
+fn bench_ffi_call_overhead() {
+    let _wallet = BenchWallet::open();
+    let iterations = env_usize("BARK_BENCH_ITERATIONS", 200);
+
+    measure("ffi/is_wallet_loaded", 1, iterations, cxx::is_wallet_loaded);
+    measure(
+        "ffi/cached_wallet_snapshot",
+        1,
+        iterations,
+        cxx::cached_wallet_snapshot,
+    );
+    measure("ffi/offchain_balance", 1, iterations, || {
+        cxx::offchain_balance().unwrap()
+    });
+    measure("ffi/onchain_balance", 1, iterations, || {
+        cxx::onchain_balance().unwrap()
+    });
+    measure("ffi/get_ark_info", 1, iterations, || {
+        cxx::get_ark_info().unwrap()
+    });
+    measure("ffi/peak_address", 1, iterations, || {
+        cxx::peak_address(0).unwrap()
+    });
+    measure("ffi/dashboard_snapshot", 1, iterations, || {
+        cxx::dashboard_snapshot().unwrap()
+    });
+    measure("ffi/vtxos", 1, iterations, || cxx::vtxos().unwrap());
+    measure("ffi/history", 1, iterations, || cxx::history().unwrap());
+}
+
+#[test]
+#[ignore = "benchmark, requires live regtest backend"]
+fn bench_vtxo_marshalling() {
+    let _wallet = BenchWallet::open();
+    let iterations = env_usize("BARK_BENCH_ITERATIONS", 50);
+    let vtxos = TOKIO_RUNTIME.block_on(crate::vtxos()).unwrap();
+    if vtxos.is_empty() {
+        eprintln!("Bench wallet has no VTXOs, seed one with funds to run this benchmark");
+        return;
+    }
+    let vtxos = repeat_to(&vtxos, env_usize("BARK_BENCH_VTXOS", DEFAULT_DATASET_SIZE));
+
+    measure_batched(
+        "marshal/wallet_vtxos_to_bark_vtxos",
+        vtxos.len(),
+        iterations,
+        || vtxos.clone(),
+        utils::wallet_vtxos_to_bark_vtxos,
+    );
+    measure(
+        "marshal/encode_vtxo_columns",
+        vtxos.len(),
+        iterations,
+        || columnar::encode_vtxo_columns(&vtxos),
+    );
+}
+
+#[test]
+#[ignore = "benchmark, requires live regtest backend"]
+fn bench_history_marshalling() {
+    let _wallet = BenchWallet::open();
+    let iterations = env_usize("BARK_BENCH_ITERATIONS", 50);
+    let movements = TOKIO_RUNTIME.block_on(crate::history()).unwrap();
+    if movements.is_empty() {
+        eprintln!("Bench wallet has no movements, seed one with funds to run this benchmark");
+        return;
+    }
+    let movements = repeat_to(
+        &movements,
+        env_usize("BARK_BENCH_MOVEMENTS", DEFAULT_DATASET_SIZE),
+    );
+
+    for (name, include_metadata) in [
+        ("marshal/movement_to_bark_movement", true),
+        ("marshal/movement_to_bark_movement/no_metadata", false),
+    ] {
+        measure(name, movements.len(), iterations, || {
+            movements
+                .iter()
+                .map(|m| utils::movement_to_bark_movement_with(m, include_metadata))
+                .collect::<anyhow::Result<Vec<_>>>()
+                .unwrap()
+        });
+    }
+}
@@ -0,0 +1,189 @@
+//! Cancellation tokens and deadlines for long bridge calls.
+//!
+//! A bridge call blocks a native worker and holds the wallet locks until its
+//! future completes. `run` races the future against a cancellation token and
+//! a deadline; when either fires first, the future is dropped at its current
+//! await point, which releases every lock it held, and the call fails.
+//!
+//! Dropping is only safe while nothing irreversible has happened. Calls that
+//! move funds call `commit` once they hold their locks, right before handing
+//! over to bark. From then on a cancellation or deadline is logged and the
+//! call runs to completion, so a board or offboard is never abandoned
+//! between broadcasting and persisting.
+//!
+//! Calls made of independent pieces of work, like maintenance, run each
+//! piece as a `step` instead. A stop that arrives during a step lets it
+//! finish, and the call fails at its next `checkpoint`, so it stops between
+//! steps rather than running to the end.
+
+use std::collections::HashMap;
+use std::future::Future;
+use std::sync::atomic::{AtomicBool, AtomicU64, Ordering};
+use std::sync::{Arc, LazyLock, Mutex, MutexGuard};
+use std::time::Duration;
+
+use anyhow::bail;
+use logger::log::{debug, info};
+use tokio::sync::watch;
+
+/// How a call may be stopped early, zero leaves out the token or deadline
+#[derive(Clone, Copy, Debug, Default, PartialEq, Eq)]
+pub(crate) struct CallLimits {
+    pub token: u64,
+    pub timeout: Option<Duration>,
+}
+
+struct Token {
+    cancelled: watch::Sender<bool>,
+}
+
+impl Token {
+    async fn cancelled(&self) {
+        let mut cancelled = self.cancelled.subscribe();
+        // Only fails once the sender is dropped, and `self` holds it
+        let _ = cancelled.wait_for(|c| *c).await;
+    }
+}
+
+static NEXT_TOKEN: AtomicU64 = AtomicU64::new(1);
+static TOKENS: LazyLock<Mutex<HashMap<u64, Arc<Token>>>> =
+    LazyLock::new(|| Mutex::new(HashMap::new()));
+
+fn tokens() -> MutexGuard<'static, HashMap<u64, Arc<Token>>> {
+    TOKENS.lock().unwrap_or_else(|e| e.into_inner())
+}
+
+/// Creates a token that can cancel any number of calls
+pub(crate) fn create_token() -> u64 {
+    let id = NEXT_TOKEN.fetch_add(1, Ordering::Relaxed);
+    let (cancelled, _) = watch::channel(false);
+    tokens().insert(id, Arc::new(Token { cancelled }));
+    id
+}
+
+/// Cancels the calls running with `token` and every later one using it.
+/// Returns false for an unknown token.
+pub(crate) fn cancel(token: u64) -> bool {
+    match tokens().get(&token) {
+        Some(t) => {
+            t.cancelled.send_replace(true);
+            true
+        }
+        None => false,
+    }
+}
+
+/// Forgets `token`, calls already running with it keep listening to it
+pub(crate) fn release(token: u64) {
+    tokens().remove(&token);
+}
+
+struct Scope {
+    committed: AtomicBool,
+    // Set when the call was stopped while committed, to fail it at the next
+    // checkpoint
+    stopped: Mutex<Option<String>>,
+}
+
+tokio::task_local! {
+    static SCOPE: Arc<Scope>;
+}
+
+/// Marks the running call as past the point where it can be dropped
+pub(crate) fn commit() {
+    let _ = SCOPE.try_with(|scope| scope.committed.store(true, Ordering::Release));
+}
+
+/// Runs `future` as one piece of work that a cancellation or deadline lets
+/// finish. Call `checkpoint` afterwards to stop if one arrived meanwhile.
+pub(crate) async fn step<F: Future>(future: F) -> F::Output {
+    let previous = SCOPE
+        .try_with(|scope| scope.committed.swap(true, Ordering::AcqRel))
+        .unwrap_or(false);
+    let output = future.await;
+    let _ = SCOPE.try_with(|scope| scope.committed.store(previous, Ordering::Release));
+    output
+}
+
+/// Fails if the running call was cancelled or ran past its deadline during
+/// a step
+pub(crate) fn checkpoint() -> anyhow::Result<()> {
+    let stopped = SCOPE
+        .try_with(|scope| {
+            scope
+                .stopped
+                .lock()
+                .unwrap_or_else(|e| e.into_inner())
+                .clone()
+        })
+        .ok()
+        .flatten();
+    match stopped {
+        Some(reason) => bail!("{}", reason),
+        None => Ok(()),
+    }
+}
+
+/// Awaits `future` unless `limits` stop it before it commits
+pub(crate) async fn run<T, F>(name: &str, limits: CallLimits, future: F) -> anyhow::Result<T>
+where
+    F: Future<Output = anyhow::Result<T>>,
+{
+    let token = match limits.token {
+        0 => None,
+        id => match tokens().get(&id) {
+            Some(token) => Some(token.clone()),
+            None => bail!("Unknown cancel token {}", id),
+        },
+    };
+    if token.is_none() && limits.timeout.is_none() {
+        return future.await;
+    }
+
+    let stopped = async {
+        let cancelled = async {
+            match &token {
+                Some(token) => token.cancelled().await,
+                None => std::future::pending().await,
+            }
+        };
+        let expired = async {
+            match limits.timeout {
+                Some(timeout) => tokio::time::sleep(timeout).await,
+                None => std::future::pending().await,
+            }
+        };
+        tokio::select! {
+            _ = cancelled => "was cancelled".to_string(),
+            _ = expired => format!(
+                "timed out after {} ms",
+                limits.timeout.unwrap_or_default().as_millis()
+            ),
+        }
+    };
+
+    let scope = Arc::new(Scope {
+        committed: AtomicBool::new(false),
+        stopped: Mutex::new(None),
+    });
+    SCOPE
+        .scope(scope.clone(), async {
+            tokio::pin!(future);
+            tokio::select! {
+                biased;
+                output = &mut future => output,
+                reason = stopped => {
+                    if scope.committed.load(Ordering::Acquire) {
+                        info!("{} {}, finishing what it already started", name, reason);
+                        *scope.stopped.lock().unwrap_or_else(|e| e.into_inner()) =
+                            Some(format!("{} {}", name, reason));
+                        future.await
+                    } else {
+                        debug!("Dropping {}, it {}", name, reason);
+                        bail!("{} {}", name, reason)
+                    }
+                }
+            }
+        })
+        .await
+}
@@ -0,0 +1,80 @@
+//! Columnar encoding of vtxo lists, for callers that scan many vtxos but only
+//! need a few fields of each.
+//!
+//! All integers are little-endian. Every column starts at an offset aligned
+//! to the size of its elements, so JS can view it as a typed array in place.
+//!
+//! ```text
+//! offset 0   u32       layout version, currently 1
+//! offset 4   u32       number of vtxos `n`
+//! offset 8   u64[n]    amount in sats
+//!            u32[n]    expiry height
+//!            u16[n]    exit delta
+//!            u8[n]     state: 0 spendable, 1 spent, 2 locked
+//!            padding   zero bytes up to a multiple of 4
+//!            [n; 36]   point: txid (32 bytes, display order), then u32 vout
+//!            [n; 36]   chain anchor, same record layout as the point
+//! ```
+
+use bark::WalletVtxo;
+use bark::ark::bitcoin::Txid;
+use bark::ark::bitcoin::hashes::Hash;
+use bark::vtxo::VtxoState;
+
+pub(crate) const VTXO_COLUMNS_VERSION: u32 = 1;
+pub(crate) const VTXO_COLUMNS_HEADER_LEN: usize = 8;
+/// Length of an encoded point record in bytes
+pub(crate) const POINT_RECORD_LEN: usize = 32 + 4;
+
+fn state_code(state: &VtxoState) -> u8 {
+    match state {
+        VtxoState::Spendable => 0,
+        VtxoState::Spent => 1,
+        VtxoState::Locked { movement_id: _ } => 2,
+    }
+}
+
+/// Total encoded length for `count` vtxos
+pub(crate) fn vtxo_columns_len(count: usize) -> usize {
+    let scalars = VTXO_COLUMNS_HEADER_LEN + count * (8 + 4 + 2 + 1);
+    scalars.next_multiple_of(4) + 2 * count * POINT_RECORD_LEN
+}
+
+fn push_point(buf: &mut Vec<u8>, txid: Txid, vout: u32) {
+    let mut txid = txid.to_byte_array();
+    // txids are displayed in reverse byte order
+    txid.reverse();
+    buf.extend_from_slice(&txid);
+    buf.extend_from_slice(&vout.to_le_bytes());
+}
+
+pub(crate) fn encode_vtxo_columns(vtxos: &[WalletVtxo]) -> Vec<u8> {
+    let count = vtxos.len();
+    let mut buf = Vec::with_capacity(vtxo_columns_len(count));
+
+    buf.extend_from_slice(&VTXO_COLUMNS_VERSION.to_le_bytes());
+    buf.extend_from_slice(&(count as u32).to_le_bytes());
+    for v in vtxos {
+        buf.extend_from_slice(&v.vtxo.amount().to_sat().to_le_bytes());
+    }
+    for v in vtxos {
+        buf.extend_from_slice(&v.vtxo.expiry_height().to_le_bytes());
+    }
+    for v in vtxos {
+        buf.extend_from_slice(&v.vtxo.exit_delta().to_le_bytes());
+    }
+    buf.extend(vtxos.iter().map(|v| state_code(&v.state)));
+    buf.resize(buf.len().next_multiple_of(4), 0);
+
+    for v in vtxos {
+        let point = v.vtxo.point();
+        push_point(&mut buf, point.txid, point.vout);
+    }
+    for v in vtxos {
+        let anchor = v.vtxo.chain_anchor();
+        push_point(&mut buf, anchor.txid, anchor.vout);
+    }
+
+    debug_assert_eq!(buf.len(), vtxo_columns_len(count));
+    buf
+}
@@ -1,9 +1,9 @@
 use crate::cxx::ffi::{ArkoorPaymentResult, BarkMovement, BarkVtxo, OnchainPaymentResult};
-use crate::{TOKIO_RUNTIME, utils};
+use crate::{cancel, destination, snapshot, utils};
 use anyhow::{Context, Ok, bail};
+use bark::ark::ArkInfo;
 use bark::ark::bitcoin::hex::DisplayHex;
-use bark::ark::bitcoin::{Address, address};
-use bark::ark::lightning::{self, PaymentHash};
+use bark::ark::lightning::PaymentHash;
 use bdk_wallet::bitcoin::{self, FeeRate, network};
 use bip39::Mnemonic;
 use hex::ToHex;
@@ -58,12 +58,51 @@ pub(crate) mod ffi {
         vtxos: Vec<BarkVtxo>,
     }
 
+    /// A destination recognised by `parse_destination`. Zero amounts and
+    /// times are unset. The `lnurl_` fields are only set for a resolved
+    /// lightning address.
+    pub struct ParsedDestination {
+        /// ark, bolt11, bolt12_invoice, bolt12_offer, lightning_address or onchain
+        kind: String,
+        amount_msat: u64,
+        expires_at: u64,
+        expired: bool,
+        lnurl_min_sendable_msat: u64,
+        lnurl_max_sendable_msat: u64,
+        lnurl_comment_allowed: u32,
+        lnurl_description: String,
+    }
+
+    /// Outcome of one output of `send_arkoor_many`, `error` is empty on success
+    pub struct ArkoorBatchResult {
+        destination: String,
+        amount_sat: u64,
+        vtxos: Vec<BarkVtxo>,
+        error: String,
+    }
+
+    /// One invoice of `pay_lightning_invoices`, an amount of 0 pays the
+    /// amount of the invoice
+    pub struct LightningInvoicePayment {
+        invoice: String,
+        amount_sat: u64,
+    }
+
+    /// Outcome of one invoice of `pay_lightning_invoices`, `payment` is only
+    /// set when `error` is empty
+    pub struct LightningBatchResult {
+        invoice: String,
+        payment: LightningSend,
+        error: String,
+    }
+
     pub struct OnchainPaymentResult {
         txid: String,
         amount_sat: u64,
         destination_address: String,
     }
 
+    #[derive(Default)]
     pub struct CxxArkInfo {
         network: String,
         server_pubkey: String,
@@ -76,6 +115,19 @@ pub(crate) mod ffi {
         required_board_confirmations: u8,
     }
 
+    /// SQLite settings of the wallet database. Empty strings and zero sizes
+    /// keep the default.
+    pub struct StorageOpts {
+        /// "wal" (default), "delete" or "truncate"
+        journal_mode: String,
+        /// "off", "normal", "full" (default) or "extra"
+        synchronous: String,
+        mmap_size: u64,
+        cache_size_kib: u32,
+        /// Only applied when the wallet is created
+        page_size: u32,
+    }
+
     pub struct ConfigOpts {
         ark: String,
         esplora: String,
@@ -88,6 +140,7 @@ pub(crate) mod ffi {
         htlc_recv_claim_delta: u16,
         vtxo_exit_margin: u16,
         round_tx_required_confirmations: u32,
+        storage: StorageOpts,
     }
 
     pub struct CreateOpts {
@@ -121,6 +174,7 @@ pub(crate) mod ffi {
         pub finished_at: *const u64,
     }
 
+    #[derive(Clone)]
     pub struct OffchainBalance {
         /// Coins that are spendable in the Ark, either in-round or out-of-round.
         pub spendable: u64,
@@ -134,6 +188,7 @@ pub(crate) mod ffi {
         pub pending_board: u64,
     }
 
+    #[derive(Clone)]
     pub struct OnChainBalance {
         /// All coinbase outputs not yet matured
         pub immature: u64,
@@ -184,17 +239,294 @@ pub(crate) mod ffi {
         pub is_success: bool,
     }
 
+    /// Whatever is currently held by the in-memory wallet snapshot. Each
+    /// `has_*` flag tells whether the matching field is populated.
+    pub struct WalletSnapshot {
+        pub has_offchain_balance: bool,
+        pub offchain_balance: OffchainBalance,
+        pub has_onchain_balance: bool,
+        pub onchain_balance: OnChainBalance,
+        pub has_vtxos: bool,
+        pub vtxos: Vec<BarkVtxo>,
+        /// Set once the height is cached, it is still null without vtxos.
+        pub has_first_expiring_vtxo_blockheight: bool,
+        pub first_expiring_vtxo_blockheight: *const u32,
+    }
+
+    /// Balances, server info and vtxos for the wallet overview, read in one
+    /// bridge call. `has_ark_info` is false until the server info is known.
+    pub struct DashboardSnapshot {
+        pub offchain_balance: OffchainBalance,
+        pub onchain_balance: OnChainBalance,
+        pub has_ark_info: bool,
+        pub ark_info: CxxArkInfo,
+        pub next_required_refresh_blockheight: *const u32,
+        pub vtxos: Vec<BarkVtxo>,
+    }
+
+    pub struct OnchainUtxo {
+        /// "txid:vout"
+        pub outpoint: String,
+        pub amount_sat: u64,
+        /// 0 while unconfirmed
+        pub confirmation_height: u32,
+        /// external or internal for wallet outputs, local or exit for utxos
+        pub kind: String,
+    }
+
+    pub struct OnchainUtxoFilter {
+        /// Outputs below this amount are skipped, 0 keeps all
+        pub min_amount_sat: u64,
+        pub confirmed_only: bool,
+    }
+
+    pub struct HistoryQuery {
+        /// Id of the last movement of the previous page, 0 starts at the newest.
+        pub cursor: u32,
+        /// 0 uses the default page size.
+        pub limit: u32,
+        /// Empty matches any status.
+        pub status: String,
+        /// Empty matches any subsystem kind.
+        pub subsystem_kind: String,
+        /// Unix seconds, inclusive. 0 leaves the bound open.
+        pub created_after: u64,
+        /// Unix seconds, exclusive. 0 leaves the bound open.
+        pub created_before: u64,
+        pub include_metadata: bool,
+    }
+
+    pub struct HistoryPage {
+        pub movements: Vec<BarkMovement>,
+        /// Cursor for the next page, only meaningful when `has_more` is set.
+        pub next_cursor: u32,
+        pub has_more: bool,
+    }
+
+    pub struct HistoryExportOpts {
+        /// csv or jsonl
+        pub format: String,
+        /// Movements to export, newest first. A limit of 0 exports all.
+        pub query: HistoryQuery,
+        /// Rows written per advance call, 0 uses the default.
+        pub chunk_size: u32,
+    }
+
+    pub struct HistoryExportProgress {
+        pub id: u64,
+        pub written: u64,
+        /// Set once the file is complete at its final path
+        pub done: bool,
+    }
+
+    pub struct WalletEvent {
+        /// movement_created, movement_updated, vtxo_state_changed,
+        /// round_status, lightning_receive_settled or onchain_sync
+        pub kind: String,
+        /// Movement id, vtxo id, round funding txid, payment hash or "onchain"
+        pub id: String,
+        /// New movement status, vtxo state, round status or sync stage
+        pub status: String,
+        /// Previous status for movements and vtxos, the error for rounds,
+        /// "checkpoint:tip" heights for onchain syncs
+        pub detail: String,
+    }
+
+    pub struct OnchainSyncReport {
+        /// True if nothing changed since the last sync and it was skipped
+        pub skipped: bool,
+        /// Chain tip of the previous sync, 0 if there was none
+        pub from_height: u32,
+        pub tip_height: u32,
+        pub duration_ms: u64,
+    }
+
+    pub struct MaintenanceReport {
+        /// Names of the stages that ran, including failed ones
+        pub ran: Vec<String>,
+        /// Names of the stages that had nothing to do
+        pub skipped: Vec<String>,
+        pub failed: Vec<String>,
+        /// One entry per failed stage, prefixed with the stage name
+        pub errors: Vec<String>,
+        /// True if the request joined a pass another caller started
+        pub coalesced: bool,
+        pub duration_ms: u64,
+    }
+
+    pub struct RefreshPlanOpts {
+        /// Blocks past the first due VTXO within which others join its
+        /// round, 0 for the planner default
+        pub horizon_blocks: u32,
+        pub fold_dust: bool,
+        /// 0 for the planner default
+        pub dust_limit_sat: u64,
+    }
+
+    pub struct PlannedVtxo {
+        pub id: String,
+        pub amount_sat: u64,
+        pub expiry_height: u32,
+        /// "due", "horizon" or "dust"
+        pub reason: String,
+    }
+
+    /// The next refresh round for the wallet's spendable VTXOs. `has_*`
+    /// flags tell whether the matching height is set.
+    pub struct RefreshPlan {
+        pub tip: u32,
+        pub round_blocks: u32,
+        pub has_refresh_by: bool,
+        pub refresh_by: u32,
+        pub due_now: bool,
+        pub vtxos: Vec<PlannedVtxo>,
+        pub total_sat: u64,
+        pub has_next_refresh_by: bool,
+        pub next_refresh_by: u32,
+    }
+
+    pub struct WalletOpenTimings {
+        /// False until a wallet was opened in this process
+        pub recorded: bool,
+        pub db_open_ms: u64,
+        pub read_properties_ms: u64,
+        pub seed_ms: u64,
+        /// True if the seed was reused from an earlier open
+        pub seed_cached: bool,
+        pub onchain_load_ms: u64,
+        /// Opening the bark wallet, including the server handshake
+        pub wallet_open_ms: u64,
+        pub total_ms: u64,
+    }
+
+    pub struct LatencyHistogram {
+        pub count: u64,
+        pub sum_us: u64,
+        pub max_us: u64,
+        /// Bucket `i` counts samples below 2^i microseconds, the last one
+        /// everything above
+        pub buckets: Vec<u64>,
+    }
+
+    pub struct CallMetrics {
+        /// Name of the bridge function
+        pub name: String,
+        /// Time between the call and a native thread picking it up
+        pub queue_wait: LatencyHistogram,
+        /// Time waiting for the wallet manager and the mutation lock
+        pub lock_wait: LatencyHistogram,
+        pub execution: LatencyHistogram,
+        /// Native time outside Rust, mostly converting arguments and results
+        pub conversion: LatencyHistogram,
+    }
+
+    /// Memory charged to one subsystem. `allocations` counts those since
+    /// the last reset and is 0 for sqlite, which only reports bytes.
+    pub struct SubsystemAllocStats {
+        /// bridge, wallet, runtime or sqlite
+        pub name: String,
+        pub current_bytes: u64,
+        /// Highest `current_bytes` since the last reset
+        pub peak_bytes: u64,
+        pub allocations: u64,
+    }
+
+    /// Allocations made by one bridge function's future since the last reset
+    pub struct CallAllocStats {
+        pub name: String,
+        pub calls: u64,
+        pub allocations: u64,
+        pub bytes: u64,
+    }
+
+    pub struct AllocStats {
+        /// Whether the library was built with the `alloc-profiling` feature.
+        /// Without it only the sqlite subsystem is reported.
+        pub enabled: bool,
+        pub subsystems: Vec<SubsystemAllocStats>,
+        pub calls: Vec<CallAllocStats>,
+    }
+
+    /// Limits for a long call, 0 leaves either out. A cancelled
+    /// `cancel_token` or an elapsed `timeout_ms` stops the call, unless it
+    /// already started moving funds.
+    #[derive(Default)]
+    pub struct CallLimits {
+        pub cancel_token: u64,
+        pub timeout_ms: u64,
+    }
+
+    pub struct LogOpts {
+        /// env_logger style directives like "info,bark=warn". Modules
+        /// without a directive use the default level when no bare level is
+        /// given.
+        pub filter: String,
+        /// Lines kept in memory for dump_logs, 0 disables the buffer
+        pub ring_buffer_lines: u32,
+        /// Most verbose level kept in the buffer, empty for debug
+        pub ring_buffer_level: String,
+    }
+
+    pub struct RuntimeOpts {
+        /// Worker threads, 0 for one per core
+        pub worker_threads: u32,
+        /// Run all tasks on a single runtime thread
+        pub current_thread: bool,
+        /// Stack size of runtime threads in bytes, 0 for the default
+        pub thread_stack_size: u64,
+        /// Upper bound on threads for blocking work, 0 for the default
+        pub max_blocking_threads: u32,
+        /// Idle time before a blocking thread exits, 0 for the default
+        pub blocking_keep_alive_ms: u64,
+    }
+
+    pub struct LightningWaitResult {
+        /// Id returned when the wait was started
+        pub request_id: u64,
+        /// Empty if the wait succeeded
+        pub error: String,
+        /// Preimage of a settled outgoing payment
+        pub preimage: String,
+        /// Claimed incoming payment, null for outgoing payments and errors
+        pub receive: *const LightningReceive,
+    }
+
     extern "Rust" {
         fn init_logger();
+        fn configure_logging(opts: LogOpts) -> Result<()>;
+        fn set_log_filter(filter: &str) -> Result<()>;
+        fn dump_logs() -> Vec<String>;
+        fn clear_logs();
+        fn configure_runtime(opts: RuntimeOpts) -> Result<()>;
+        fn create_cancel_token() -> u64;
+        fn cancel_call(token: u64) -> bool;
+        fn release_cancel_token(token: u64);
         fn create_mnemonic() -> Result<String>;
         fn is_wallet_loaded() -> bool;
+        fn wallet_open_timings() -> WalletOpenTimings;
+        fn forget_cached_seed();
+        fn set_metrics_enabled(enabled: bool);
+        fn metrics_enabled() -> bool;
+        fn call_metrics() -> Vec<CallMetrics>;
+        fn reset_metrics();
+        fn alloc_stats() -> AllocStats;
+        fn reset_alloc_stats();
+        fn set_read_coalesce_window(window_ms: u64);
+        fn set_ark_info_ttl(ttl_secs: u64);
+        fn begin_bridge_call();
+        fn record_bridge_timing(queue_wait_us: u64, total_us: u64);
         fn close_wallet() -> Result<()>;
+        fn close_wallet_at(datadir: &str) -> Result<()>;
+        fn select_wallet(datadir: &str) -> Result<()>;
+        fn open_wallets() -> Vec<String>;
         fn get_ark_info() -> Result<CxxArkInfo>;
         fn offchain_balance() -> Result<OffchainBalance>;
         fn derive_store_next_keypair() -> Result<KeyPairResult>;
         fn peak_keypair(index: u32) -> Result<KeyPairResult>;
+        fn peak_keypairs(start: u32, count: u32) -> Result<Vec<KeyPairResult>>;
         fn new_address() -> Result<NewAddressResult>;
         fn peak_address(index: u32) -> Result<NewAddressResult>;
+        fn peak_addresses(start: u32, count: u32) -> Result<Vec<NewAddressResult>>;
         fn sign_message(message: &str, index: u32) -> Result<String>;
         fn sign_messsage_with_mnemonic(
             message: &str,
@@ -207,10 +539,27 @@ pub(crate) mod ffi {
             network: &str,
             index: u32,
         ) -> Result<KeyPairResult>;
+        fn derive_keypairs_from_mnemonic(
+            mnemonic: &str,
+            network: &str,
+            start: u32,
+            count: u32,
+        ) -> Result<Vec<KeyPairResult>>;
         fn verify_message(message: &str, signature: &str, public_key: &str) -> Result<bool>;
         fn history() -> Result<Vec<BarkMovement>>;
+        fn history_page(query: HistoryQuery) -> Result<HistoryPage>;
+        fn start_history_export(
+            path: &str,
+            opts: HistoryExportOpts,
+            limits: CallLimits,
+        ) -> Result<HistoryExportProgress>;
+        fn advance_history_export(id: u64) -> Result<HistoryExportProgress>;
+        fn cancel_history_export(id: u64) -> bool;
         fn vtxos() -> Result<Vec<BarkVtxo>>;
+        fn vtxos_columnar() -> Result<Vec<u8>>;
         fn get_expiring_vtxos(threshold: u32) -> Result<Vec<BarkVtxo>>;
+        fn cached_wallet_snapshot() -> WalletSnapshot;
+        fn dashboard_snapshot() -> Result<DashboardSnapshot>;
         fn get_first_expiring_vtxo_blockheight() -> Result<*const u32>;
         fn get_next_required_refresh_blockheight() -> Result<*const u32>;
         fn bolt11_invoice(amount_msat: u64) -> Result<Bolt11Invoice>;
@@ -219,21 +568,29 @@ pub(crate) mod ffi {
         fn sync_pending_boards() -> Result<()>;
         fn maintenance() -> Result<()>;
         fn maintenance_delegated() -> Result<()>;
-        fn maintenance_with_onchain() -> Result<()>;
+        fn maintenance_with_onchain(limits: CallLimits) -> Result<()>;
         fn maintenance_with_onchain_delegated() -> Result<()>;
         fn maintenance_refresh() -> Result<()>;
+        fn maintenance_scheduled(force_stages: Vec<String>) -> Result<MaintenanceReport>;
+        fn plan_refresh(opts: RefreshPlanOpts) -> Result<RefreshPlan>;
+        fn execute_refresh_plan(vtxo_ids: Vec<String>) -> Result<RoundStatus>;
         fn refresh_server() -> Result<()>;
         fn sync() -> Result<()>;
         fn create_wallet(datadir: &str, opts: CreateOpts) -> Result<()>;
         fn load_wallet(datadir: &str, config: CreateOpts) -> Result<()>;
         fn board_amount(amount_sat: u64) -> Result<BoardResult>;
-        fn board_all() -> Result<BoardResult>;
+        fn board_all(limits: CallLimits) -> Result<BoardResult>;
+        fn parse_destination(destination: &str, resolve: bool) -> Result<ParsedDestination>;
         fn validate_arkoor_address(address: &str) -> Result<()>;
         fn send_arkoor_payment(destination: &str, amount_sat: u64) -> Result<ArkoorPaymentResult>;
+        fn send_arkoor_many(outputs: Vec<SendManyOutput>) -> Result<Vec<ArkoorBatchResult>>;
         unsafe fn pay_lightning_invoice(
             destination: &str,
             amount_sat: *const u64,
         ) -> Result<LightningSend>;
+        fn pay_lightning_invoices(
+            payments: Vec<LightningInvoicePayment>,
+        ) -> Result<Vec<LightningBatchResult>>;
         unsafe fn pay_lightning_offer(offer: &str, amount_sat: *const u64)
         -> Result<LightningSend>;
         fn pay_lightning_address(
@@ -243,21 +600,33 @@ pub(crate) mod ffi {
         ) -> Result<LightningSend>;
         fn send_onchain(destination: &str, amount_sat: u64) -> Result<String>;
         fn offboard_specific(vtxo_ids: Vec<String>, destination_address: &str) -> Result<String>;
-        fn offboard_all(destination_address: &str) -> Result<String>;
+        fn offboard_all(destination_address: &str, limits: CallLimits) -> Result<String>;
         unsafe fn try_claim_lightning_receive(
             payment_hash: String,
             wait: bool,
             token: *const String,
         ) -> Result<LightningReceive>;
         fn try_claim_all_lightning_receives(wait: bool) -> Result<()>;
-        fn sync_exits() -> Result<()>;
+        fn start_check_lightning_payment(payment_hash: String) -> Result<u64>;
+        unsafe fn start_try_claim_lightning_receive(
+            payment_hash: String,
+            token: *const String,
+        ) -> Result<u64>;
+        fn cancel_lightning_wait(payment_hash: &str) -> u32;
+        fn wait_for_lightning_completions(timeout_ms: u32) -> Vec<LightningWaitResult>;
+        fn sync_exits(limits: CallLimits) -> Result<()>;
         fn sync_pending_rounds() -> Result<()>;
+        fn set_wallet_events_enabled(enabled: bool);
+        fn wait_for_wallet_events(timeout_ms: u32, batch_window_ms: u32) -> Vec<WalletEvent>;
 
         // Onchain methods
         fn onchain_balance() -> Result<OnChainBalance>;
         fn onchain_sync() -> Result<()>;
+        fn onchain_sync_incremental(force: bool) -> Result<OnchainSyncReport>;
         fn onchain_list_unspent() -> Result<String>;
         fn onchain_utxos() -> Result<String>;
+        fn onchain_unspent_outputs(filter: OnchainUtxoFilter) -> Result<Vec<OnchainUtxo>>;
+        fn onchain_utxo_list(filter: OnchainUtxoFilter) -> Result<Vec<OnchainUtxo>>;
         fn onchain_address() -> Result<String>;
         unsafe fn onchain_send(
             destination: &str,
@@ -276,21 +645,201 @@ pub(crate) fn init_logger() {
     crate::init_logger()
 }
 
+pub(crate) fn parse_log_filter(filter: &str) -> anyhow::Result<logger::Filter> {
+    // A later bare level overrides the default
+    format!("{},{}", crate::DEFAULT_LOG_LEVEL, filter)
+        .parse::<logger::Filter>()
+        .map_err(anyhow::Error::new)
+}
+
+pub(crate) fn configure_logging(opts: ffi::LogOpts) -> anyhow::Result<()> {
+    let ring_level = match opts.ring_buffer_level.as_str() {
+        "" => log::LevelFilter::Debug,
+        level => level
+            .parse()
+            .map_err(|_| anyhow::anyhow!("Invalid log level '{}'", level))?,
+    };
+    crate::configure_logging(logger::LogConfig {
+        filter: parse_log_filter(&opts.filter)?,
+        ring_capacity: opts.ring_buffer_lines as usize,
+        ring_level,
+    });
+    Ok(())
+}
+
+pub(crate) fn set_log_filter(filter: &str) -> anyhow::Result<()> {
+    crate::set_log_filter(parse_log_filter(filter)?);
+    Ok(())
+}
+
+pub(crate) fn create_cancel_token() -> u64 {
+    cancel::create_token()
+}
+
+pub(crate) fn cancel_call(token: u64) -> bool {
+    cancel::cancel(token)
+}
+
+pub(crate) fn release_cancel_token(token: u64) {
+    cancel::release(token)
+}
+
+fn call_limits(limits: ffi::CallLimits) -> cancel::CallLimits {
+    cancel::CallLimits {
+        token: limits.cancel_token,
+        timeout: (limits.timeout_ms > 0)
+            .then(|| std::time::Duration::from_millis(limits.timeout_ms)),
+    }
+}
+
+pub(crate) fn dump_logs() -> Vec<String> {
+    logger::Logger::dump()
+}
+
+pub(crate) fn clear_logs() {
+    logger::Logger::clear_dump()
+}
+
+pub(crate) fn configure_runtime(opts: ffi::RuntimeOpts) -> anyhow::Result<()> {
+    crate::runtime::configure(crate::runtime::RuntimeConfig {
+        worker_threads: opts.worker_threads as usize,
+        current_thread: opts.current_thread,
+        thread_stack_size: opts.thread_stack_size as usize,
+        max_blocking_threads: opts.max_blocking_threads as usize,
+        blocking_keep_alive: std::time::Duration::from_millis(opts.blocking_keep_alive_ms),
+    })
+}
+
 pub(crate) fn create_mnemonic() -> anyhow::Result<String> {
     crate::create_mnemonic()
 }
 
+pub(crate) fn wallet_open_timings() -> ffi::WalletOpenTimings {
+    let ms = |d: std::time::Duration| d.as_millis() as u64;
+    let timings = crate::startup::last_open_timings();
+    let t = timings.unwrap_or_default();
+    ffi::WalletOpenTimings {
+        recorded: timings.is_some(),
+        db_open_ms: ms(t.db_open),
+        read_properties_ms: ms(t.read_properties),
+        seed_ms: ms(t.seed),
+        seed_cached: t.seed_cached,
+        onchain_load_ms: ms(t.onchain_load),
+        wallet_open_ms: ms(t.wallet_open),
+        total_ms: ms(t.total),
+    }
+}
+
+pub(crate) fn forget_cached_seed() {
+    crate::startup::forget_seed()
+}
+
+pub(crate) fn set_metrics_enabled(enabled: bool) {
+    crate::metrics::set_enabled(enabled)
+}
+
+pub(crate) fn metrics_enabled() -> bool {
+    crate::metrics::enabled()
+}
+
+pub(crate) fn call_metrics() -> Vec<ffi::CallMetrics> {
+    let histogram = |h: crate::metrics::Histogram| ffi::LatencyHistogram {
+        count: h.count,
+        sum_us: h.sum_us,
+        max_us: h.max_us,
+        buckets: h.buckets.to_vec(),
+    };
+    crate::metrics::snapshot()
+        .into_iter()
+        .map(|(name, m)| ffi::CallMetrics {
+            name: name.to_string(),
+            queue_wait: histogram(m.queue_wait),
+            lock_wait: histogram(m.lock_wait),
+            execution: histogram(m.execution),
+            conversion: histogram(m.conversion),
+        })
+        .collect()
+}
+
+pub(crate) fn reset_metrics() {
+    crate::metrics::reset()
+}
+
+pub(crate) fn alloc_stats() -> ffi::AllocStats {
+    ffi::AllocStats {
+        enabled: crate::alloc_stats::enabled(),
+        subsystems: crate::alloc_stats::subsystem_stats()
+            .into_iter()
+            .map(|s| ffi::SubsystemAllocStats {
+                name: s.name.to_string(),
+                current_bytes: s.current_bytes,
+                peak_bytes: s.peak_bytes,
+                allocations: s.allocations,
+            })
+            .collect(),
+        calls: crate::alloc_stats::call_stats()
+            .into_iter()
+            .map(|(name, s)| ffi::CallAllocStats {
+                name: name.to_string(),
+                calls: s.calls,
+                allocations: s.allocations,
+                bytes: s.bytes,
+            })
+            .collect(),
+    }
+}
+
+pub(crate) fn reset_alloc_stats() {
+    crate::alloc_stats::reset()
+}
+
+pub(crate) fn set_read_coalesce_window(window_ms: u64) {
+    crate::singleflight::set_read_window(std::time::Duration::from_millis(window_ms))
+}
+
+pub(crate) fn set_ark_info_ttl(ttl_secs: u64) {
+    crate::server::set_ttl(std::time::Duration::from_secs(ttl_secs))
+}
+
+pub(crate) fn begin_bridge_call() {
+    crate::metrics::begin_bridge_call()
+}
+
+pub(crate) fn record_bridge_timing(queue_wait_us: u64, total_us: u64) {
+    crate::metrics::record_bridge_timing(
+        std::time::Duration::from_micros(queue_wait_us),
+        std::time::Duration::from_micros(total_us),
+    )
+}
+
 pub(crate) fn is_wallet_loaded() -> bool {
-    crate::TOKIO_RUNTIME.block_on(crate::is_wallet_loaded())
+    crate::metrics::block_on("is_wallet_loaded", crate::is_wallet_loaded())
 }
 
 pub(crate) fn close_wallet() -> anyhow::Result<()> {
-    crate::TOKIO_RUNTIME.block_on(crate::close_wallet())
+    crate::metrics::block_on("close_wallet", crate::close_wallet())
 }
 
-pub(crate) fn get_ark_info() -> anyhow::Result<ffi::CxxArkInfo> {
-    let info = crate::TOKIO_RUNTIME.block_on(crate::get_ark_info())?;
-    Ok(ffi::CxxArkInfo {
+pub(crate) fn close_wallet_at(datadir: &str) -> anyhow::Result<()> {
+    crate::metrics::block_on(
+        "close_wallet_at",
+        crate::close_wallet_at(Path::new(datadir)),
+    )
+}
+
+pub(crate) fn select_wallet(datadir: &str) -> anyhow::Result<()> {
+    crate::metrics::block_on("select_wallet", crate::select_wallet(Path::new(datadir)))
+}
+
+pub(crate) fn open_wallets() -> Vec<String> {
+    crate::metrics::block_on("open_wallets", crate::open_wallets())
+        .into_iter()
+        .map(|datadir| datadir.display().to_string())
+        .collect()
+}
+
+fn ark_info_to_ffi(info: &ArkInfo) -> ffi::CxxArkInfo {
+    ffi::CxxArkInfo {
         network: info.network.to_string(),
         server_pubkey: info.server_pubkey.to_string(),
         round_interval: info.round_interval.as_secs(),
@@ -300,59 +849,97 @@ pub(crate) fn get_ark_info() -> anyhow::Result<ffi::CxxArkInfo> {
         htlc_send_expiry_delta: info.htlc_send_expiry_delta,
         max_vtxo_amount: info.max_vtxo_amount.map_or(0, |a| a.to_sat()),
         required_board_confirmations: info.required_board_confirmations as u8,
-    })
+    }
 }
 
-pub(crate) fn offchain_balance() -> anyhow::Result<ffi::OffchainBalance> {
-    let balance = crate::TOKIO_RUNTIME.block_on(crate::balance())?;
-    Ok(ffi::OffchainBalance {
+fn offchain_balance_to_ffi(balance: &bark::Balance) -> ffi::OffchainBalance {
+    ffi::OffchainBalance {
         spendable: balance.spendable.to_sat(),
         pending_lightning_send: balance.pending_lightning_send.to_sat(),
 
         pending_in_round: balance.pending_in_round.to_sat(),
         pending_exit: balance.pending_exit.map_or(0, |a| a.to_sat()),
         pending_board: balance.pending_board.to_sat(),
-    })
+    }
 }
 
-pub(crate) fn derive_store_next_keypair() -> anyhow::Result<ffi::KeyPairResult> {
-    let keypair = crate::TOKIO_RUNTIME.block_on(crate::derive_store_next_keypair())?;
-    Ok(ffi::KeyPairResult {
-        public_key: keypair.public_key().to_string(),
-        secret_key: keypair.secret_key().display_secret().to_string(),
-    })
+fn onchain_balance_to_ffi(balance: &bdk_wallet::Balance) -> ffi::OnChainBalance {
+    ffi::OnChainBalance {
+        immature: balance.immature.to_sat(),
+        trusted_pending: balance.trusted_pending.to_sat(),
+        untrusted_pending: balance.untrusted_pending.to_sat(),
+        confirmed: balance.confirmed.to_sat(),
+    }
 }
 
-pub(crate) fn peak_keypair(index: u32) -> anyhow::Result<ffi::KeyPairResult> {
-    let keypair = crate::TOKIO_RUNTIME.block_on(crate::peak_keypair(index))?;
-    Ok(ffi::KeyPairResult {
+pub(crate) fn get_ark_info() -> anyhow::Result<ffi::CxxArkInfo> {
+    let info = crate::metrics::block_on("get_ark_info", crate::get_ark_info())?;
+    Ok(ark_info_to_ffi(&info))
+}
+
+pub(crate) fn offchain_balance() -> anyhow::Result<ffi::OffchainBalance> {
+    if let Some(balance) = snapshot::read(|s| s.offchain_balance.clone()) {
+        return Ok(balance);
+    }
+    let generation = snapshot::generation();
+    let balance = crate::metrics::block_on("offchain_balance", crate::balance())?;
+    let balance = offchain_balance_to_ffi(&balance);
+    snapshot::store(generation, |s| s.offchain_balance = Some(balance.clone()));
+    Ok(balance)
+}
+
+fn keypair_to_ffi(keypair: &bitcoin::key::Keypair) -> ffi::KeyPairResult {
+    ffi::KeyPairResult {
         public_key: keypair.public_key().to_string(),
         secret_key: keypair.secret_key().display_secret().to_string(),
-    })
+    }
 }
 
-pub(crate) fn new_address() -> anyhow::Result<ffi::NewAddressResult> {
-    let address = crate::TOKIO_RUNTIME.block_on(crate::new_address())?;
-    Ok(ffi::NewAddressResult {
+fn address_to_ffi(address: &bark::ark::Address) -> ffi::NewAddressResult {
+    ffi::NewAddressResult {
         user_pubkey: address.policy().user_pubkey().to_string(),
         ark_id: address.ark_id().to_string(),
         address: address.to_string(),
-    })
+    }
+}
+
+pub(crate) fn derive_store_next_keypair() -> anyhow::Result<ffi::KeyPairResult> {
+    let keypair = crate::metrics::block_on(
+        "derive_store_next_keypair",
+        crate::derive_store_next_keypair(),
+    )?;
+    Ok(keypair_to_ffi(&keypair))
+}
+
+pub(crate) fn peak_keypair(index: u32) -> anyhow::Result<ffi::KeyPairResult> {
+    let keypair = crate::metrics::block_on("peak_keypair", crate::peak_keypair(index))?;
+    Ok(keypair_to_ffi(&keypair))
+}
+
+pub(crate) fn peak_keypairs(start: u32, count: u32) -> anyhow::Result<Vec<ffi::KeyPairResult>> {
+    let keypairs = crate::metrics::block_on("peak_keypairs", crate::peak_keypairs(start, count))?;
+    Ok(keypairs.iter().map(keypair_to_ffi).collect())
+}
+
+pub(crate) fn new_address() -> anyhow::Result<ffi::NewAddressResult> {
+    let address = crate::metrics::block_on("new_address", crate::new_address())?;
+    Ok(address_to_ffi(&address))
 }
 
 pub(crate) fn peak_address(index: u32) -> anyhow::Result<ffi::NewAddressResult> {
-    let address = crate::TOKIO_RUNTIME.block_on(crate::peak_address(index))?;
-    Ok(ffi::NewAddressResult {
-        user_pubkey: address.policy().user_pubkey().to_string(),
-        ark_id: address.ark_id().to_string(),
-        address: address.to_string(),
-    })
+    let address = crate::metrics::block_on("peak_address", crate::peak_address(index))?;
+    Ok(address_to_ffi(&address))
+}
+
+pub(crate) fn peak_addresses(start: u32, count: u32) -> anyhow::Result<Vec<ffi::NewAddressResult>> {
+    let addresses =
+        crate::metrics::block_on("peak_addresses", crate::peak_addresses(start, count))?;
+    Ok(addresses.iter().map(address_to_ffi).collect())
 }
 
 pub(crate) fn sign_message(message: &str, index: u32) -> anyhow::Result<String> {
-    let message = crate::TOKIO_RUNTIME
-        .block_on(crate::sign_message(message, index))?
-        .to_string();
+    let message =
+        crate::metrics::block_on("sign_message", crate::sign_message(message, index))?.to_string();
     Ok(message)
 }
 
@@ -372,11 +959,11 @@ pub(crate) fn sign_messsage_with_mnemonic(
         _ => bail!("Invalid network format: '{}'", network),
     };
 
-    let message = crate::TOKIO_RUNTIME
-        .block_on(crate::sign_messsage_with_mnemonic(
-            message, mnemonic, network, index,
-        ))?
-        .to_string();
+    let message = crate::metrics::block_on(
+        "sign_messsage_with_mnemonic",
+        crate::sign_messsage_with_mnemonic(message, mnemonic, network, index),
+    )?
+    .to_string();
     Ok(message)
 }
 
@@ -394,14 +981,34 @@ pub(crate) fn derive_keypair_from_mnemonic(
         _ => bail!("Invalid network format: '{}'", network),
     };
 
-    let keypair = crate::TOKIO_RUNTIME.block_on(crate::derive_keypair_from_mnemonic(
-        mnemonic, network, index,
-    ))?;
+    let keypair = crate::metrics::block_on(
+        "derive_keypair_from_mnemonic",
+        crate::derive_keypair_from_mnemonic(mnemonic, network, index),
+    )?;
 
-    Ok(ffi::KeyPairResult {
-        public_key: keypair.public_key().to_string(),
-        secret_key: keypair.secret_key().display_secret().to_string(),
-    })
+    Ok(keypair_to_ffi(&keypair))
+}
+
+pub(crate) fn derive_keypairs_from_mnemonic(
+    mnemonic: &str,
+    network: &str,
+    start: u32,
+    count: u32,
+) -> anyhow::Result<Vec<ffi::KeyPairResult>> {
+    let mnemonic = bip39::Mnemonic::from_str(mnemonic)
+        .with_context(|| format!("Invalid mnemonic format: '{}'", mnemonic))?;
+    let network = match network {
+        "mainnet" => network::Network::Bitcoin,
+        "regtest" => network::Network::Regtest,
+        "signet" => network::Network::Signet,
+        _ => bail!("Invalid network format: '{}'", network),
+    };
+
+    let keypairs = crate::metrics::block_on(
+        "derive_keypairs_from_mnemonic",
+        crate::derive_keypairs_from_mnemonic(mnemonic, network, start, count),
+    )?;
+    Ok(keypairs.iter().map(keypair_to_ffi).collect())
 }
 
 pub(crate) fn verify_message(
@@ -414,11 +1021,14 @@ pub(crate) fn verify_message(
     let public_key = bark::ark::bitcoin::secp256k1::PublicKey::from_str(public_key)
         .with_context(|| format!("Invalid public key format: '{}'", public_key))?;
 
-    crate::TOKIO_RUNTIME.block_on(crate::verify_message(message, signature, &public_key))
+    crate::metrics::block_on(
+        "verify_message",
+        crate::verify_message(message, signature, &public_key),
+    )
 }
 
 pub(crate) fn history() -> anyhow::Result<Vec<BarkMovement>> {
-    let history = crate::TOKIO_RUNTIME.block_on(crate::history())?;
+    let history = crate::metrics::block_on("history", crate::history())?;
     fn fun_name(m: &bark::movement::Movement) -> Result<BarkMovement, anyhow::Error> {
         utils::movement_to_bark_movement(m)
     }
@@ -426,33 +1036,167 @@ pub(crate) fn history() -> anyhow::Result<Vec<BarkMovement>> {
     history.iter().map(fun_name).collect()
 }
 
+pub(crate) fn history_page(query: ffi::HistoryQuery) -> anyhow::Result<ffi::HistoryPage> {
+    let include_metadata = query.include_metadata;
+    let query = utils::ffi_history_query_to_query(&query);
+    let (page, has_more) = crate::metrics::block_on("history_page", crate::history_page(query))?;
+
+    let movements = page
+        .iter()
+        .map(|m| utils::movement_to_bark_movement_with(m, include_metadata))
+        .collect::<anyhow::Result<Vec<_>>>()?;
+    Ok(ffi::HistoryPage {
+        next_cursor: page.last().map_or(0, |m| m.id.0),
+        movements,
+        has_more,
+    })
+}
+
+fn history_export_progress_to_ffi(
+    progress: crate::history_export::Progress,
+) -> ffi::HistoryExportProgress {
+    ffi::HistoryExportProgress {
+        id: progress.id,
+        written: progress.written as u64,
+        done: progress.done,
+    }
+}
+
+pub(crate) fn start_history_export(
+    path: &str,
+    opts: ffi::HistoryExportOpts,
+    limits: ffi::CallLimits,
+) -> anyhow::Result<ffi::HistoryExportProgress> {
+    let format = opts.format.parse::<crate::history_export::Format>()?;
+    let mut query = utils::ffi_history_query_to_query(&opts.query);
+    if opts.query.limit == 0 {
+        query.limit = usize::MAX;
+    }
+    let chunk_size = match opts.chunk_size {
+        0 => crate::history_export::DEFAULT_CHUNK_SIZE,
+        size => size as usize,
+    };
+    let progress = crate::history_export::start(
+        Path::new(path),
+        format,
+        query,
+        opts.query.include_metadata,
+        chunk_size,
+        call_limits(limits),
+    )?;
+    Ok(history_export_progress_to_ffi(progress))
+}
+
+pub(crate) fn advance_history_export(id: u64) -> anyhow::Result<ffi::HistoryExportProgress> {
+    crate::metrics::block_on("advance_history_export", crate::history_export::advance(id))
+        .map(history_export_progress_to_ffi)
+}
+
+pub(crate) fn cancel_history_export(id: u64) -> bool {
+    crate::history_export::cancel(id)
+}
+
 pub(crate) fn vtxos() -> anyhow::Result<Vec<BarkVtxo>> {
-    let vtxos = crate::TOKIO_RUNTIME.block_on(crate::vtxos())?;
-    Ok(vtxos
-        .into_iter()
-        .map(utils::wallet_vtxo_to_bark_vtxo)
-        .collect())
+    if let Some(vtxos) = snapshot::read(|s| s.vtxos.clone()) {
+        return Ok(vtxos);
+    }
+    let generation = snapshot::generation();
+    let vtxos = crate::metrics::block_on("vtxos", crate::vtxos())?;
+    let vtxos: Vec<BarkVtxo> = utils::wallet_vtxos_to_bark_vtxos(vtxos);
+    snapshot::store(generation, |s| s.vtxos = Some(vtxos.clone()));
+    Ok(vtxos)
+}
+
+pub(crate) fn vtxos_columnar() -> anyhow::Result<Vec<u8>> {
+    let vtxos = crate::metrics::block_on("vtxos_columnar", crate::vtxos())?;
+    Ok(crate::columnar::encode_vtxo_columns(&vtxos))
 }
 
 pub(crate) fn get_expiring_vtxos(threshold: u32) -> anyhow::Result<Vec<BarkVtxo>> {
-    let expiring_vtxos = crate::TOKIO_RUNTIME.block_on(crate::get_expiring_vtxos(threshold))?;
-    Ok(expiring_vtxos
-        .into_iter()
-        .map(utils::wallet_vtxo_to_bark_vtxo)
-        .collect())
+    let expiring_vtxos =
+        crate::metrics::block_on("get_expiring_vtxos", crate::get_expiring_vtxos(threshold))?;
+    Ok(utils::wallet_vtxos_to_bark_vtxos(expiring_vtxos))
 }
 
 pub(crate) fn get_first_expiring_vtxo_blockheight() -> anyhow::Result<*const u32> {
-    let blockheight = crate::TOKIO_RUNTIME.block_on(crate::get_first_expiring_vtxo_blockheight())?;
+    let blockheight = match snapshot::read(|s| s.first_expiring_vtxo_blockheight) {
+        Some(blockheight) => blockheight,
+        None => {
+            let generation = snapshot::generation();
+            let blockheight = crate::metrics::block_on(
+                "get_first_expiring_vtxo_blockheight",
+                crate::get_first_expiring_vtxo_blockheight(),
+            )?;
+            snapshot::store(generation, |s| {
+                s.first_expiring_vtxo_blockheight = Some(blockheight)
+            });
+            blockheight
+        }
+    };
     match blockheight {
         Some(height) => Ok(Box::into_raw(Box::new(height))),
         None => Ok(std::ptr::null()),
     }
 }
 
+pub(crate) fn cached_wallet_snapshot() -> ffi::WalletSnapshot {
+    snapshot::read(|s| ffi::WalletSnapshot {
+        has_offchain_balance: s.offchain_balance.is_some(),
+        offchain_balance: s.offchain_balance.clone().unwrap_or(ffi::OffchainBalance {
+            spendable: 0,
+            pending_lightning_send: 0,
+            pending_in_round: 0,
+            pending_exit: 0,
+            pending_board: 0,
+        }),
+        has_onchain_balance: s.onchain_balance.is_some(),
+        onchain_balance: s.onchain_balance.clone().unwrap_or(ffi::OnChainBalance {
+            immature: 0,
+            trusted_pending: 0,
+            untrusted_pending: 0,
+            confirmed: 0,
+        }),
+        has_vtxos: s.vtxos.is_some(),
+        vtxos: s.vtxos.clone().unwrap_or_default(),
+        has_first_expiring_vtxo_blockheight: s.first_expiring_vtxo_blockheight.is_some(),
+        first_expiring_vtxo_blockheight: match s.first_expiring_vtxo_blockheight.flatten() {
+            Some(height) => Box::into_raw(Box::new(height)),
+            None => std::ptr::null(),
+        },
+    })
+}
+
+pub(crate) fn dashboard_snapshot() -> anyhow::Result<ffi::DashboardSnapshot> {
+    let generation = snapshot::generation();
+    let dashboard = crate::metrics::block_on("dashboard_snapshot", crate::dashboard())?;
+    let dashboard = ffi::DashboardSnapshot {
+        offchain_balance: offchain_balance_to_ffi(&dashboard.balance),
+        onchain_balance: onchain_balance_to_ffi(&dashboard.onchain_balance),
+        has_ark_info: dashboard.ark_info.is_some(),
+        ark_info: dashboard
+            .ark_info
+            .as_ref()
+            .map(ark_info_to_ffi)
+            .unwrap_or_default(),
+        next_required_refresh_blockheight: dashboard
+            .next_required_refresh_blockheight
+            .map_or(std::ptr::null(), |height| Box::into_raw(Box::new(height))),
+        vtxos: utils::wallet_vtxos_to_bark_vtxos(dashboard.vtxos),
+    };
+    // Later single reads are served from what was just fetched
+    snapshot::store(generation, |s| {
+        s.offchain_balance = Some(dashboard.offchain_balance.clone());
+        s.onchain_balance = Some(dashboard.onchain_balance.clone());
+        s.vtxos = Some(dashboard.vtxos.clone());
+    });
+    Ok(dashboard)
+}
+
 pub(crate) fn get_next_required_refresh_blockheight() -> anyhow::Result<*const u32> {
-    let blockheight =
-        crate::TOKIO_RUNTIME.block_on(crate::get_next_required_refresh_blockheight())?;
+    let blockheight = crate::metrics::block_on(
+        "get_next_required_refresh_blockheight",
+        crate::get_next_required_refresh_blockheight(),
+    )?;
     match blockheight {
         Some(height) => Ok(Box::into_raw(Box::new(height))),
         None => Ok(std::ptr::null()),
@@ -460,7 +1204,7 @@ pub(crate) fn get_next_required_refresh_blockheight() -> anyhow::Result<*const u
 }
 
 pub(crate) fn bolt11_invoice(amount_msat: u64) -> anyhow::Result<ffi::Bolt11Invoice> {
-    let invoice = crate::TOKIO_RUNTIME.block_on(crate::bolt11_invoice(amount_msat))?;
+    let invoice = crate::metrics::block_on("bolt11_invoice", crate::bolt11_invoice(amount_msat))?;
     Ok(ffi::Bolt11Invoice {
         bolt11_invoice: invoice.to_string(),
         payment_secret: invoice.payment_secret().to_string(),
@@ -473,57 +1217,134 @@ pub(crate) fn lightning_receive_status(
 ) -> anyhow::Result<*const ffi::LightningReceive> {
     let payment = bark::ark::lightning::PaymentHash::from_str(&payment_hash)
         .with_context(|| format!("Invalid payment hash format: '{}'", payment_hash))?;
-    let status = crate::TOKIO_RUNTIME.block_on(crate::lightning_receive_status(payment))?;
+    let status = crate::metrics::block_on(
+        "lightning_receive_status",
+        crate::lightning_receive_status(payment),
+    )?;
 
     if status.is_none() {
         return Ok(std::ptr::null());
     }
 
     let status = status.unwrap();
-    let status = Box::new(ffi::LightningReceive {
-        payment_hash: status.payment_hash.to_string(),
-        payment_preimage: status.payment_preimage.to_string(),
-        invoice: status.invoice.to_string(),
-        preimage_revealed_at: status.preimage_revealed_at.map_or(std::ptr::null(), |v| {
-            Box::into_raw(Box::new(v.timestamp() as u64))
-        }),
-        finished_at: status.finished_at.map_or(std::ptr::null(), |v| {
-            Box::into_raw(Box::new(v.timestamp() as u64))
-        }),
-    });
+    let status = Box::new(crate::utils::lightning_receive_to_ffi(&status));
     Ok(Box::into_raw(status))
 }
 
 pub(crate) fn sync_pending_boards() -> anyhow::Result<()> {
-    crate::TOKIO_RUNTIME.block_on(crate::sync_pending_boards())
+    crate::metrics::block_on("sync_pending_boards", crate::sync_pending_boards())
 }
 
 pub(crate) fn maintenance() -> anyhow::Result<()> {
-    crate::TOKIO_RUNTIME.block_on(crate::maintenance())
+    crate::metrics::block_on("maintenance", crate::maintenance())
 }
 
 pub(crate) fn maintenance_delegated() -> anyhow::Result<()> {
-    crate::TOKIO_RUNTIME.block_on(crate::maintenance_delegated())
+    crate::metrics::block_on("maintenance_delegated", crate::maintenance_delegated())
 }
 
-pub(crate) fn maintenance_with_onchain() -> anyhow::Result<()> {
-    crate::TOKIO_RUNTIME.block_on(crate::maintenance_with_onchain())
+pub(crate) fn maintenance_with_onchain(limits: ffi::CallLimits) -> anyhow::Result<()> {
+    crate::metrics::block_on(
+        "maintenance_with_onchain",
+        cancel::run(
+            "maintenance_with_onchain",
+            call_limits(limits),
+            crate::maintenance_with_onchain(),
+        ),
+    )
 }
 
 pub(crate) fn maintenance_with_onchain_delegated() -> anyhow::Result<()> {
-    crate::TOKIO_RUNTIME.block_on(crate::maintenance_with_onchain_delegated())
+    crate::metrics::block_on(
+        "maintenance_with_onchain_delegated",
+        crate::maintenance_with_onchain_delegated(),
+    )
 }
 
 pub(crate) fn maintenance_refresh() -> anyhow::Result<()> {
-    crate::TOKIO_RUNTIME.block_on(crate::maintenance_refresh())
+    crate::metrics::block_on("maintenance_refresh", crate::maintenance_refresh())
+}
+
+pub(crate) fn maintenance_scheduled(
+    force_stages: Vec<String>,
+) -> anyhow::Result<ffi::MaintenanceReport> {
+    let forced = crate::scheduler::parse_stages(&force_stages)?;
+    let report = crate::metrics::block_on("maintenance_scheduled", crate::scheduler::run(forced))?;
+    Ok(ffi::MaintenanceReport {
+        ran: crate::scheduler::stage_names(report.ran),
+        skipped: crate::scheduler::stage_names(report.skipped),
+        failed: crate::scheduler::stage_names(report.failed),
+        errors: report.errors,
+        coalesced: report.coalesced,
+        duration_ms: report.duration.as_millis() as u64,
+    })
+}
+
+pub(crate) fn plan_refresh(opts: ffi::RefreshPlanOpts) -> anyhow::Result<ffi::RefreshPlan> {
+    let defaults = crate::refresh_plan::PlanOpts::default();
+    let opts = crate::refresh_plan::PlanOpts {
+        horizon_blocks: match opts.horizon_blocks {
+            0 => defaults.horizon_blocks,
+            blocks => blocks,
+        },
+        fold_dust: opts.fold_dust,
+        dust_limit: match opts.dust_limit_sat {
+            0 => defaults.dust_limit,
+            sat => bark::ark::bitcoin::Amount::from_sat(sat),
+        },
+    };
+    let plan = crate::metrics::block_on("plan_refresh", crate::refresh_plan::compute(opts))?;
+    Ok(ffi::RefreshPlan {
+        tip: plan.tip,
+        round_blocks: plan.round_blocks,
+        has_refresh_by: plan.refresh_by.is_some(),
+        refresh_by: plan.refresh_by.unwrap_or(0),
+        due_now: plan.due_now,
+        vtxos: plan
+            .vtxos
+            .iter()
+            .map(|v| ffi::PlannedVtxo {
+                id: v.candidate.id.to_string(),
+                amount_sat: v.candidate.amount.to_sat(),
+                expiry_height: v.candidate.expiry_height,
+                reason: v.reason.name().to_string(),
+            })
+            .collect(),
+        total_sat: plan.total.to_sat(),
+        has_next_refresh_by: plan.next_refresh_by.is_some(),
+        next_refresh_by: plan.next_refresh_by.unwrap_or(0),
+    })
+}
+
+/// Returns a status with an empty `status` if no round was started
+pub(crate) fn execute_refresh_plan(vtxo_ids: Vec<String>) -> anyhow::Result<ffi::RoundStatus> {
+    let ids = vtxo_ids
+        .iter()
+        .map(|s| {
+            bark::ark::VtxoId::from_str(s).with_context(|| format!("Invalid vtxo id: '{}'", s))
+        })
+        .collect::<anyhow::Result<Vec<_>>>()?;
+    let status =
+        crate::metrics::block_on("execute_refresh_plan", crate::refresh_plan::execute(ids))?;
+    Ok(match status {
+        Some(status) => utils::round_status_to_ffi(&status),
+        None => ffi::RoundStatus {
+            status: String::new(),
+            funding_txid: String::new(),
+            unsigned_funding_txids: Vec::new(),
+            error: String::new(),
+            is_final: false,
+            is_success: false,
+        },
+    })
 }
 
 pub(crate) fn refresh_server() -> anyhow::Result<()> {
-    crate::TOKIO_RUNTIME.block_on(crate::refresh_server())
+    crate::metrics::block_on("refresh_server", crate::refresh_server())
 }
 
 pub(crate) fn sync() -> anyhow::Result<()> {
-    crate::TOKIO_RUNTIME.block_on(crate::sync())
+    crate::metrics::block_on("sync", crate::sync())
 }
 
 pub(crate) fn create_wallet(datadir: &str, opts: ffi::CreateOpts) -> anyhow::Result<()> {
@@ -531,7 +1352,10 @@ pub(crate) fn create_wallet(datadir: &str, opts: ffi::CreateOpts) -> anyhow::Res
 
     log::info!("Creating wallet with options: {:?}", create_opts);
 
-    crate::TOKIO_RUNTIME.block_on(crate::create_wallet(Path::new(datadir), create_opts))
+    crate::metrics::block_on(
+        "create_wallet",
+        crate::create_wallet(Path::new(datadir), create_opts),
+    )
 }
 
 pub(crate) fn load_wallet(datadir: &str, config: ffi::CreateOpts) -> anyhow::Result<()> {
@@ -542,14 +1366,18 @@ pub(crate) fn load_wallet(datadir: &str, config: ffi::CreateOpts) -> anyhow::Res
 
     let create_opts = utils::ffi_config_to_config(config)?;
 
+    let storage = create_opts.config.storage.clone();
     let (config, _) = utils::merge_config_opts(create_opts)?;
 
-    crate::TOKIO_RUNTIME.block_on(crate::load_wallet(Path::new(datadir), mnemonic, config))
+    crate::metrics::block_on(
+        "load_wallet",
+        crate::load_wallet(Path::new(datadir), mnemonic, config, storage),
+    )
 }
 
 pub(crate) fn board_amount(amount_sat: u64) -> anyhow::Result<ffi::BoardResult> {
     let amount = bark::ark::bitcoin::Amount::from_sat(amount_sat);
-    let board_result = crate::TOKIO_RUNTIME.block_on(crate::board_amount(amount))?;
+    let board_result = crate::metrics::block_on("board_amount", crate::board_amount(amount))?;
 
     Ok(ffi::BoardResult {
         vtxos: board_result
@@ -561,8 +1389,11 @@ pub(crate) fn board_amount(amount_sat: u64) -> anyhow::Result<ffi::BoardResult>
     })
 }
 
-pub(crate) fn board_all() -> anyhow::Result<ffi::BoardResult> {
-    let board_result = crate::TOKIO_RUNTIME.block_on(crate::board_all())?;
+pub(crate) fn board_all(limits: ffi::CallLimits) -> anyhow::Result<ffi::BoardResult> {
+    let board_result = crate::metrics::block_on(
+        "board_all",
+        cancel::run("board_all", call_limits(limits), crate::board_all()),
+    )?;
 
     Ok(ffi::BoardResult {
         vtxos: board_result
@@ -574,10 +1405,36 @@ pub(crate) fn board_all() -> anyhow::Result<ffi::BoardResult> {
     })
 }
 
+pub(crate) fn parse_destination(
+    destination: &str,
+    resolve: bool,
+) -> anyhow::Result<ffi::ParsedDestination> {
+    let parsed = destination::parse(destination)?;
+    let lnurl = match &parsed.parsed {
+        destination::Parsed::LightningAddress(address) if resolve => {
+            crate::metrics::block_on("parse_destination", destination::resolve(address))?
+        }
+        _ => destination::Lnurl::default(),
+    };
+    Ok(ffi::ParsedDestination {
+        kind: parsed.kind.as_str().to_string(),
+        amount_msat: parsed.amount_msat.unwrap_or(0),
+        expires_at: parsed.expires_at.unwrap_or(0),
+        expired: parsed.is_expired(),
+        lnurl_min_sendable_msat: lnurl.min_sendable_msat,
+        lnurl_max_sendable_msat: lnurl.max_sendable_msat,
+        lnurl_comment_allowed: lnurl.comment_allowed,
+        lnurl_description: lnurl.description,
+    })
+}
+
 pub(crate) fn validate_arkoor_address(address: &str) -> anyhow::Result<()> {
-    let address = bark::ark::Address::from_str(address)
+    let address = destination::ark_address(address)
         .with_context(|| format!("Invalid address format: '{}'", address))?;
-    crate::TOKIO_RUNTIME.block_on(crate::validate_arkoor_address(address))
+    crate::metrics::block_on(
+        "validate_arkoor_address",
+        crate::validate_arkoor_address(address),
+    )
 }
 
 pub(crate) fn send_arkoor_payment(
@@ -585,17 +1442,73 @@ pub(crate) fn send_arkoor_payment(
     amount_sat: u64,
 ) -> anyhow::Result<ArkoorPaymentResult> {
     let amount = bark::ark::bitcoin::Amount::from_sat(amount_sat);
-    let dest = bark::ark::Address::from_str(destination)
+    let dest = destination::ark_address(destination)
         .with_context(|| format!("Invalid destination address format: '{}'", destination))?;
-    let oor_result = crate::TOKIO_RUNTIME.block_on(crate::send_arkoor_payment(dest, amount))?;
+    let oor_result = crate::metrics::block_on(
+        "send_arkoor_payment",
+        crate::send_arkoor_payment(dest, amount),
+    )?;
 
     Ok(ArkoorPaymentResult {
-        vtxos: oor_result.iter().map(utils::vtxo_to_bark_vtxo).collect(),
+        vtxos: utils::vtxos_to_bark_vtxos(&oor_result),
         destination_pubkey: destination.to_string(),
         amount_sat,
     })
 }
 
+pub(crate) fn send_arkoor_many(
+    outputs: Vec<ffi::SendManyOutput>,
+) -> anyhow::Result<Vec<ffi::ArkoorBatchResult>> {
+    let destinations = outputs
+        .iter()
+        .map(|output| {
+            let dest = destination::ark_address(&output.destination).with_context(|| {
+                format!(
+                    "Invalid destination address format: '{}'",
+                    output.destination
+                )
+            })?;
+            Ok((
+                dest,
+                bark::ark::bitcoin::Amount::from_sat(output.amount_sat),
+            ))
+        })
+        .collect::<anyhow::Result<Vec<_>>>()?;
+
+    let results =
+        crate::metrics::block_on("send_arkoor_many", crate::send_arkoor_many(destinations))?;
+
+    Ok(outputs
+        .into_iter()
+        .zip(results)
+        .map(|(output, result)| {
+            let (vtxos, error) = result.map_or_else(
+                |e| (Vec::new(), format!("{:#}", e)),
+                |vtxos| (utils::vtxos_to_bark_vtxos(&vtxos), String::new()),
+            );
+            ffi::ArkoorBatchResult {
+                destination: output.destination,
+                amount_sat: output.amount_sat,
+                vtxos,
+                error,
+            }
+        })
+        .collect())
+}
+
+fn lightning_send_to_ffi(send: bark::persist::models::LightningSend) -> ffi::LightningSend {
+    ffi::LightningSend {
+        htlc_vtxos: utils::wallet_vtxos_to_bark_vtxos(send.htlc_vtxos),
+        amount: send.amount.to_sat(),
+        invoice: send.invoice.to_string(),
+        payment_hash: send.invoice.payment_hash().to_string(),
+        movement_id: send.movement_id.0,
+        preimage: send
+            .preimage
+            .map_or(String::new(), |p| p.to_lower_hex_string()),
+    }
+}
+
 pub(crate) fn pay_lightning_invoice(
     destination: &str,
     amount_sat: *const u64,
@@ -603,25 +1516,60 @@ pub(crate) fn pay_lightning_invoice(
     let amount_opt =
         unsafe { amount_sat.as_ref().map(|r| *r) }.map(bark::ark::bitcoin::Amount::from_sat);
 
-    let invoice = lightning::Invoice::from_str(destination)?;
+    let invoice = destination::invoice(destination)?;
 
-    let send_result =
-        crate::TOKIO_RUNTIME.block_on(crate::pay_lightning_invoice(invoice, amount_opt))?;
+    let send_result = crate::metrics::block_on(
+        "pay_lightning_invoice",
+        crate::pay_lightning_invoice(invoice, amount_opt),
+    )?;
 
-    Ok(ffi::LightningSend {
-        htlc_vtxos: send_result
-            .htlc_vtxos
-            .into_iter()
-            .map(utils::wallet_vtxo_to_bark_vtxo)
-            .collect(),
-        amount: send_result.amount.to_sat(),
-        invoice: send_result.invoice.to_string(),
-        payment_hash: send_result.invoice.payment_hash().to_string(),
-        movement_id: send_result.movement_id.0,
-        preimage: send_result
-            .preimage
-            .map_or(String::new(), |p| p.to_lower_hex_string()),
-    })
+    Ok(lightning_send_to_ffi(send_result))
+}
+
+pub(crate) fn pay_lightning_invoices(
+    payments: Vec<ffi::LightningInvoicePayment>,
+) -> anyhow::Result<Vec<ffi::LightningBatchResult>> {
+    let invoices = payments
+        .iter()
+        .map(|payment| {
+            let invoice = destination::invoice(&payment.invoice)
+                .with_context(|| format!("Invalid invoice: '{}'", payment.invoice))?;
+            let amount = (payment.amount_sat > 0)
+                .then_some(bark::ark::bitcoin::Amount::from_sat(payment.amount_sat));
+            Ok((invoice, amount))
+        })
+        .collect::<anyhow::Result<Vec<_>>>()?;
+
+    let results = crate::metrics::block_on(
+        "pay_lightning_invoices",
+        crate::pay_lightning_invoices(invoices),
+    )?;
+
+    Ok(payments
+        .into_iter()
+        .zip(results)
+        .map(|(payment, result)| {
+            let (send, error) = result.map_or_else(
+                |e| {
+                    let empty = ffi::LightningSend {
+                        invoice: String::new(),
+                        payment_hash: String::new(),
+                        amount: 0,
+                        htlc_vtxos: Vec::new(),
+                        movement_id: 0,
+                        preimage: String::new(),
+                    };
+                    (empty, format!("{:#}", e))
+                },
+                |send| (lightning_send_to_ffi(send), String::new()),
+            );
+            ffi::LightningBatchResult {
+                invoice: payment.invoice,
+                payment: send,
+                error,
+            }
+        })
+        .collect())
 }
 
 pub(crate) fn pay_lightning_offer(
@@ -631,26 +1579,14 @@ pub(crate) fn pay_lightning_offer(
     let amount_opt =
         unsafe { amount_sat.as_ref().map(|r| *r) }.map(bark::ark::bitcoin::Amount::from_sat);
 
-    let offer = lightning::Offer::from_str(offer)
-        .map_err(|err| anyhow::anyhow!("Failed to parse bolt12 offer: {:?}", err))?;
+    let offer = destination::offer(offer).context("Failed to parse bolt12 offer")?;
 
-    let send_result =
-        crate::TOKIO_RUNTIME.block_on(crate::pay_lightning_offer(offer.clone(), amount_opt))?;
+    let send_result = crate::metrics::block_on(
+        "pay_lightning_offer",
+        crate::pay_lightning_offer(offer.clone(), amount_opt),
+    )?;
 
-    Ok(ffi::LightningSend {
-        htlc_vtxos: send_result
-            .htlc_vtxos
-            .into_iter()
-            .map(utils::wallet_vtxo_to_bark_vtxo)
-            .collect(),
-        amount: send_result.amount.to_sat(),
-        invoice: send_result.invoice.to_string(),
-        payment_hash: send_result.invoice.payment_hash().to_string(),
-        movement_id: send_result.movement_id.0,
-        preimage: send_result
-            .preimage
-            .map_or(String::new(), |p| p.to_lower_hex_string()),
-    })
+    Ok(lightning_send_to_ffi(send_result))
 }
 
 pub(crate) fn pay_lightning_address(
@@ -659,36 +1595,27 @@ pub(crate) fn pay_lightning_address(
     comment: &str,
 ) -> anyhow::Result<ffi::LightningSend> {
     let amount = bark::ark::bitcoin::Amount::from_sat(amount_sat);
+    let addr = destination::lightning_address(addr)
+        .with_context(|| format!("Invalid Lightning Address format: '{}'", addr))?;
     let comment_opt = if comment.is_empty() {
         None
     } else {
         Some(comment)
     };
-    let send_result =
-        crate::TOKIO_RUNTIME.block_on(crate::pay_lightning_address(addr, amount, comment_opt))?;
+    let send_result = crate::metrics::block_on(
+        "pay_lightning_address",
+        crate::pay_lightning_address(addr, amount, comment_opt),
+    )?;
 
-    Ok(ffi::LightningSend {
-        htlc_vtxos: send_result
-            .htlc_vtxos
-            .into_iter()
-            .map(utils::wallet_vtxo_to_bark_vtxo)
-            .collect(),
-        amount: send_result.amount.to_sat(),
-        invoice: send_result.invoice.to_string(),
-        payment_hash: send_result.invoice.payment_hash().to_string(),
-        movement_id: send_result.movement_id.0,
-        preimage: send_result
-            .preimage
-            .map_or(String::new(), |p| p.to_lower_hex_string()),
-    })
+    Ok(lightning_send_to_ffi(send_result))
 }
 
 pub(crate) fn send_onchain(destination: &str, amount_sat: u64) -> anyhow::Result<String> {
     let amount = bark::ark::bitcoin::Amount::from_sat(amount_sat);
-    let address_unchecked = bitcoin::Address::from_str(destination)
+    let address_unchecked = destination::onchain_address(destination)
         .with_context(|| format!("Invalid destination address format: '{}'", destination))?;
 
-    let ark_info = crate::TOKIO_RUNTIME.block_on(crate::get_ark_info())?;
+    let ark_info = crate::metrics::block_on("get_ark_info", crate::get_ark_info())?;
 
     // Now require the network to match the wallet's network
     let destination_address = address_unchecked
@@ -700,7 +1627,10 @@ pub(crate) fn send_onchain(destination: &str, amount_sat: u64) -> anyhow::Result
             )
         })?;
 
-    let result = crate::TOKIO_RUNTIME.block_on(crate::send_onchain(destination_address, amount))?;
+    let result = crate::metrics::block_on(
+        "send_onchain",
+        crate::send_onchain(destination_address, amount),
+    )?;
 
     Ok(result.to_string())
 }
@@ -714,10 +1644,10 @@ pub(crate) fn offboard_specific(
         .map(|s| bark::ark::VtxoId::from_str(&s))
         .collect::<Result<Vec<_>, _>>()?;
 
-    let ark_info = crate::TOKIO_RUNTIME.block_on(crate::get_ark_info())?;
+    let ark_info = crate::metrics::block_on("get_ark_info", crate::get_ark_info())?;
 
     let destination_address_opt =
-        Address::<address::NetworkUnchecked>::from_str(destination_address).with_context(|| {
+        destination::onchain_address(destination_address).with_context(|| {
             format!(
                 "Invalid destination address format: '{}'",
                 destination_address
@@ -743,16 +1673,19 @@ pub(crate) fn offboard_specific(
     );
 
     let offboard_specific_result =
-        crate::TOKIO_RUNTIME.block_on(crate::offboard_specific(ids, addr))?;
+        crate::metrics::block_on("offboard_specific", crate::offboard_specific(ids, addr))?;
 
     Ok(offboard_specific_result.encode_hex())
 }
 
-pub(crate) fn offboard_all(destination_address: &str) -> anyhow::Result<String> {
-    let ark_info = crate::TOKIO_RUNTIME.block_on(crate::get_ark_info())?;
+pub(crate) fn offboard_all(
+    destination_address: &str,
+    limits: ffi::CallLimits,
+) -> anyhow::Result<String> {
+    let ark_info = crate::metrics::block_on("get_ark_info", crate::get_ark_info())?;
 
     let destination_address_opt =
-        Address::<address::NetworkUnchecked>::from_str(destination_address).with_context(|| {
+        destination::onchain_address(destination_address).with_context(|| {
             format!(
                 "Invalid destination address format: '{}'",
                 destination_address
@@ -769,7 +1702,14 @@ pub(crate) fn offboard_all(destination_address: &str) -> anyhow::Result<String>
 
     info!("Attempting to offboard all VTXOs to {:?}", addr);
 
-    let offboard_all_result = crate::TOKIO_RUNTIME.block_on(crate::offboard_all(addr))?;
+    let offboard_all_result = crate::metrics::block_on(
+        "offboard_all",
+        cancel::run(
+            "offboard_all",
+            call_limits(limits),
+            crate::offboard_all(addr),
+        ),
+    )?;
 
     Ok(offboard_all_result.encode_hex())
 }
@@ -782,74 +1722,136 @@ pub(crate) fn try_claim_lightning_receive(
     let payment_hash = PaymentHash::from_str(&payment_hash)?;
     let token_opt = unsafe { token.as_ref().map(|s| s.clone()) };
 
-    let status = TOKIO_RUNTIME.block_on(crate::try_claim_lightning_receive(
-        payment_hash,
-        wait,
-        token_opt,
-    ))?;
-
-    Ok(ffi::LightningReceive {
-        payment_hash: status.payment_hash.to_string(),
-        payment_preimage: status.payment_preimage.to_string(),
-        invoice: status.invoice.to_string(),
-        preimage_revealed_at: status.preimage_revealed_at.map_or(std::ptr::null(), |v| {
-            Box::into_raw(Box::new(v.timestamp() as u64))
-        }),
-        finished_at: status.finished_at.map_or(std::ptr::null(), |v| {
-            Box::into_raw(Box::new(v.timestamp() as u64))
-        }),
-    })
+    let status = crate::metrics::block_on(
+        "try_claim_lightning_receive",
+        crate::try_claim_lightning_receive(payment_hash, wait, token_opt),
+    )?;
+
+    Ok(crate::utils::lightning_receive_to_ffi(&status))
 }
 
 pub(crate) fn try_claim_all_lightning_receives(wait: bool) -> anyhow::Result<()> {
-    crate::TOKIO_RUNTIME.block_on(crate::try_claim_all_lightning_receives(wait))?;
+    crate::metrics::block_on(
+        "try_claim_all_lightning_receives",
+        crate::try_claim_all_lightning_receives(wait),
+    )?;
     Ok(())
 }
 
 pub(crate) fn check_lightning_payment(payment_hash: String, wait: bool) -> anyhow::Result<String> {
     let payment_hash = PaymentHash::from_str(&payment_hash)?;
-    let result =
-        crate::TOKIO_RUNTIME.block_on(crate::check_lightning_payment(payment_hash, wait))?;
+    let result = crate::metrics::block_on(
+        "check_lightning_payment",
+        crate::check_lightning_payment(payment_hash, wait),
+    )?;
     Ok(result.map_or(String::new(), |p| p.to_lower_hex_string()))
 }
 
-pub(crate) fn sync_exits() -> anyhow::Result<()> {
-    TOKIO_RUNTIME.block_on(crate::sync_exits())
+pub(crate) fn start_check_lightning_payment(payment_hash: String) -> anyhow::Result<u64> {
+    let payment_hash = PaymentHash::from_str(&payment_hash)?;
+    let wallet_key =
+        crate::metrics::block_on("start_check_lightning_payment", crate::active_wallet_key())
+            .context("Wallet not loaded")?;
+    Ok(crate::lightning_wait::start_check_payment(
+        wallet_key,
+        payment_hash,
+    ))
+}
+
+pub(crate) fn start_try_claim_lightning_receive(
+    payment_hash: String,
+    token: *const String,
+) -> anyhow::Result<u64> {
+    let payment_hash = PaymentHash::from_str(&payment_hash)?;
+    let token_opt = unsafe { token.as_ref().map(|s| s.clone()) };
+    let wallet_key = crate::metrics::block_on(
+        "start_try_claim_lightning_receive",
+        crate::active_wallet_key(),
+    )
+    .context("Wallet not loaded")?;
+    Ok(crate::lightning_wait::start_claim_receive(
+        wallet_key,
+        payment_hash,
+        token_opt,
+    ))
+}
+
+pub(crate) fn cancel_lightning_wait(payment_hash: &str) -> u32 {
+    crate::lightning_wait::cancel(payment_hash)
+}
+
+pub(crate) fn wait_for_lightning_completions(timeout_ms: u32) -> Vec<ffi::LightningWaitResult> {
+    crate::lightning_wait::wait_for_completions(std::time::Duration::from_millis(timeout_ms.into()))
+}
+
+pub(crate) fn sync_exits(limits: ffi::CallLimits) -> anyhow::Result<()> {
+    crate::metrics::block_on(
+        "sync_exits",
+        cancel::run("sync_exits", call_limits(limits), crate::sync_exits()),
+    )
 }
 
 pub(crate) fn sync_pending_rounds() -> anyhow::Result<()> {
-    TOKIO_RUNTIME.block_on(crate::sync_pending_rounds())
+    crate::metrics::block_on("sync_pending_rounds", crate::sync_pending_rounds())
 }
 
 // Onchain methods
 
+pub(crate) fn set_wallet_events_enabled(enabled: bool) {
+    crate::events::set_enabled(enabled)
+}
+
+pub(crate) fn wait_for_wallet_events(
+    timeout_ms: u32,
+    batch_window_ms: u32,
+) -> Vec<ffi::WalletEvent> {
+    crate::events::wait_for_events(
+        std::time::Duration::from_millis(timeout_ms.into()),
+        std::time::Duration::from_millis(batch_window_ms.into()),
+    )
+}
+
 pub(crate) fn onchain_list_unspent() -> anyhow::Result<String> {
-    let unspent = TOKIO_RUNTIME.block_on(crate::onchain::list_unspent())?;
-    serde_json::to_string(&unspent).map_err(Into::into)
+    let unspent = crate::metrics::block_on("onchain_list_unspent", crate::onchain::list_unspent())?;
+    serde_json::to_string(&*unspent).map_err(Into::into)
 }
 
 pub(crate) fn onchain_sync() -> anyhow::Result<()> {
-    crate::TOKIO_RUNTIME.block_on(crate::onchain::sync())?;
+    crate::metrics::block_on("onchain_sync", crate::onchain::sync())?;
     Ok(())
 }
 
+pub(crate) fn onchain_sync_incremental(force: bool) -> anyhow::Result<ffi::OnchainSyncReport> {
+    let report = crate::metrics::block_on(
+        "onchain_sync_incremental",
+        crate::onchain::sync_incremental(force),
+    )?;
+    Ok(ffi::OnchainSyncReport {
+        skipped: report.skipped,
+        from_height: report.from_height,
+        tip_height: report.tip_height,
+        duration_ms: report.duration.as_millis() as u64,
+    })
+}
+
 pub(crate) fn onchain_address() -> anyhow::Result<String> {
-    let address = crate::TOKIO_RUNTIME.block_on(crate::onchain::address())?;
+    let address = crate::metrics::block_on("onchain_address", crate::onchain::address())?;
     Ok(address.to_string())
 }
 
 pub(crate) fn onchain_balance() -> anyhow::Result<ffi::OnChainBalance> {
-    let balance = crate::TOKIO_RUNTIME.block_on(crate::onchain::onchain_balance())?;
-    Ok(ffi::OnChainBalance {
-        immature: balance.immature.to_sat(),
-        trusted_pending: balance.trusted_pending.to_sat(),
-        untrusted_pending: balance.untrusted_pending.to_sat(),
-        confirmed: balance.confirmed.to_sat(),
-    })
+    if let Some(balance) = snapshot::read(|s| s.onchain_balance.clone()) {
+        return Ok(balance);
+    }
+    let generation = snapshot::generation();
+    let balance = crate::metrics::block_on("onchain_balance", crate::onchain::onchain_balance())?;
+    let balance = onchain_balance_to_ffi(&balance);
+    snapshot::store(generation, |s| s.onchain_balance = Some(balance.clone()));
+    Ok(balance)
 }
 
 pub(crate) fn onchain_utxos() -> anyhow::Result<String> {
-    let utxos = crate::TOKIO_RUNTIME.block_on(async { crate::onchain::utxos().await })?;
+    let utxos = crate::metrics::block_on("onchain_utxos", async { crate::onchain::utxos().await })?;
 
     let res = utxos
         .iter()
@@ -869,6 +1871,29 @@ pub(crate) fn onchain_utxos() -> anyhow::Result<String> {
     serde_json::to_string(&res).map_err(Into::into)
 }
 
+pub(crate) fn onchain_unspent_outputs(
+    filter: ffi::OnchainUtxoFilter,
+) -> anyhow::Result<Vec<ffi::OnchainUtxo>> {
+    let unspent =
+        crate::metrics::block_on("onchain_unspent_outputs", crate::onchain::list_unspent())?;
+    Ok(unspent
+        .iter()
+        .map(utils::local_output_to_ffi)
+        .filter(|utxo| utils::onchain_utxo_matches(&filter, utxo))
+        .collect())
+}
+
+pub(crate) fn onchain_utxo_list(
+    filter: ffi::OnchainUtxoFilter,
+) -> anyhow::Result<Vec<ffi::OnchainUtxo>> {
+    let utxos = crate::metrics::block_on("onchain_utxo_list", crate::onchain::utxos())?;
+    Ok(utxos
+        .iter()
+        .map(utils::utxo_to_ffi)
+        .filter(|utxo| utils::onchain_utxo_matches(&filter, utxo))
+        .collect())
+}
+
 pub(crate) fn onchain_send(
     destination: &str,
     amount_sat: u64,
@@ -876,33 +1901,35 @@ pub(crate) fn onchain_send(
 ) -> anyhow::Result<OnchainPaymentResult> {
     let amount = bark::ark::bitcoin::Amount::from_sat(amount_sat);
 
-    let ark_info = crate::TOKIO_RUNTIME.block_on(crate::get_ark_info())?;
-
-    // Validate optional address string
-    let address_unchecked = Address::<address::NetworkUnchecked>::from_str(destination)
-        .with_context(|| format!("invalid destination address format: '{}'", destination))?;
-
-    // Now require the network to match the wallet's network
-    let destination_address = address_unchecked
-        .require_network(ark_info.network)
-        .with_context(|| {
-            format!(
-                "address '{}' is not valid for configured network {}",
-                destination, ark_info.network
-            )
-        })?;
+    let (txid, destination_address) = crate::metrics::block_on("onchain_send", async {
+        // The checks and the spend use the same wallet, also when another
+        // one is selected in between
+        let active = crate::active_wallet().await;
+        let (address, fee_rate) = active
+            .with_context_ref_async(|ctx| async {
+                let net = ctx.wallet.properties().await?.network;
+                let address = destination::onchain_address(destination)
+                    .with_context(|| {
+                        format!("invalid destination address format: '{}'", destination)
+                    })?
+                    .require_network(net)
+                    .with_context(|| {
+                        format!(
+                            "address '{}' is not valid for configured network {}",
+                            destination, net
+                        )
+                    })?;
+                let fee_rate = if fee_rate.is_null() {
+                    ctx.wallet.chain.fee_rates().await.regular
+                } else {
+                    FeeRate::from_sat_per_vb(unsafe { *fee_rate }).context("Invalid fee rate")?
+                };
+                Ok((address, fee_rate))
+            })
+            .await?;
 
-    let txid = crate::TOKIO_RUNTIME.block_on(async {
-        let fee_rate = if fee_rate.is_null() {
-            let mut manager = crate::GLOBAL_WALLET_MANAGER.lock().await;
-            manager
-                .with_context_async(|ctx| async { Ok(ctx.wallet.chain.fee_rates().await.regular) })
-                .await?
-        } else {
-            FeeRate::from_sat_per_vb(unsafe { *fee_rate }).context("Invalid fee rate")?
-        };
-
-        crate::onchain::send(destination_address.clone(), amount, fee_rate).await
+        let txid = crate::onchain::send(&active, address.clone(), amount, fee_rate).await?;
+        Ok((txid, address))
     })?;
 
     Ok(OnchainPaymentResult {
@@ -913,12 +1940,15 @@ pub(crate) fn onchain_send(
 }
 
 pub(crate) fn onchain_drain(destination: &str, fee_rate: *const u64) -> anyhow::Result<String> {
-    let txid = crate::TOKIO_RUNTIME.block_on(async {
-        let mut manager = crate::GLOBAL_WALLET_MANAGER.lock().await;
-        let (address, fee_rate) = manager
-            .with_context_async(|ctx| async {
+    let txid = crate::metrics::block_on("onchain_drain", async {
+        // Resolve the inputs under a shared guard that is released before
+        // the spend takes the onchain wallet exclusively. Both use the same
+        // wallet, also when another one is selected in between.
+        let active = crate::active_wallet().await;
+        let (address, fee_rate) = active
+            .with_context_ref_async(|ctx| async {
                 let net = ctx.wallet.properties().await?.network;
-                let address = Address::from_str(destination)?
+                let address = destination::onchain_address(destination)?
                     .require_network(net)
                     .context("Address on wrong network")?;
                 let fee_rate = if fee_rate.is_null() {
@@ -930,7 +1960,7 @@ pub(crate) fn onchain_drain(destination: &str, fee_rate: *const u64) -> anyhow::
             })
             .await?;
 
-        crate::onchain::drain(address, fee_rate).await
+        crate::onchain::drain(&active, address, fee_rate).await
     })?;
     Ok(txid.to_string())
 }
@@ -939,14 +1969,14 @@ pub(crate) fn onchain_send_many(
     outputs: Vec<ffi::SendManyOutput>,
     fee_rate: *const u64,
 ) -> anyhow::Result<String> {
-    let txid = crate::TOKIO_RUNTIME.block_on(async {
-        let mut manager = crate::GLOBAL_WALLET_MANAGER.lock().await;
-        let (destinations, fee_rate) = manager
-            .with_context_async(|ctx| async {
+    let txid = crate::metrics::block_on("onchain_send_many", async {
+        let active = crate::active_wallet().await;
+        let (destinations, fee_rate) = active
+            .with_context_ref_async(|ctx| async {
                 let mut destinations = Vec::new();
                 let net = ctx.wallet.properties().await?.network;
                 for output in outputs {
-                    let address = Address::from_str(&output.destination)
+                    let address = destination::onchain_address(&output.destination)
                         .context("Invalid address format")?
                         .require_network(net)
                         .context("Address on wrong network")?;
@@ -963,7 +1993,7 @@ pub(crate) fn onchain_send_many(
             })
             .await?;
 
-        crate::onchain::send_many(&destinations, fee_rate).await
+        crate::onchain::send_many(&active, &destinations, fee_rate).await
     })?;
     Ok(txid.to_string())
 }
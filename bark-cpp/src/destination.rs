@@ -0,0 +1,301 @@
+//! Parsed payment destinations, cached by their string.
+//!
+//! A send screen validates the destination on every keystroke and the send
+//! call parses it once more, trying each format in turn. `parse` recognises
+//! the format once and keeps the typed value, so validation and the send
+//! calls that take the same string reuse it instead of parsing again.
+//!
+//! Lightning addresses are resolved over LNURL to learn the amounts they
+//! accept. The resolved metadata is kept for `LNURL_TTL`, so a UI that
+//! re-validates the address while the amount is typed doesn't request it
+//! again for every change. Like parsed destinations, at most `CAPACITY`
+//! addresses are kept.
+
+use std::collections::{HashMap, VecDeque};
+use std::str::FromStr;
+use std::sync::{Arc, LazyLock, Mutex, MutexGuard};
+use std::time::{Duration, Instant, SystemTime, UNIX_EPOCH};
+
+use anyhow::{Context, bail};
+use bark::ark::bitcoin::Address;
+use bark::ark::bitcoin::address::NetworkUnchecked;
+use bark::ark::lightning;
+use bark::lnurllib::lightning_address::LightningAddress;
+use bark::lnurllib::{Builder, LnUrlResponse};
+use logger::log::debug;
+
+/// Parsed destinations and resolved addresses kept, the oldest is dropped
+/// beyond this
+const CAPACITY: usize = 64;
+
+/// How long resolved LNURL metadata is reused
+pub(crate) const LNURL_TTL: Duration = Duration::from_secs(600);
+
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub(crate) enum Kind {
+    Ark,
+    Bolt11,
+    Bolt12Invoice,
+    Bolt12Offer,
+    LightningAddress,
+    Onchain,
+}
+
+impl Kind {
+    pub(crate) fn as_str(self) -> &'static str {
+        match self {
+            Kind::Ark => "ark",
+            Kind::Bolt11 => "bolt11",
+            Kind::Bolt12Invoice => "bolt12_invoice",
+            Kind::Bolt12Offer => "bolt12_offer",
+            Kind::LightningAddress => "lightning_address",
+            Kind::Onchain => "onchain",
+        }
+    }
+}
+
+pub(crate) enum Parsed {
+    Ark(bark::ark::Address),
+    Invoice(lightning::Invoice),
+    Offer(lightning::Offer),
+    LightningAddress(LightningAddress),
+    // The network is checked against the wallet's when sending
+    Onchain(Address<NetworkUnchecked>),
+}
+
+pub(crate) struct Destination {
+    pub parsed: Parsed,
+    pub kind: Kind,
+    /// Amount requested by an invoice or offer
+    pub amount_msat: Option<u64>,
+    /// Unix time after which an invoice or offer can't be paid
+    pub expires_at: Option<u64>,
+}
+
+impl Destination {
+    pub(crate) fn is_expired(&self) -> bool {
+        expired(self.expires_at)
+    }
+}
+
+/// Whether a unix expiry time has passed, an unset one never does
+pub(crate) fn expired(expires_at: Option<u64>) -> bool {
+    let now = SystemTime::now()
+        .duration_since(UNIX_EPOCH)
+        .unwrap_or_default()
+        .as_secs();
+    expires_at.is_some_and(|at| at <= now)
+}
+
+/// What a lightning address accepts, from its LNURL pay response
+#[derive(Clone, Debug, Default, PartialEq, Eq)]
+pub(crate) struct Lnurl {
+    pub min_sendable_msat: u64,
+    pub max_sendable_msat: u64,
+    /// Longest comment the payee accepts, 0 when it takes none
+    pub comment_allowed: u32,
+    pub description: String,
+}
+
+#[derive(Default)]
+struct Cache {
+    parsed: HashMap<String, Arc<Destination>>,
+    // Insertion order, for dropping the oldest entry
+    order: VecDeque<String>,
+    lnurl: HashMap<String, (Lnurl, Instant)>,
+}
+
+static CACHE: LazyLock<Mutex<Cache>> = LazyLock::new(|| Mutex::new(Cache::default()));
+
+fn cache() -> MutexGuard<'static, Cache> {
+    CACHE.lock().unwrap_or_else(|e| e.into_inner())
+}
+
+fn strip_uri_scheme(input: &str) -> &str {
+    let input = input.trim();
+    match input.split_once(':') {
+        Some((scheme, rest)) if scheme.eq_ignore_ascii_case("lightning") => rest,
+        _ => input,
+    }
+}
+
+fn parse_uncached(input: &str) -> anyhow::Result<Destination> {
+    let s = strip_uri_scheme(input);
+    let destination = |parsed, kind| Destination {
+        parsed,
+        kind,
+        amount_msat: None,
+        expires_at: None,
+    };
+
+    if let Ok(address) = bark::ark::Address::from_str(s) {
+        return Ok(destination(Parsed::Ark(address), Kind::Ark));
+    }
+    if let Ok(invoice) = lightning::Invoice::from_str(s) {
+        let kind = match &invoice {
+            lightning::Invoice::Bolt11(_) => Kind::Bolt11,
+            lightning::Invoice::Bolt12(_) => Kind::Bolt12Invoice,
+        };
+        let (amount_msat, expires_at) = invoice_terms(&invoice);
+        return Ok(Destination {
+            amount_msat,
+            expires_at,
+            ..destination(Parsed::Invoice(invoice), kind)
+        });
+    }
+    if let Ok(offer) = lightning::Offer::from_str(s) {
+        let expires_at = offer.absolute_expiry().map(|at| at.as_secs());
+        return Ok(Destination {
+            expires_at,
+            ..destination(Parsed::Offer(offer), Kind::Bolt12Offer)
+        });
+    }
+    if s.contains('@') {
+        if let Ok(address) = LightningAddress::from_str(s) {
+            return Ok(destination(
+                Parsed::LightningAddress(address),
+                Kind::LightningAddress,
+            ));
+        }
+    }
+    if let Ok(address) = Address::from_str(s) {
+        return Ok(destination(Parsed::Onchain(address), Kind::Onchain));
+    }
+    bail!(
+        "'{}' is not an Ark address, lightning invoice, bolt12 offer, lightning address or bitcoin address",
+        input
+    )
+}
+
+/// Parses `input`, or returns the destination parsed from the same string
+/// before
+pub(crate) fn parse(input: &str) -> anyhow::Result<Arc<Destination>> {
+    if let Some(destination) = cache().parsed.get(input) {
+        return Ok(destination.clone());
+    }
+
+    let destination = Arc::new(parse_uncached(input)?);
+    let mut cache = cache();
+    if cache
+        .parsed
+        .insert(input.to_string(), destination.clone())
+        .is_none()
+    {
+        cache.order.push_back(input.to_string());
+    }
+    while cache.order.len() > CAPACITY {
+        if let Some(oldest) = cache.order.pop_front() {
+            cache.parsed.remove(&oldest);
+        }
+    }
+    Ok(destination)
+}
+
+/// Amount an invoice requests and the unix time it expires at
+pub(crate) fn invoice_terms(invoice: &lightning::Invoice) -> (Option<u64>, Option<u64>) {
+    match invoice {
+        lightning::Invoice::Bolt11(bolt11) => (
+            bolt11.amount_milli_satoshis(),
+            bolt11.expires_at().map(|at| at.as_secs()),
+        ),
+        // Bolt12 invoices always carry an amount and an expiry
+        lightning::Invoice::Bolt12(bolt12) => (
+            Some(bolt12.amount_msats()),
+            Some((bolt12.created_at() + bolt12.relative_expiry()).as_secs()),
+        ),
+    }
+}
+
+pub(crate) fn ark_address(input: &str) -> anyhow::Result<bark::ark::Address> {
+    match &parse(input)?.parsed {
+        Parsed::Ark(address) => Ok(address.clone()),
+        _ => bail!("'{}' is not an Ark address", input),
+    }
+}
+
+pub(crate) fn invoice(input: &str) -> anyhow::Result<lightning::Invoice> {
+    match &parse(input)?.parsed {
+        Parsed::Invoice(invoice) => Ok(invoice.clone()),
+        _ => bail!("'{}' is not a lightning invoice", input),
+    }
+}
+
+pub(crate) fn offer(input: &str) -> anyhow::Result<lightning::Offer> {
+    match &parse(input)?.parsed {
+        Parsed::Offer(offer) => Ok(offer.clone()),
+        _ => bail!("'{}' is not a bolt12 offer", input),
+    }
+}
+
+pub(crate) fn lightning_address(input: &str) -> anyhow::Result<LightningAddress> {
+    match &parse(input)?.parsed {
+        Parsed::LightningAddress(address) => Ok(address.clone()),
+        _ => bail!("'{}' is not a lightning address", input),
+    }
+}
+
+pub(crate) fn onchain_address(input: &str) -> anyhow::Result<Address<NetworkUnchecked>> {
+    match &parse(input)?.parsed {
+        Parsed::Onchain(address) => Ok(address.clone()),
+        _ => bail!("'{}' is not a bitcoin address", input),
+    }
+}
+
+/// Text of the `text/plain` entry of LNURL metadata
+pub(crate) fn lnurl_description(metadata: &str) -> String {
+    serde_json::from_str::<Vec<(String, serde_json::Value)>>(metadata)
+        .ok()
+        .and_then(|entries| {
+            entries
+                .into_iter()
+                .find(|(mime, _)| mime == "text/plain")
+                .and_then(|(_, text)| text.as_str().map(str::to_string))
+        })
+        .unwrap_or_default()
+}
+
+/// LNURL metadata of a lightning address, requested when the cached one is
+/// missing or older than `LNURL_TTL`
+pub(crate) async fn resolve(address: &LightningAddress) -> anyhow::Result<Lnurl> {
+    let key = address.to_string();
+    if let Some((lnurl, fetched)) = cache().lnurl.get(&key) {
+        if fetched.elapsed() < LNURL_TTL {
+            return Ok(lnurl.clone());
+        }
+    }
+
+    debug!("Resolving lightning address {}", key);
+    let client = Builder::default()
+        .build_async()
+        .context("Failed to create the LNURL client")?;
+    let response = client
+        .make_request(&address.lnurlp_url())
+        .await
+        .with_context(|| format!("Failed to resolve lightning address {}", key))?;
+    let pay = match response {
+        LnUrlResponse::LnUrlPayResponse(pay) => pay,
+        _ => bail!("Lightning address {} doesn't accept payments", key),
+    };
+    let lnurl = Lnurl {
+        min_sendable_msat: pay.min_sendable,
+        max_sendable_msat: pay.max_sendable,
+        comment_allowed: pay.comment_allowed.unwrap_or(0),
+        description: lnurl_description(&pay.metadata),
+    };
+    let mut cache = cache();
+    cache
+        .lnurl
+        .retain(|_, (_, fetched)| fetched.elapsed() < LNURL_TTL);
+    if cache.lnurl.len() >= CAPACITY {
+        let oldest = cache
+            .lnurl
+            .iter()
+            .min_by_key(|(_, (_, fetched))| *fetched)
+            .map(|(key, _)| key.clone());
+        if let Some(oldest) = oldest {
+            cache.lnurl.remove(&oldest);
+        }
+    }
+    cache.lnurl.insert(key, (lnurl.clone(), Instant::now()));
+    Ok(lnurl)
+}
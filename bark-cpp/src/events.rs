@@ -0,0 +1,335 @@
+//! Change feed for wallet state, handed to the bridge in coalesced batches.
+//!
+//! While events are enabled, every state-mutating call schedules a diff of the
+//! vtxo set and the movement list against the last state seen here. A diff
+//! re-reads both in full, so diffs run at most once per `REFRESH_INTERVAL`
+//! and the calls that finish in between share the next one. Round results and
+//! settled lightning receives are pushed directly by the calls that produce
+//! them. Events queue up, merged per entity, until `wait_for_events` drains
+//! them. Selecting another wallet starts a new epoch: queued events are
+//! dropped, and a diff that read the previous wallet is discarded.
+
+use std::collections::HashMap;
+use std::sync::{Condvar, LazyLock, Mutex, MutexGuard};
+use std::time::{Duration, Instant};
+
+use bark::WalletVtxo;
+use bark::movement::Movement;
+use bark::round::RoundStatus;
+use logger::log::debug;
+
+use crate::cxx::ffi::WalletEvent;
+
+pub(crate) const MOVEMENT_CREATED: &str = "movement_created";
+pub(crate) const MOVEMENT_UPDATED: &str = "movement_updated";
+pub(crate) const VTXO_STATE_CHANGED: &str = "vtxo_state_changed";
+pub(crate) const ROUND_STATUS: &str = "round_status";
+pub(crate) const LIGHTNING_RECEIVE_SETTLED: &str = "lightning_receive_settled";
+pub(crate) const ONCHAIN_SYNC: &str = "onchain_sync";
+
+/// State reported for vtxos that dropped out of the wallet's vtxo set.
+const VTXO_GONE: &str = "Spent";
+
+/// Shortest time between the starts of two diffs
+const REFRESH_INTERVAL: Duration = Duration::from_secs(1);
+
+#[derive(Default)]
+struct EventState {
+    enabled: bool,
+    // `None` until a diff has established the baseline to compare against
+    vtxo_states: Option<HashMap<String, String>>,
+    movements: Option<HashMap<u32, (String, i64)>>,
+    queue: Vec<WalletEvent>,
+    // Bumped whenever the baseline is reset, so a diff that read the
+    // previous wallet is not applied to the next one
+    epoch: u64,
+    refresh_running: bool,
+    refresh_requested: bool,
+    last_refresh: Option<Instant>,
+}
+
+static EVENTS: LazyLock<(Mutex<EventState>, Condvar)> =
+    LazyLock::new(|| (Mutex::new(EventState::default()), Condvar::new()));
+
+fn state() -> MutexGuard<'static, EventState> {
+    EVENTS.0.lock().unwrap_or_else(|e| e.into_inner())
+}
+
+pub(crate) fn set_enabled(enabled: bool) {
+    {
+        let mut state = state();
+        state.enabled = enabled;
+        state.vtxo_states = None;
+        state.movements = None;
+        state.queue.clear();
+    }
+    EVENTS.1.notify_all();
+    if enabled {
+        // Establishes the baseline without emitting anything
+        schedule_refresh();
+    }
+}
+
+/// Forgets the baseline and the queued events after a wallet was loaded,
+/// selected or closed, so the next diff does not report the whole wallet as
+/// new and no event of the previous wallet is delivered.
+pub(crate) fn reset_baseline() {
+    let enabled = {
+        let mut state = state();
+        state.epoch += 1;
+        state.vtxo_states = None;
+        state.movements = None;
+        state.queue.clear();
+        state.enabled
+    };
+    if enabled {
+        schedule_refresh();
+    }
+}
+
+/// Queues a diff of the wallet against the last seen state. Requests that
+/// arrive while a diff is running are folded into one follow-up pass.
+pub(crate) fn schedule_refresh() {
+    {
+        let mut state = state();
+        if !state.enabled {
+            return;
+        }
+        if state.refresh_running {
+            state.refresh_requested = true;
+            return;
+        }
+        state.refresh_running = true;
+    }
+    crate::TOKIO_RUNTIME.spawn(run_refresh());
+}
+
+async fn run_refresh() {
+    loop {
+        let wait = state().last_refresh.map_or(Duration::ZERO, |at| {
+            REFRESH_INTERVAL.saturating_sub(at.elapsed())
+        });
+        if !wait.is_zero() {
+            // Requests arriving meanwhile are folded into this pass
+            tokio::time::sleep(wait).await;
+        }
+        let epoch = {
+            let mut state = state();
+            state.refresh_requested = false;
+            state.last_refresh = Some(Instant::now());
+            state.epoch
+        };
+
+        match crate::vtxos().await {
+            Ok(vtxos) => apply_vtxos(&vtxos, epoch),
+            Err(e) => debug!("Skipping vtxo event diff: {:#}", e),
+        }
+        match crate::history().await {
+            Ok(movements) => apply_movements(&movements, epoch),
+            Err(e) => debug!("Skipping movement event diff: {:#}", e),
+        }
+
+        let mut state = state();
+        if !state.refresh_requested || !state.enabled {
+            state.refresh_running = false;
+            return;
+        }
+    }
+}
+
+/// Diffs `vtxos` read in `epoch` against the baseline, unless the baseline
+/// was reset since
+fn apply_vtxos(vtxos: &[WalletVtxo], epoch: u64) {
+    let next = vtxos
+        .iter()
+        .map(|v| {
+            let state = crate::utils::vtxo_state_name(&v.state);
+            (v.vtxo.id().to_string(), state.to_string())
+        })
+        .collect::<HashMap<_, _>>();
+
+    let mut state = state();
+    if state.epoch != epoch {
+        debug!("Discarding an event diff of the previously selected wallet");
+        return;
+    }
+    if let Some(prev) = state.vtxo_states.take() {
+        for event in diff_vtxo_states(&prev, &next) {
+            coalesce(&mut state.queue, event);
+        }
+    }
+    state.vtxo_states = Some(next);
+    drop(state);
+    EVENTS.1.notify_all();
+}
+
+/// Like `apply_vtxos`, for the movement list
+fn apply_movements(movements: &[Movement], epoch: u64) {
+    let next = movements
+        .iter()
+        .map(|m| {
+            let status = m.status.as_str().to_string();
+            (m.id.0, (status, m.time.updated_at.timestamp_millis()))
+        })
+        .collect::<HashMap<_, _>>();
+
+    let mut state = state();
+    if state.epoch != epoch {
+        debug!("Discarding an event diff of the previously selected wallet");
+        return;
+    }
+    if let Some(prev) = state.movements.take() {
+        for event in diff_movements(&prev, &next) {
+            coalesce(&mut state.queue, event);
+        }
+    }
+    state.movements = Some(next);
+    drop(state);
+    EVENTS.1.notify_all();
+}
+
+pub(crate) fn diff_vtxo_states(
+    prev: &HashMap<String, String>,
+    next: &HashMap<String, String>,
+) -> Vec<WalletEvent> {
+    let mut events = Vec::new();
+    for (id, status) in next {
+        let old = prev.get(id).map(String::as_str).unwrap_or_default();
+        if old != status {
+            events.push(event(VTXO_STATE_CHANGED, id.clone(), status.clone(), old));
+        }
+    }
+    for (id, old) in prev {
+        if !next.contains_key(id) && old != VTXO_GONE {
+            events.push(event(VTXO_STATE_CHANGED, id.clone(), VTXO_GONE.into(), old));
+        }
+    }
+    events
+}
+
+pub(crate) fn diff_movements(
+    prev: &HashMap<u32, (String, i64)>,
+    next: &HashMap<u32, (String, i64)>,
+) -> Vec<WalletEvent> {
+    let mut events = next
+        .iter()
+        .filter_map(|(id, entry)| match prev.get(id) {
+            None => Some(event(MOVEMENT_CREATED, id.to_string(), entry.0.clone(), "")),
+            Some(old) if old != entry => Some(event(
+                MOVEMENT_UPDATED,
+                id.to_string(),
+                entry.0.clone(),
+                &old.0,
+            )),
+            Some(_) => None,
+        })
+        .collect::<Vec<_>>();
+    // Deliver movements in creation order
+    events.sort_by_key(|e| e.id.parse::<u32>().unwrap_or_default());
+    events
+}
+
+pub(crate) fn push_round_status(status: &RoundStatus) {
+    let status = crate::utils::round_status_to_ffi(status);
+    push(event(
+        ROUND_STATUS,
+        status.funding_txid,
+        status.status,
+        &status.error,
+    ));
+}
+
+pub(crate) fn push_lightning_receive_settled(payment_hash: String) {
+    push(event(
+        LIGHTNING_RECEIVE_SETTLED,
+        payment_hash,
+        "settled".into(),
+        "",
+    ));
+}
+
+/// Reports onchain sync progress: `status` is started, skipped, finished or
+/// failed, and the detail holds the checkpoint and chain tip heights.
+pub(crate) fn push_onchain_sync(status: &str, from_height: u32, tip_height: u32) {
+    push(event(
+        ONCHAIN_SYNC,
+        "onchain".into(),
+        status.into(),
+        &format!("{}:{}", from_height, tip_height),
+    ));
+}
+
+fn push(event: WalletEvent) {
+    let mut state = state();
+    if state.enabled {
+        coalesce(&mut state.queue, event);
+        drop(state);
+        EVENTS.1.notify_all();
+    }
+}
+
+fn entity(kind: &str) -> &str {
+    match kind {
+        MOVEMENT_CREATED | MOVEMENT_UPDATED => "movement",
+        other => other,
+    }
+}
+
+/// Merges `event` into a pending event for the same entity, if any. A
+/// created movement stays created, and a vtxo that ends up back in the state
+/// it started the batch in is dropped entirely.
+pub(crate) fn coalesce(queue: &mut Vec<WalletEvent>, event: WalletEvent) {
+    let pending = queue
+        .iter()
+        .position(|e| e.id == event.id && entity(&e.kind) == entity(&event.kind));
+    let Some(index) = pending else {
+        queue.push(event);
+        return;
+    };
+
+    let existing = &mut queue[index];
+    existing.status = event.status;
+    // Movements and vtxos keep the status they had before the batch
+    if existing.kind == ROUND_STATUS
+        || existing.kind == LIGHTNING_RECEIVE_SETTLED
+        || existing.kind == ONCHAIN_SYNC
+    {
+        existing.detail = event.detail;
+    }
+    if existing.kind == VTXO_STATE_CHANGED && existing.status == existing.detail {
+        queue.remove(index);
+    }
+}
+
+/// Blocks for up to `timeout` until events are pending, then keeps collecting
+/// for `batch_window` so bursts are delivered as one coalesced batch.
+pub(crate) fn wait_for_events(timeout: Duration, batch_window: Duration) -> Vec<WalletEvent> {
+    let (_, condvar) = &*EVENTS;
+    let (mut state, _) = condvar
+        .wait_timeout_while(state(), timeout, |s| s.enabled && s.queue.is_empty())
+        .unwrap_or_else(|e| e.into_inner());
+    if state.queue.is_empty() {
+        return Vec::new();
+    }
+
+    let deadline = Instant::now() + batch_window;
+    while state.enabled {
+        let Some(remaining) = deadline.checked_duration_since(Instant::now()) else {
+            break;
+        };
+        state = condvar
+            .wait_timeout(state, remaining)
+            .unwrap_or_else(|e| e.into_inner())
+            .0;
+    }
+    std::mem::take(&mut state.queue)
+}
+
+fn event(kind: &str, id: String, status: String, detail: &str) -> WalletEvent {
+    WalletEvent {
+        kind: kind.to_string(),
+        id,
+        status,
+        detail: detail.to_string(),
+    }
+}
@@ -0,0 +1,322 @@
+//! Streaming export of the movement history to a file.
+//!
+//! `history()` hands the whole history over the bridge, where it is copied
+//! into C++ and again into JS before it can be serialized, about three times
+//! the size of the data at once. An export instead converts one movement at a
+//! time with `movement_to_bark_movement_with` and writes it straight to the
+//! file, so memory stays bounded by one page of movements.
+//!
+//! The caller drives an export chunk by chunk: `start` opens the file, each
+//! `advance` reads the next `chunk_size` matching movements with
+//! `history_page`, continuing below the cursor of the last page, writes them
+//! and reports the progress. Rows go to a temporary file next to the target,
+//! which replaces the target once the last row is written, so a cancelled or
+//! failed export never leaves a partial file behind.
+//!
+//! The cancel token and deadline given to `start` cover the whole export:
+//! every `advance` runs under what is left of them, and a stopped chunk
+//! removes the export like any other failure.
+
+use std::collections::HashMap;
+use std::fs::{self, File};
+use std::io::{BufWriter, Write};
+use std::path::{Path, PathBuf};
+use std::str::FromStr;
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::sync::{LazyLock, Mutex, MutexGuard};
+use std::time::Instant;
+
+use anyhow::{Context, bail};
+use logger::log::info;
+
+use crate::cancel::{self, CallLimits};
+use crate::cxx::ffi::{BarkMovement, BarkMovementDestination};
+use crate::utils::{self, HistoryQuery};
+
+/// Rows written between two progress reports by default
+pub(crate) const DEFAULT_CHUNK_SIZE: usize = 500;
+
+const CSV_HEADER: &str = "id,status,subsystem_name,subsystem_kind,intended_balance_sat,\
+effective_balance_sat,offchain_fee_sat,sent_to,received_on,input_vtxos,output_vtxos,\
+exited_vtxos,created_at,updated_at,completed_at,metadata_json";
+
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub(crate) enum Format {
+    Csv,
+    Jsonl,
+}
+
+impl FromStr for Format {
+    type Err = anyhow::Error;
+
+    fn from_str(s: &str) -> anyhow::Result<Self> {
+        match s.to_ascii_lowercase().as_str() {
+            "csv" => Ok(Format::Csv),
+            "jsonl" => Ok(Format::Jsonl),
+            _ => bail!("Unknown export format '{}', use csv or jsonl", s),
+        }
+    }
+}
+
+#[derive(Clone, Copy, Debug, Default, PartialEq, Eq)]
+pub(crate) struct Progress {
+    pub id: u64,
+    pub written: usize,
+    pub done: bool,
+}
+
+struct Export {
+    format: Format,
+    include_metadata: bool,
+    chunk_size: usize,
+    /// Filters of the next page, its cursor follows the rows written
+    query: HistoryQuery,
+    /// Rows the query limit still allows
+    remaining: usize,
+    written: usize,
+    done: bool,
+    limits: CallLimits,
+    started: Instant,
+    out: BufWriter<File>,
+    temp_path: PathBuf,
+    path: PathBuf,
+}
+
+impl Export {
+    /// What is left of the limits given to `start`
+    fn remaining_limits(&self) -> anyhow::Result<CallLimits> {
+        let timeout = match self.limits.timeout {
+            Some(timeout) => match timeout.checked_sub(self.started.elapsed()) {
+                Some(left) if !left.is_zero() => Some(left),
+                _ => bail!("export_history timed out after {} ms", timeout.as_millis()),
+            },
+            None => None,
+        };
+        Ok(CallLimits {
+            token: self.limits.token,
+            timeout,
+        })
+    }
+}
+
+static NEXT_ID: AtomicU64 = AtomicU64::new(1);
+static EXPORTS: LazyLock<Mutex<HashMap<u64, Export>>> =
+    LazyLock::new(|| Mutex::new(HashMap::new()));
+
+fn exports() -> MutexGuard<'static, HashMap<u64, Export>> {
+    EXPORTS.lock().unwrap_or_else(|e| e.into_inner())
+}
+
+fn temp_path(path: &Path) -> PathBuf {
+    let mut name = path.file_name().unwrap_or_default().to_os_string();
+    name.push(".partial");
+    path.with_file_name(name)
+}
+
+/// Starts exporting the movements that match `query`, newest first. The
+/// query limit caps the number of rows, `limits` apply to the whole export.
+pub(crate) fn start(
+    path: &Path,
+    format: Format,
+    query: HistoryQuery,
+    include_metadata: bool,
+    chunk_size: usize,
+    limits: CallLimits,
+) -> anyhow::Result<Progress> {
+    if path.file_name().is_none() {
+        bail!("Export path {} has no file name", path.display());
+    }
+
+    let temp_path = temp_path(path);
+    let file = File::create(&temp_path)
+        .with_context(|| format!("Failed to create {}", temp_path.display()))?;
+    let mut out = BufWriter::new(file);
+    if format == Format::Csv {
+        writeln!(out, "{}", CSV_HEADER)?;
+    }
+
+    let id = NEXT_ID.fetch_add(1, Ordering::Relaxed);
+    info!("Exporting movements to {}", path.display());
+    exports().insert(
+        id,
+        Export {
+            format,
+            include_metadata,
+            chunk_size: chunk_size.max(1),
+            remaining: query.limit,
+            query,
+            written: 0,
+            done: false,
+            limits,
+            started: Instant::now(),
+            out,
+            temp_path,
+            path: path.to_path_buf(),
+        },
+    );
+    Ok(Progress {
+        id,
+        written: 0,
+        done: false,
+    })
+}
+
+/// Reads and writes the next chunk of export `id`. The export is gone once
+/// the progress reports it done or this returns an error.
+pub(crate) async fn advance(id: u64) -> anyhow::Result<Progress> {
+    // Taken out of the map while writing, so other exports can proceed
+    let mut export = exports()
+        .remove(&id)
+        .with_context(|| format!("No history export with id {}", id))?;
+
+    let written = match export.remaining_limits() {
+        Ok(limits) => cancel::run("export_history", limits, write_chunk(&mut export)).await,
+        Err(e) => Err(e),
+    };
+    if let Err(e) = written {
+        let _ = fs::remove_file(&export.temp_path);
+        return Err(e);
+    }
+    let progress = Progress {
+        id,
+        written: export.written,
+        done: export.done,
+    };
+    if !progress.done {
+        exports().insert(id, export);
+    }
+    Ok(progress)
+}
+
+async fn write_chunk(export: &mut Export) -> anyhow::Result<()> {
+    let page = HistoryQuery {
+        limit: export.chunk_size.min(export.remaining),
+        ..export.query.clone()
+    };
+    let (movements, has_more) = crate::history_page(page).await?;
+    for movement in &movements {
+        let row = utils::movement_to_bark_movement_with(movement, export.include_metadata)?;
+        match export.format {
+            Format::Csv => write_csv_row(&mut export.out, &row)?,
+            Format::Jsonl => {
+                serde_json::to_writer(&mut export.out, &json_row(&row))?;
+                export.out.write_all(b"\n")?;
+            }
+        }
+        export.written += 1;
+    }
+    export.remaining -= movements.len();
+    if let Some(last) = movements.last() {
+        export.query.cursor = Some(last.id.0);
+    }
+
+    export.done = !has_more || export.remaining == 0;
+    if export.done {
+        export.out.flush()?;
+        export.out.get_ref().sync_all()?;
+        fs::rename(&export.temp_path, &export.path)
+            .with_context(|| format!("Failed to move the export to {}", export.path.display()))?;
+        info!(
+            "Exported {} movements to {}",
+            export.written,
+            export.path.display()
+        );
+    }
+    Ok(())
+}
+
+/// Stops export `id` and removes its partial file
+pub(crate) fn cancel(id: u64) -> bool {
+    match exports().remove(&id) {
+        Some(export) => {
+            drop(export.out);
+            let _ = fs::remove_file(&export.temp_path);
+            true
+        }
+        None => false,
+    }
+}
+
+/// Quotes a CSV field when it contains a separator, quote or line break
+pub(crate) fn csv_field(value: &str) -> String {
+    if value.contains([',', '"', '\n', '\r']) {
+        format!("\"{}\"", value.replace('"', "\"\""))
+    } else {
+        value.to_string()
+    }
+}
+
+/// Destinations as `payment_method:destination:amount_sat`, `;` separated
+fn joined_destinations(destinations: &[BarkMovementDestination]) -> String {
+    destinations
+        .iter()
+        .map(|d| format!("{}:{}:{}", d.payment_method, d.destination, d.amount_sat))
+        .collect::<Vec<_>>()
+        .join(";")
+}
+
+fn write_csv_row(out: &mut impl Write, m: &BarkMovement) -> anyhow::Result<()> {
+    let fields = [
+        m.id.to_string(),
+        m.status.clone(),
+        m.subsystem_name.clone(),
+        m.subsystem_kind.clone(),
+        m.intended_balance_sat.to_string(),
+        m.effective_balance_sat.to_string(),
+        m.offchain_fee_sat.to_string(),
+        joined_destinations(&m.sent_to),
+        joined_destinations(&m.received_on),
+        m.input_vtxos.join(";"),
+        m.output_vtxos.join(";"),
+        m.exited_vtxos.join(";"),
+        m.created_at.clone(),
+        m.updated_at.clone(),
+        m.completed_at.clone(),
+        m.metadata_json.clone(),
+    ];
+    let line = fields
+        .iter()
+        .map(|f| csv_field(f))
+        .collect::<Vec<_>>()
+        .join(",");
+    writeln!(out, "{}", line)?;
+    Ok(())
+}
+
+fn json_destinations(destinations: &[BarkMovementDestination]) -> serde_json::Value {
+    destinations
+        .iter()
+        .map(|d| {
+            serde_json::json!({
+                "destination": d.destination,
+                "payment_method": d.payment_method,
+                "amount_sat": d.amount_sat,
+            })
+        })
+        .collect()
+}
+
+/// One JSONL line, with the same field names as `BarkMovement`
+pub(crate) fn json_row(m: &BarkMovement) -> serde_json::Value {
+    // Embedded as JSON rather than as a string holding JSON
+    let metadata = serde_json::from_str::<serde_json::Value>(&m.metadata_json)
+        .unwrap_or(serde_json::Value::Null);
+    serde_json::json!({
+        "id": m.id,
+        "status": m.status,
+        "subsystem_name": m.subsystem_name,
+        "subsystem_kind": m.subsystem_kind,
+        "intended_balance_sat": m.intended_balance_sat,
+        "effective_balance_sat": m.effective_balance_sat,
+        "offchain_fee_sat": m.offchain_fee_sat,
+        "sent_to": json_destinations(&m.sent_to),
+        "received_on": json_destinations(&m.received_on),
+        "input_vtxos": m.input_vtxos,
+        "output_vtxos": m.output_vtxos,
+        "exited_vtxos": m.exited_vtxos,
+        "created_at": m.created_at,
+        "updated_at": m.updated_at,
+        "completed_at": m.completed_at,
+        "metadata": metadata,
+    })
+}
@@ -0,0 +1,119 @@
+//! Key derivation from a mnemonic for ranges of indexes.
+//!
+//! Restores and address pool pre-generation derive hundreds of keys in a row.
+//! The seed and purpose key are derived once per call, so each index only
+//! costs one child derivation. The seed is derived locally and wiped after
+//! use rather than going through the seed cache, which holds the seed of the
+//! wallet being opened and must not be replaced by an unrelated mnemonic.
+//! Large ranges are split across threads.
+
+use std::num::NonZeroUsize;
+
+use anyhow::{Context, bail};
+use bark::ark::bitcoin::Network;
+use bark::ark::bitcoin::secp256k1::{All, Secp256k1};
+use bdk_wallet::bitcoin::bip32;
+use bdk_wallet::bitcoin::key::Keypair;
+use bip39::Mnemonic;
+
+use crate::ARK_PURPOSE_INDEX;
+use crate::startup::Seed;
+
+/// Upper bound on the keys derived by one range call
+pub(crate) const MAX_RANGE: u32 = 10_000;
+
+/// Ranges below this are derived on the calling thread
+const PARALLEL_MIN_PER_THREAD: usize = 64;
+
+/// Returns the key all ark keypairs of `seed` are derived from
+pub(crate) fn purpose_key(
+    secp: &Secp256k1<All>,
+    seed: &[u8],
+    network: Network,
+) -> anyhow::Result<bip32::Xpriv> {
+    let key =
+        bip32::Xpriv::new_master(network, seed)?.derive_priv(secp, &[ARK_PURPOSE_INDEX.into()])?;
+    Ok(key)
+}
+
+/// Like `purpose_key`, deriving the seed of `mnemonic` with an empty
+/// passphrase
+pub(crate) fn mnemonic_purpose_key(
+    secp: &Secp256k1<All>,
+    mnemonic: &Mnemonic,
+    network: Network,
+) -> anyhow::Result<bip32::Xpriv> {
+    let seed = Seed::new(mnemonic.to_seed(""));
+    purpose_key(secp, seed.as_bytes(), network)
+}
+
+pub(crate) fn derive_keypair(
+    secp: &Secp256k1<All>,
+    purpose_key: &bip32::Xpriv,
+    index: u32,
+) -> anyhow::Result<Keypair> {
+    Ok(purpose_key
+        .derive_priv(secp, &[index.into()])?
+        .to_keypair(secp))
+}
+
+/// Derives the keypairs for `count` indexes starting at `start`, in order
+pub(crate) fn derive_range(
+    purpose_key: &bip32::Xpriv,
+    start: u32,
+    count: u32,
+) -> anyhow::Result<Vec<Keypair>> {
+    let indexes = range(start, count)?;
+    let threads = std::thread::available_parallelism()
+        .map_or(1, NonZeroUsize::get)
+        .min(indexes.len() / PARALLEL_MIN_PER_THREAD)
+        .max(1);
+
+    let secp = Secp256k1::new();
+    if threads == 1 {
+        return indexes
+            .map(|index| derive_keypair(&secp, purpose_key, index))
+            .collect();
+    }
+
+    let indexes = indexes.collect::<Vec<_>>();
+    let chunk_len = indexes.len().div_ceil(threads);
+    std::thread::scope(|scope| {
+        let workers = indexes
+            .chunks(chunk_len)
+            .map(|chunk| {
+                let secp = &secp;
+                scope.spawn(move || {
+                    chunk
+                        .iter()
+                        .map(|index| derive_keypair(secp, purpose_key, *index))
+                        .collect::<anyhow::Result<Vec<_>>>()
+                })
+            })
+            .collect::<Vec<_>>();
+
+        let mut keypairs = Vec::with_capacity(indexes.len());
+        for worker in workers {
+            let chunk = worker
+                .join()
+                .map_err(|_| anyhow::anyhow!("Key derivation thread panicked"))??;
+            keypairs.extend(chunk);
+        }
+        Ok(keypairs)
+    })
+}
+
+/// Validates a range request and returns its indexes
+pub(crate) fn range(start: u32, count: u32) -> anyhow::Result<std::ops::Range<u32>> {
+    if count > MAX_RANGE {
+        bail!(
+            "Can derive at most {} keys at once, got {}",
+            MAX_RANGE,
+            count
+        );
+    }
+    let end = start
+        .checked_add(count)
+        .context("Index range exceeds the maximum index")?;
+    Ok(start..end)
+}
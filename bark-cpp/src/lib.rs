@@ -21,23 +21,42 @@ use bark::movement::Movement;
 use bark::onchain::OnchainWallet;
 use bark::persist::BarkPersister;
 use bark::persist::models::{LightningReceive, PendingBoard};
-use bark::persist::sqlite::SqliteClient;
 use bark::round::RoundStatus;
+use bdk_wallet::bitcoin::Txid;
 use bdk_wallet::bitcoin::key::Keypair;
-use bdk_wallet::bitcoin::{Txid, bip32};
 use bitcoin_ext::BlockHeight;
 use tokio::runtime::Runtime;
-use tokio::sync::Mutex;
+use tokio::sync::{Mutex, RwLock, RwLockReadGuard};
+mod alloc_stats;
+mod cancel;
+mod columnar;
 mod cxx;
+mod destination;
+mod events;
+mod history_export;
+mod keys;
+mod lightning_wait;
+mod metrics;
 mod onchain;
+mod refresh_plan;
+mod runtime;
+mod scheduler;
+mod server;
+mod singleflight;
+mod snapshot;
+mod startup;
+mod storage;
 mod utils;
 
 use bip39::Mnemonic;
 use logger::log::{debug, info};
-use std::path::Path;
+use std::collections::HashMap;
+use std::path::{Path, PathBuf};
 use std::sync::Arc;
 use std::sync::LazyLock;
 use std::sync::Once;
+use std::time::Duration;
+use storage::StorageProfile;
 use utils::DB_FILE;
 use utils::try_create_wallet;
 
@@ -47,156 +66,328 @@ use std::str::FromStr;
 
 use anyhow::Context;
 #[cfg(test)]
+mod bench;
+#[cfg(test)]
 mod tests;
 
 // Use a static Once to ensure the logger is initialized only once.
 static LOGGER_INIT: Once = Once::new();
 const ARK_PURPOSE_INDEX: u32 = 350;
 
-pub static TOKIO_RUNTIME: LazyLock<Runtime> =
-    LazyLock::new(|| Runtime::new().expect("Failed to create Tokio runtime"));
+// Built on first use with the sizing set through `runtime::configure`
+pub static TOKIO_RUNTIME: LazyLock<Runtime> = LazyLock::new(runtime::build);
+
+// Global wallet manager instance.
+//
+// The outer lock only guards the set of open wallets and which one is
+// active. Calls hold it just long enough to clone the context they act on,
+// so selecting or closing a wallet never waits for a running call.
+// Exclusivity for operations that mutate wallet state is provided by the
+// locks inside `WalletContext`, so reads never queue behind a long-running
+// sync or maintenance pass.
+static GLOBAL_WALLET_MANAGER: LazyLock<RwLock<WalletManager>> =
+    LazyLock::new(|| RwLock::new(WalletManager::new()));
+
+// Serializes creating and opening wallets. Opening includes the handshake
+// with the server, so it happens outside the manager lock, and this keeps
+// two loads from opening the same wallet twice.
+static WALLET_LOADS: LazyLock<Mutex<()>> = LazyLock::new(|| Mutex::new(()));
+
+// Shared access to the wallet manager. The wait is reported as lock wait when
+// metrics are enabled.
+pub(crate) async fn wallet_manager() -> RwLockReadGuard<'static, WalletManager> {
+    metrics::lock_wait(GLOBAL_WALLET_MANAGER.read()).await
+}
+
+// The wallet calls act on, taken out of the manager without keeping its lock
+pub(crate) async fn active_wallet() -> ActiveWallet {
+    wallet_manager().await.active()
+}
+
+// Key of the wallet calls act on, for work that has to stay on that wallet
+// when another one is selected later
+pub(crate) async fn active_wallet_key() -> Option<PathBuf> {
+    wallet_manager().await.active.clone()
+}
 
-// Global wallet manager instance
-static GLOBAL_WALLET_MANAGER: LazyLock<Mutex<WalletManager>> =
-    LazyLock::new(|| Mutex::new(WalletManager::new()));
+// The open wallet under `key`, which may no longer be the active one
+pub(crate) async fn wallet_at(key: &Path) -> anyhow::Result<ActiveWallet> {
+    match wallet_manager().await.contexts.get(key) {
+        Some(ctx) => Ok(ActiveWallet(Some(ctx.clone()))),
+        None => bail!("No wallet is open in {}", key.display()),
+    }
+}
 
 // Wallet context that holds all wallet-related components
 pub struct WalletContext {
     pub wallet: Wallet,
-    pub onchain_wallet: OnchainWallet,
+    pub datadir: PathBuf,
+    // bdk needs `&mut` for address derivation, syncing and spending, so the
+    // onchain wallet carries its own lock. Take it after `mutation_lock`, and
+    // through `onchain_write` so the view below stays current.
+    pub onchain_wallet: RwLock<OnchainWallet>,
+    // Balance and outputs as of the last write section. Onchain reads are
+    // served from here, so they don't wait for a sync or an exit pass that
+    // holds the onchain wallet.
+    onchain_view: std::sync::RwLock<onchain::OnchainView>,
+    // Serializes operations that mutate offchain wallet state
+    mutation_lock: Mutex<()>,
+    // Keeps the storage profile applied to new connections to the database
+    _connection_settings: storage::ConnectionSettings,
 }
 
-// Wallet manager that manages the wallet context lifecycle
+impl WalletContext {
+    pub(crate) fn new(
+        wallet: Wallet,
+        onchain_wallet: OnchainWallet,
+        datadir: PathBuf,
+        connection_settings: storage::ConnectionSettings,
+    ) -> Self {
+        let onchain_view = onchain::OnchainView::read(&onchain_wallet);
+        Self {
+            wallet,
+            datadir,
+            onchain_wallet: RwLock::new(onchain_wallet),
+            onchain_view: std::sync::RwLock::new(onchain_view),
+            mutation_lock: Mutex::new(()),
+            _connection_settings: connection_settings,
+        }
+    }
+
+    /// Takes the onchain wallet exclusively. The view is refreshed when the
+    /// returned guard is dropped.
+    pub(crate) async fn onchain_write(&self) -> onchain::OnchainWriteGuard<'_> {
+        onchain::OnchainWriteGuard::new(self.onchain_wallet.write().await, &self.onchain_view)
+    }
+
+    pub(crate) fn onchain_view(&self) -> onchain::OnchainView {
+        self.onchain_view
+            .read()
+            .unwrap_or_else(|e| e.into_inner())
+            .clone()
+    }
+}
+
+// Wallet manager that manages the wallet context lifecycle.
+//
+// Several wallets can be open at once, keyed by their datadir. Calls act on
+// the active one, so switching accounts only changes which context they use
+// instead of closing one wallet and opening the other. Each context has its
+// own mutation lock, a long sync of one wallet never holds up another.
 pub struct WalletManager {
-    context: Option<WalletContext>,
+    contexts: HashMap<PathBuf, Arc<WalletContext>>,
+    active: Option<PathBuf>,
 }
 
-impl WalletManager {
-    pub fn new() -> Self {
-        Self { context: None }
-    }
+/// Handle on the active wallet at the time it was taken. It keeps the
+/// context alive, so a call that is running when its wallet is closed or
+/// another one is selected finishes against the wallet it started on.
+#[derive(Clone)]
+pub(crate) struct ActiveWallet(Option<Arc<WalletContext>>);
+
+// Schedules an event diff once a mutation ends, also when its future is
+// dropped part way by a cancellation or deadline and may have changed the
+// wallet already. Declared before the snapshot guard so it runs after it.
+struct RefreshOnDrop {
+    armed: bool,
+    invalidate: bool,
+}
 
-    pub fn is_loaded(&self) -> bool {
-        self.context.is_some()
+impl Drop for RefreshOnDrop {
+    fn drop(&mut self) {
+        if self.armed {
+            if self.invalidate {
+                snapshot::invalidate();
+            }
+            events::schedule_refresh();
+        }
     }
+}
 
-    async fn create_wallet(&mut self, datadir: &Path, opts: CreateOpts) -> anyhow::Result<()> {
-        debug!("Creating wallet in {}", datadir.display());
+impl ActiveWallet {
+    /// Identifies the wallet without keeping it open
+    pub(crate) fn downgrade(&self) -> Option<std::sync::Weak<WalletContext>> {
+        self.0.as_ref().map(Arc::downgrade)
+    }
 
-        let (config, net) = merge_config_opts(opts.clone())?;
+    /// Runs `f` exclusively with respect to other state-mutating calls.
+    /// Read-only calls made through `with_context_ref_async` are not blocked.
+    pub async fn with_context_async<'a, T, F, Fut>(&'a self, f: F) -> anyhow::Result<T>
+    where
+        F: FnOnce(&'a WalletContext) -> Fut,
+        Fut: std::future::Future<Output = anyhow::Result<T>>,
+    {
+        match &self.0 {
+            Some(ctx) => {
+                let _guard = metrics::lock_wait(ctx.mutation_lock.lock()).await;
+                let _refresh = RefreshOnDrop {
+                    armed: true,
+                    invalidate: false,
+                };
+                let _mutation = snapshot::begin_mutation();
+                f(ctx).await
+            }
+            None => bail!("Wallet not loaded"),
+        }
+    }
 
-        try_create_wallet(datadir, net, config.clone(), Some(opts.mnemonic.clone())).await?;
+    /// Like `with_context_async`, for checks that usually find nothing to
+    /// do, such as polling a pending lightning payment. `f` also returns
+    /// whether it changed the wallet. Only then is the snapshot dropped and
+    /// an event diff scheduled.
+    pub async fn with_context_attempt_async<'a, T, F, Fut>(&'a self, f: F) -> anyhow::Result<T>
+    where
+        F: FnOnce(&'a WalletContext) -> Fut,
+        Fut: std::future::Future<Output = (anyhow::Result<T>, bool)>,
+    {
+        match &self.0 {
+            Some(ctx) => {
+                let _guard = metrics::lock_wait(ctx.mutation_lock.lock()).await;
+                // An attempt dropped part way is treated as a change
+                let mut refresh = RefreshOnDrop {
+                    armed: true,
+                    invalidate: true,
+                };
+                let _attempt = snapshot::begin_attempt();
+                let (result, changed) = f(ctx).await;
+                refresh.armed = changed;
+                result
+            }
+            None => bail!("Wallet not loaded"),
+        }
+    }
 
-        Ok(())
+    /// Runs `f` with shared access to the wallet context.
+    pub async fn with_context_ref_async<'a, T, F, Fut>(&'a self, f: F) -> anyhow::Result<T>
+    where
+        F: FnOnce(&'a WalletContext) -> Fut,
+        Fut: std::future::Future<Output = anyhow::Result<T>>,
+    {
+        match &self.0 {
+            Some(ctx) => f(ctx).await,
+            None => bail!("Wallet not loaded"),
+        }
     }
+}
 
-    async fn load_wallet(
-        &mut self,
-        datadir: &Path,
-        mnemonic: Mnemonic,
-        config: Config,
-    ) -> anyhow::Result<()> {
-        if self.context.is_some() {
-            return Ok(());
+// Key under which the wallet in `datadir` is kept, so different spellings of
+// the same directory find the same context
+fn wallet_key(datadir: &Path) -> PathBuf {
+    datadir
+        .canonicalize()
+        .unwrap_or_else(|_| datadir.to_path_buf())
+}
+
+impl WalletManager {
+    pub fn new() -> Self {
+        Self {
+            contexts: HashMap::new(),
+            active: None,
         }
+    }
+
+    pub fn is_loaded(&self) -> bool {
+        self.active.is_some()
+    }
 
-        debug!("Loading wallet in {}", datadir.display());
+    fn context(&self) -> Option<&Arc<WalletContext>> {
+        self.active.as_ref().and_then(|key| self.contexts.get(key))
+    }
+
+    pub(crate) fn active(&self) -> ActiveWallet {
+        ActiveWallet(self.context().cloned())
+    }
 
-        if !datadir.exists() {
-            bail!("Datadir does not exist. Please create a new wallet first.");
+    // Cached snapshots and the event baseline describe the active wallet
+    fn activate(&mut self, key: PathBuf) {
+        if self.active.as_ref() != Some(&key) {
+            self.active = Some(key);
+            snapshot::invalidate();
+            events::reset_baseline();
+            singleflight::forget_all();
+            server::forget();
         }
+    }
 
-        info!("Attempting to open wallet...");
-        let (wallet, onchain_wallet) = self.open_wallet(datadir, mnemonic, config).await?;
+    fn insert(&mut self, key: PathBuf, ctx: WalletContext) {
+        self.contexts.insert(key.clone(), Arc::new(ctx));
+        self.activate(key);
+    }
 
-        self.context = Some(WalletContext {
-            wallet,
-            onchain_wallet,
-        });
+    /// Makes the wallet in `datadir` active if it is already open
+    fn select_open(&mut self, datadir: &Path) -> bool {
+        let key = wallet_key(datadir);
+        if !self.contexts.contains_key(&key) {
+            return false;
+        }
+        self.activate(key);
+        true
+    }
 
+    /// Makes the already open wallet in `datadir` the one calls act on
+    pub fn select_wallet(&mut self, datadir: &Path) -> anyhow::Result<()> {
+        if !self.select_open(datadir) {
+            bail!("No wallet is open in {}", datadir.display());
+        }
         Ok(())
     }
 
+    /// Datadirs of the open wallets, the active one first
+    pub fn open_wallets(&self) -> Vec<PathBuf> {
+        let mut datadirs = self
+            .contexts
+            .iter()
+            .filter(|(key, _)| self.active.as_ref() != Some(*key))
+            .map(|(_, ctx)| ctx.datadir.clone())
+            .collect::<Vec<_>>();
+        datadirs.sort();
+        if let Some(ctx) = self.context() {
+            datadirs.insert(0, ctx.datadir.clone());
+        }
+        datadirs
+    }
+
+    /// Closes the active wallet. Other open wallets stay open, but none of
+    /// them becomes active until selected.
     pub fn close_wallet(&mut self) -> anyhow::Result<()> {
-        if self.context.is_none() {
+        let Some(key) = self.active.clone() else {
             bail!("No wallet is currently loaded.");
+        };
+        self.close_wallet_at(&key)
+    }
+
+    pub fn close_wallet_at(&mut self, datadir: &Path) -> anyhow::Result<()> {
+        let key = wallet_key(datadir);
+        if self.contexts.remove(&key).is_none() {
+            bail!("No wallet is open in {}", datadir.display());
+        }
+        if self.active.as_ref() == Some(&key) {
+            self.active = None;
+            snapshot::invalidate();
+            events::reset_baseline();
+            singleflight::forget_all();
+            server::forget();
         }
-        self.context = None;
         info!("Wallet closed successfully.");
         Ok(())
     }
 
     pub async fn get_config(&self) -> anyhow::Result<Config> {
-        match &self.context {
+        match self.context() {
             Some(ctx) => Ok(ctx.wallet.config().clone()),
             None => bail!("Wallet not loaded"),
         }
     }
 
-    pub fn with_context<T, F>(&mut self, f: F) -> anyhow::Result<T>
-    where
-        F: FnOnce(&mut WalletContext) -> anyhow::Result<T>,
-    {
-        match &mut self.context {
-            Some(ctx) => f(ctx),
-            None => bail!("Wallet not loaded"),
-        }
-    }
-
     pub fn with_context_ref<T, F>(&self, f: F) -> anyhow::Result<T>
     where
         F: FnOnce(&WalletContext) -> anyhow::Result<T>,
     {
-        match &self.context {
+        match self.context() {
             Some(ctx) => f(ctx),
             None => bail!("Wallet not loaded"),
         }
     }
-
-    pub async fn with_context_async<'a, T, F, Fut>(&'a mut self, f: F) -> anyhow::Result<T>
-    where
-        F: FnOnce(&'a mut WalletContext) -> Fut,
-        Fut: std::future::Future<Output = anyhow::Result<T>>,
-    {
-        match &mut self.context {
-            Some(ctx) => f(ctx).await,
-            None => bail!("Wallet not loaded"),
-        }
-    }
-
-    pub async fn with_context_ref_async<T, F, Fut>(&self, f: F) -> anyhow::Result<T>
-    where
-        F: FnOnce(&WalletContext) -> Fut,
-        Fut: std::future::Future<Output = anyhow::Result<T>>,
-    {
-        match &self.context {
-            Some(ctx) => f(ctx).await,
-            None => bail!("Wallet not loaded"),
-        }
-    }
-
-    async fn open_wallet(
-        &self,
-        datadir: &Path,
-        mnemonic: Mnemonic,
-        config: Config,
-    ) -> anyhow::Result<(Wallet, OnchainWallet)> {
-        debug!("Opening bark wallet in {}", datadir.display());
-
-        let db = Arc::new(SqliteClient::open(datadir.join(DB_FILE))?);
-        let properties = db
-            .read_properties()
-            .await?
-            .context("Failed to read properties from db for opening wallet")?;
-
-        let onchain_wallet =
-            OnchainWallet::load_or_create(properties.network, mnemonic.to_seed(""), db.clone())
-                .await?;
-        let wallet =
-            Wallet::open_with_onchain(&mnemonic, db.clone(), &onchain_wallet, config).await?;
-
-        Ok((wallet, onchain_wallet))
-    }
 }
 
 impl Default for WalletManager {
@@ -205,14 +396,81 @@ impl Default for WalletManager {
     }
 }
 
+async fn open_wallet(
+    datadir: &Path,
+    mnemonic: Mnemonic,
+    config: Config,
+    storage: &StorageProfile,
+) -> anyhow::Result<(Wallet, OnchainWallet, storage::ConnectionSettings)> {
+    debug!("Opening bark wallet in {}", datadir.display());
+    let mut timer = startup::OpenTimer::start();
+
+    let (db, connection_settings) = storage::open(&datadir.join(DB_FILE), storage)?;
+    let db = Arc::new(db);
+    timer.timings.db_open = timer.phase();
+    let properties = db
+        .read_properties()
+        .await?
+        .context("Failed to read properties from db for opening wallet")?;
+    timer.timings.read_properties = timer.phase();
+
+    let (seed, seed_cached) = startup::seed(&mnemonic);
+    timer.timings.seed = timer.phase();
+    timer.timings.seed_cached = seed_cached;
+
+    let onchain_wallet =
+        OnchainWallet::load_or_create(properties.network, *seed.as_bytes(), db.clone()).await;
+    // Only the onchain wallet needs the seed, wipe our copy right away
+    drop(seed);
+    let onchain_wallet = onchain_wallet?;
+    timer.timings.onchain_load = timer.phase();
+    let wallet = Wallet::open_with_onchain(&mnemonic, db.clone(), &onchain_wallet, config).await?;
+    timer.timings.wallet_open = timer.phase();
+
+    let timings = timer.finish();
+    info!(
+        "Opened wallet in {:?} (db {:?}, properties {:?}, seed {:?}{}, onchain {:?}, wallet {:?})",
+        timings.total,
+        timings.db_open,
+        timings.read_properties,
+        timings.seed,
+        if timings.seed_cached { " cached" } else { "" },
+        timings.onchain_load,
+        timings.wallet_open,
+    );
+
+    Ok((wallet, onchain_wallet, connection_settings))
+}
+
+// Level used until `configure_logging` sets another. Release builds leave out
+// debug lines, which are formatted and shipped to the system log otherwise.
+pub(crate) const DEFAULT_LOG_LEVEL: logger::log::LevelFilter = if cfg!(debug_assertions) {
+    logger::log::LevelFilter::Debug
+} else {
+    logger::log::LevelFilter::Info
+};
+
 // function to explicitly initialize the logger.
 // This should be called once from your FFI entry point.
 pub fn init_logger() {
     LOGGER_INIT.call_once(|| {
-        logger::Logger::new(logger::log::LevelFilter::Debug);
+        logger::Logger::new(DEFAULT_LOG_LEVEL);
     });
 }
 
+/// Replaces the log filter and ring buffer settings, installing the logger
+/// first if needed
+pub fn configure_logging(config: logger::LogConfig) {
+    init_logger();
+    logger::Logger::configure(config);
+}
+
+/// Replaces the log filter, keeping the ring buffer settings
+pub fn set_log_filter(filter: logger::Filter) {
+    init_logger();
+    logger::Logger::set_filter(filter);
+}
+
 pub fn create_mnemonic() -> anyhow::Result<String> {
     info!("Attempting to create a new mnemonic using cxx bridge...");
     let mnemonic = Mnemonic::generate(12).context("failed to generate mnemonic")?;
@@ -221,58 +479,136 @@ pub fn create_mnemonic() -> anyhow::Result<String> {
 }
 
 pub async fn create_wallet(datadir: &Path, opts: CreateOpts) -> anyhow::Result<()> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager.create_wallet(datadir, opts).await
+    let _loading = metrics::lock_wait(WALLET_LOADS.lock()).await;
+    debug!("Creating wallet in {}", datadir.display());
+
+    let (config, net) = merge_config_opts(opts.clone())?;
+
+    try_create_wallet(
+        datadir,
+        net,
+        config.clone(),
+        Some(opts.mnemonic.clone()),
+        &opts.config.storage,
+    )
+    .await?;
+
+    Ok(())
 }
 
-pub async fn load_wallet(datadir: &Path, mnemonic: Mnemonic, config: Config) -> anyhow::Result<()> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager.load_wallet(datadir, mnemonic, config).await
+pub async fn load_wallet(
+    datadir: &Path,
+    mnemonic: Mnemonic,
+    config: Config,
+    storage: StorageProfile,
+) -> anyhow::Result<()> {
+    let _loading = metrics::lock_wait(WALLET_LOADS.lock()).await;
+    if !datadir.exists() {
+        bail!("Datadir does not exist. Please create a new wallet first.");
+    }
+
+    if metrics::lock_wait(GLOBAL_WALLET_MANAGER.write())
+        .await
+        .select_open(datadir)
+    {
+        debug!("Wallet in {} is already open", datadir.display());
+        return Ok(());
+    }
+
+    debug!("Loading wallet in {}", datadir.display());
+
+    info!("Attempting to open wallet...");
+    let (wallet, onchain_wallet, connection_settings) =
+        open_wallet(datadir, mnemonic, config, &storage).await?;
+
+    let mut manager = metrics::lock_wait(GLOBAL_WALLET_MANAGER.write()).await;
+    manager.insert(
+        wallet_key(datadir),
+        WalletContext::new(
+            wallet,
+            onchain_wallet,
+            datadir.to_path_buf(),
+            connection_settings,
+        ),
+    );
+    Ok(())
 }
 
 pub async fn close_wallet() -> anyhow::Result<()> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
+    let mut manager = metrics::lock_wait(GLOBAL_WALLET_MANAGER.write()).await;
     manager.close_wallet()
 }
 
+pub async fn close_wallet_at(datadir: &Path) -> anyhow::Result<()> {
+    let mut manager = metrics::lock_wait(GLOBAL_WALLET_MANAGER.write()).await;
+    manager.close_wallet_at(datadir)
+}
+
+pub async fn select_wallet(datadir: &Path) -> anyhow::Result<()> {
+    let mut manager = metrics::lock_wait(GLOBAL_WALLET_MANAGER.write()).await;
+    manager.select_wallet(datadir)
+}
+
+pub async fn open_wallets() -> Vec<PathBuf> {
+    let manager = wallet_manager().await;
+    manager.open_wallets()
+}
+
 pub async fn is_wallet_loaded() -> bool {
-    let manager = GLOBAL_WALLET_MANAGER.lock().await;
+    let manager = wallet_manager().await;
     manager.is_loaded()
 }
 
 pub async fn balance() -> anyhow::Result<bark::Balance> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
-        .with_context_async(|ctx| async { ctx.wallet.balance().await })
+    let active = active_wallet().await;
+    active
+        .with_context_ref_async(|ctx| async { ctx.wallet.balance().await })
         .await
 }
 
+/// Ark server info, served from the cache in `server` while it is fresh
 pub async fn get_ark_info() -> anyhow::Result<ArkInfo> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    let info = manager
-        .with_context_async(|ctx| async {
-            ctx.wallet
-                .ark_info()
+    server::ark_info().await
+}
+
+/// Everything the wallet overview shows, read in a single pass over the wallet
+pub struct Dashboard {
+    pub balance: bark::Balance,
+    pub onchain_balance: bdk_wallet::Balance,
+    pub ark_info: Option<ArkInfo>,
+    pub next_required_refresh_blockheight: Option<BlockHeight>,
+    pub vtxos: Vec<WalletVtxo>,
+}
+
+pub async fn dashboard() -> anyhow::Result<Dashboard> {
+    // Served from the server info cache like `get_ark_info`, rather than a
+    // round trip to the server on every call
+    let ark_info = server::ark_info().await?;
+    let active = active_wallet().await;
+    active
+        .with_context_ref_async(|ctx| async {
+            let balance = ctx.wallet.balance().await?;
+            let onchain_balance = ctx.onchain_view().balance;
+            let next_required_refresh_blockheight = ctx
+                .wallet
+                .get_next_required_refresh_blockheight()
                 .await
-                .context("Failed to get ark info")
+                .context("Failed to get next required refresh blockheight")?;
+            let vtxos = ctx.wallet.vtxos().await?;
+            Ok(Dashboard {
+                balance,
+                onchain_balance,
+                ark_info: Some(ark_info),
+                next_required_refresh_blockheight,
+                vtxos,
+            })
         })
-        .await;
-
-    match info {
-        Ok(info) => {
-            if let Some(info) = info {
-                Ok(info)
-            } else {
-                bail!("Failed to get ark info, returned as null")
-            }
-        }
-        Err(err) => Err(err),
-    }
+        .await
 }
 
 pub async fn derive_store_next_keypair() -> anyhow::Result<Keypair> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
+    let active = active_wallet().await;
+    active
         .with_context_async(|ctx| async {
             ctx.wallet
                 .derive_store_next_keypair()
@@ -283,9 +619,9 @@ pub async fn derive_store_next_keypair() -> anyhow::Result<Keypair> {
 }
 
 pub async fn peak_keypair(index: u32) -> anyhow::Result<Keypair> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
-        .with_context_async(|ctx| async {
+    let active = active_wallet().await;
+    active
+        .with_context_ref_async(|ctx| async {
             ctx.wallet
                 .peak_keypair(index)
                 .await
@@ -294,9 +630,29 @@ pub async fn peak_keypair(index: u32) -> anyhow::Result<Keypair> {
         .await
 }
 
+/// Peeks the keypairs for `count` indexes starting at `start`
+pub async fn peak_keypairs(start: u32, count: u32) -> anyhow::Result<Vec<Keypair>> {
+    let indexes = keys::range(start, count)?;
+    let active = active_wallet().await;
+    active
+        .with_context_ref_async(|ctx| async {
+            let mut keypairs = Vec::with_capacity(indexes.len());
+            for index in indexes {
+                let keypair = ctx
+                    .wallet
+                    .peak_keypair(index)
+                    .await
+                    .with_context(|| format!("Failed to peak keypair {}", index))?;
+                keypairs.push(keypair);
+            }
+            Ok(keypairs)
+        })
+        .await
+}
+
 pub async fn new_address() -> anyhow::Result<bark::ark::Address> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
+    let active = active_wallet().await;
+    active
         .with_context_async(|ctx| async {
             ctx.wallet
                 .new_address()
@@ -307,9 +663,9 @@ pub async fn new_address() -> anyhow::Result<bark::ark::Address> {
 }
 
 pub async fn peak_address(index: u32) -> anyhow::Result<bark::ark::Address> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
-        .with_context_async(|ctx| async {
+    let active = active_wallet().await;
+    active
+        .with_context_ref_async(|ctx| async {
             ctx.wallet
                 .peak_address(index)
                 .await
@@ -318,9 +674,39 @@ pub async fn peak_address(index: u32) -> anyhow::Result<bark::ark::Address> {
         .await
 }
 
+/// Peeks the addresses for `count` indexes starting at `start`
+pub async fn peak_addresses(start: u32, count: u32) -> anyhow::Result<Vec<bark::ark::Address>> {
+    let indexes = keys::range(start, count)?;
+    let active = active_wallet().await;
+    active
+        .with_context_ref_async(|ctx| async {
+            let mut addresses = Vec::with_capacity(indexes.len());
+            for index in indexes {
+                let address = ctx
+                    .wallet
+                    .peak_address(index)
+                    .await
+                    .with_context(|| format!("Failed to peak address {}", index))?;
+                addresses.push(address);
+            }
+            Ok(addresses)
+        })
+        .await
+}
+
 pub async fn refresh_server() -> anyhow::Result<()> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
+    singleflight::REFRESH_SERVER
+        .run(Duration::ZERO, |active| async move {
+            reconnect_server(&active).await
+        })
+        .await?;
+    // The new connection may come with different server info
+    server::forget();
+    Ok(())
+}
+
+pub(crate) async fn reconnect_server(active: &ActiveWallet) -> anyhow::Result<()> {
+    active
         .with_context_async(|ctx| async {
             ctx.wallet
                 .refresh_server()
@@ -334,9 +720,9 @@ pub async fn sign_message(
     message: &str,
     index: u32,
 ) -> anyhow::Result<bark::ark::bitcoin::secp256k1::ecdsa::Signature> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
-        .with_context_async(|ctx| async {
+    let active = active_wallet().await;
+    active
+        .with_context_ref_async(|ctx| async {
             let wallet = &ctx.wallet;
             let keypair = wallet
                 .peak_keypair(index)
@@ -359,10 +745,8 @@ pub async fn sign_messsage_with_mnemonic(
     index: u32,
 ) -> anyhow::Result<bark::ark::bitcoin::secp256k1::ecdsa::Signature> {
     let secp = bark::ark::bitcoin::secp256k1::Secp256k1::new();
-    let keypair = bip32::Xpriv::new_master(network, &mnemonic.to_seed(""))?
-        .derive_priv(&secp, &[ARK_PURPOSE_INDEX.into()])?
-        .derive_priv(&secp, &[index.into()])?
-        .to_keypair(&secp);
+    let purpose_key = keys::mnemonic_purpose_key(&secp, &mnemonic, network)?;
+    let keypair = keys::derive_keypair(&secp, &purpose_key, index)?;
 
     let hash = bark::ark::bitcoin::sign_message::signed_msg_hash(message);
     let msg = bark::ark::bitcoin::secp256k1::Message::from_digest_slice(&hash[..]).unwrap();
@@ -377,11 +761,20 @@ pub async fn derive_keypair_from_mnemonic(
     index: u32,
 ) -> anyhow::Result<Keypair> {
     let secp = bark::ark::bitcoin::secp256k1::Secp256k1::new();
-    let keypair = bip32::Xpriv::new_master(network, &mnemonic.to_seed(""))?
-        .derive_priv(&secp, &[ARK_PURPOSE_INDEX.into()])?
-        .derive_priv(&secp, &[index.into()])?
-        .to_keypair(&secp);
-    Ok(keypair)
+    let purpose_key = keys::mnemonic_purpose_key(&secp, &mnemonic, network)?;
+    keys::derive_keypair(&secp, &purpose_key, index)
+}
+
+/// Derives the keypairs for `count` indexes starting at `start`
+pub async fn derive_keypairs_from_mnemonic(
+    mnemonic: Mnemonic,
+    network: Network,
+    start: u32,
+    count: u32,
+) -> anyhow::Result<Vec<Keypair>> {
+    let secp = bark::ark::bitcoin::secp256k1::Secp256k1::new();
+    let purpose_key = keys::mnemonic_purpose_key(&secp, &mnemonic, network)?;
+    keys::derive_range(&purpose_key, start, count)
 }
 
 pub async fn verify_message(
@@ -396,8 +789,8 @@ pub async fn verify_message(
 }
 
 pub async fn bolt11_invoice(amount: u64) -> anyhow::Result<Bolt11Invoice> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
+    let active = active_wallet().await;
+    active
         .with_context_async(|ctx| async {
             let invoice = ctx
                 .wallet
@@ -412,9 +805,16 @@ pub async fn bolt11_invoice(amount: u64) -> anyhow::Result<Bolt11Invoice> {
 pub async fn lightning_receive_status(
     payment: PaymentHash,
 ) -> anyhow::Result<Option<LightningReceive>> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
-        .with_context_async(|ctx| async {
+    receive_status_in(&active_wallet().await, payment).await
+}
+
+/// Like `lightning_receive_status`, for a receive of `wallet`
+pub(crate) async fn receive_status_in(
+    wallet: &ActiveWallet,
+    payment: PaymentHash,
+) -> anyhow::Result<Option<LightningReceive>> {
+    wallet
+        .with_context_ref_async(|ctx| async {
             ctx.wallet
                 .lightning_receive_status(payment)
                 .await
@@ -428,23 +828,113 @@ pub async fn try_claim_lightning_receive(
     wait: bool,
     token: Option<String>,
 ) -> anyhow::Result<LightningReceive> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
+    if wait {
+        // Polls instead of waiting inside bark, which would hold the
+        // mutation lock until the invoice is paid
+        let Some(key) = active_wallet_key().await else {
+            bail!("Wallet not loaded");
+        };
+        return lightning_wait::wait_receive(&key, payment_hash, token.as_deref()).await;
+    }
+    let active = active_wallet().await;
+    let receive = active
         .with_context_async(|ctx| async {
             ctx.wallet
                 .try_claim_lightning_receive(payment_hash, wait, token.as_deref())
                 .await
                 .context("Failed to claim bolt11 payment")
         })
+        .await?;
+    if receive.finished_at.is_some() {
+        events::push_lightning_receive_settled(receive.payment_hash.to_string());
+    }
+    Ok(receive)
+}
+
+/// Claims the receive for `payment_hash` of `wallet` without waiting.
+/// `Ok(None)` while its invoice hasn't been paid, a non-blocking claim fails
+/// in that case.
+pub(crate) async fn try_claim_paid_lightning_receive(
+    wallet: &ActiveWallet,
+    payment_hash: PaymentHash,
+    token: Option<&str>,
+) -> anyhow::Result<Option<LightningReceive>> {
+    let receive = wallet
+        .with_context_attempt_async(|ctx| async {
+            let progress = async || {
+                ctx.wallet
+                    .lightning_receive_status(payment_hash)
+                    .await
+                    .ok()
+                    .flatten()
+                    .map(|r| (r.preimage_revealed_at, r.finished_at))
+            };
+            let before = progress().await;
+            match ctx
+                .wallet
+                .try_claim_lightning_receive(payment_hash, false, token)
+                .await
+            {
+                Ok(receive) => (Ok(Some(receive)), true),
+                Err(e) => {
+                    debug!("Lightning receive {} not claimed: {:#}", payment_hash, e);
+                    // A failed claim may still have revealed the preimage
+                    let changed = progress().await != before;
+                    (Ok(None), changed)
+                }
+            }
+        })
+        .await?;
+    if let Some(receive) = &receive {
+        if receive.finished_at.is_some() {
+            events::push_lightning_receive_settled(receive.payment_hash.to_string());
+        }
+    }
+    Ok(receive)
+}
+
+/// Checks an outgoing payment of `wallet` without waiting. `Ok(None)` while
+/// it is in flight, which leaves the wallet untouched.
+pub(crate) async fn poll_lightning_payment(
+    wallet: &ActiveWallet,
+    payment_hash: PaymentHash,
+) -> anyhow::Result<Option<Preimage>> {
+    wallet
+        .with_context_attempt_async(|ctx| async {
+            let result = ctx
+                .wallet
+                .check_lightning_payment(payment_hash, false)
+                .await;
+            let changed = !matches!(result, Ok(None));
+            (result, changed)
+        })
         .await
 }
 
 pub async fn try_claim_all_lightning_receives(wait: bool) -> anyhow::Result<()> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
+    let active = active_wallet().await;
+    if wait {
+        // bark waits for every open invoice in this call. Doing that under
+        // the mutation lock would block every other mutation until the last
+        // one is paid, so it only takes shared access and reports the change
+        // once it returns.
+        let result = active
+            .with_context_ref_async(|ctx| async {
+                ctx.wallet
+                    .try_claim_all_lightning_receives(true)
+                    .await
+                    .context("Failed to claim all open invoices")?;
+                Ok(())
+            })
+            .await;
+        snapshot::invalidate();
+        events::schedule_refresh();
+        return result;
+    }
+    active
         .with_context_async(|ctx| async {
             ctx.wallet
-                .try_claim_all_lightning_receives(wait)
+                .try_claim_all_lightning_receives(false)
                 .await
                 .context("Failed to claim all open invoices")?;
             Ok(())
@@ -453,8 +943,8 @@ pub async fn try_claim_all_lightning_receives(wait: bool) -> anyhow::Result<()>
 }
 
 pub async fn sync_pending_boards() -> anyhow::Result<()> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
+    let active = active_wallet().await;
+    active
         .with_context_async(|ctx| async {
             ctx.wallet
                 .sync_pending_boards()
@@ -466,21 +956,24 @@ pub async fn sync_pending_boards() -> anyhow::Result<()> {
 }
 
 pub async fn maintenance() -> anyhow::Result<()> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
-        .with_context_async(|ctx| async {
-            ctx.wallet
-                .maintenance()
+    singleflight::MAINTENANCE
+        .run(Duration::ZERO, |active| async move {
+            active
+                .with_context_async(|ctx| async {
+                    ctx.wallet
+                        .maintenance()
+                        .await
+                        .context("Failed to perform wallet maintenance")?;
+                    Ok(())
+                })
                 .await
-                .context("Failed to perform wallet maintenance")?;
-            Ok(())
         })
         .await
 }
 
 pub async fn maintenance_delegated() -> anyhow::Result<()> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
+    let active = active_wallet().await;
+    active
         .with_context_async(|ctx| async {
             ctx.wallet
                 .maintenance_delegated()
@@ -491,35 +984,55 @@ pub async fn maintenance_delegated() -> anyhow::Result<()> {
         .await
 }
 
+/// Runs every maintenance stage. A cancellation or deadline lets the
+/// running stage finish and skips the rest.
 pub async fn maintenance_with_onchain() -> anyhow::Result<()> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
+    use scheduler::{STAGE_BOARDS, STAGE_EXITS, STAGE_ONCHAIN, STAGE_REFRESH, STAGE_ROUNDS};
+
+    let active = active_wallet().await;
+    active
         .with_context_async(|ctx| async {
-            ctx.wallet
-                .maintenance_with_onchain(&mut ctx.onchain_wallet)
+            cancel::step(ctx.wallet.sync()).await;
+            let tip = ctx
+                .wallet
+                .chain
+                .tip()
                 .await
-                .context("Failed to perform wallet maintenance with onchain")?;
+                .context("Failed to get chain tip")?;
+            for stage in [
+                STAGE_ONCHAIN,
+                STAGE_BOARDS,
+                STAGE_ROUNDS,
+                STAGE_EXITS,
+                STAGE_REFRESH,
+            ] {
+                cancel::checkpoint()?;
+                cancel::step(scheduler::run_stage(ctx, stage, tip)).await?;
+            }
             Ok(())
         })
         .await
 }
 
 pub async fn maintenance_with_onchain_delegated() -> anyhow::Result<()> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
+    let active = active_wallet().await;
+    active
         .with_context_async(|ctx| async {
+            let mut onchain_wallet = ctx.onchain_write().await;
             ctx.wallet
-                .maintenance_with_onchain_delegated(&mut ctx.onchain_wallet)
+                .maintenance_with_onchain_delegated(&mut onchain_wallet)
                 .await
                 .context("Failed to perform wallet maintenance with onchain delegated")?;
+            drop(onchain_wallet);
+            onchain::record_sync_checkpoint(ctx).await;
             Ok(())
         })
         .await
 }
 
 pub async fn maintenance_refresh() -> anyhow::Result<()> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
+    let active = active_wallet().await;
+    active
         .with_context_async(|ctx| async {
             ctx.wallet
                 .maintenance_refresh()
@@ -531,34 +1044,52 @@ pub async fn maintenance_refresh() -> anyhow::Result<()> {
 }
 
 pub async fn sync() -> anyhow::Result<()> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
-        .with_context_async(|ctx| async {
-            ctx.wallet.sync().await;
-            Ok(())
+    singleflight::SYNC
+        .run(Duration::ZERO, |active| async move {
+            active
+                .with_context_async(|ctx| async {
+                    ctx.wallet.sync().await;
+                    Ok(())
+                })
+                .await
         })
         .await
 }
 
 pub async fn history() -> anyhow::Result<Vec<Movement>> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
-        .with_context_async(|ctx| async { ctx.wallet.history().await })
+    let active = active_wallet().await;
+    active
+        .with_context_ref_async(|ctx| async { ctx.wallet.history().await })
         .await
 }
 
+/// Returns one page of movements matching `query`, newest first, and whether
+/// more matching movements remain after it.
+pub async fn history_page(query: HistoryQuery) -> anyhow::Result<(Vec<Movement>, bool)> {
+    let active = active_wallet().await;
+    let mut movements = active
+        .with_context_ref_async(|ctx| async { ctx.wallet.history().await })
+        .await?;
+    drop(active);
+
+    movements.retain(|m| query.matches(m));
+    movements.sort_unstable_by(|a, b| b.id.0.cmp(&a.id.0));
+    let has_more = movements.len() > query.limit;
+    movements.truncate(query.limit);
+    Ok((movements, has_more))
+}
+
 pub async fn vtxos() -> anyhow::Result<Vec<WalletVtxo>> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
-        .with_context_async(|ctx| async { ctx.wallet.vtxos().await })
+    let active = active_wallet().await;
+    active
+        .with_context_ref_async(|ctx| async { ctx.wallet.vtxos().await })
         .await
 }
 
 pub async fn get_expiring_vtxos(threshold: BlockHeight) -> anyhow::Result<Vec<WalletVtxo>> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-
-    manager
-        .with_context_async(|ctx| async {
+    let active = active_wallet().await;
+    active
+        .with_context_ref_async(|ctx| async {
             ctx.wallet
                 .get_expiring_vtxos(threshold)
                 .await
@@ -568,22 +1099,26 @@ pub async fn get_expiring_vtxos(threshold: BlockHeight) -> anyhow::Result<Vec<Wa
 }
 
 pub async fn refresh_vtxos(vtxos: Vec<Vtxo>) -> anyhow::Result<Option<RoundStatus>> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
+    let active = active_wallet().await;
+    let status = active
         .with_context_async(|ctx| async {
             ctx.wallet
                 .refresh_vtxos(vtxos)
                 .await
                 .context("Failed to refresh vtxos")
         })
-        .await
+        .await?;
+    if let Some(status) = &status {
+        events::push_round_status(status);
+    }
+    Ok(status)
 }
 
 /// Returns the block height at which the first VTXO will expire
 pub async fn get_first_expiring_vtxo_blockheight() -> anyhow::Result<Option<BlockHeight>> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
-        .with_context_async(|ctx| async {
+    let active = active_wallet().await;
+    active
+        .with_context_ref_async(|ctx| async {
             ctx.wallet
                 .get_first_expiring_vtxo_blockheight()
                 .await
@@ -595,9 +1130,9 @@ pub async fn get_first_expiring_vtxo_blockheight() -> anyhow::Result<Option<Bloc
 /// Returns the next block height at which we have a VTXO that we
 /// want to refresh
 pub async fn get_next_required_refresh_blockheight() -> anyhow::Result<Option<BlockHeight>> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
-        .with_context_async(|ctx| async {
+    let active = active_wallet().await;
+    active
+        .with_context_ref_async(|ctx| async {
             ctx.wallet
                 .get_next_required_refresh_blockheight()
                 .await
@@ -607,27 +1142,30 @@ pub async fn get_next_required_refresh_blockheight() -> anyhow::Result<Option<Bl
 }
 
 pub async fn board_amount(amount: Amount) -> anyhow::Result<PendingBoard> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
+    let active = active_wallet().await;
+    active
         .with_context_async(|ctx| async {
-            ctx.wallet
-                .board_amount(&mut ctx.onchain_wallet, amount)
-                .await
+            let mut onchain_wallet = ctx.onchain_write().await;
+            ctx.wallet.board_amount(&mut onchain_wallet, amount).await
         })
         .await
 }
 
 pub async fn board_all() -> anyhow::Result<PendingBoard> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
-        .with_context_async(|ctx| async { ctx.wallet.board_all(&mut ctx.onchain_wallet).await })
+    let active = active_wallet().await;
+    active
+        .with_context_async(|ctx| async {
+            let mut onchain_wallet = ctx.onchain_write().await;
+            cancel::commit();
+            ctx.wallet.board_all(&mut onchain_wallet).await
+        })
         .await
 }
 
 pub async fn validate_arkoor_address(address: bark::ark::Address) -> anyhow::Result<()> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
-        .with_context_async(|ctx| async {
+    let active = active_wallet().await;
+    active
+        .with_context_ref_async(|ctx| async {
             ctx.wallet
                 .validate_arkoor_address(&address)
                 .await
@@ -640,8 +1178,8 @@ pub async fn send_arkoor_payment(
     destination: bark::ark::Address,
     amount_sat: Amount,
 ) -> anyhow::Result<Vec<Vtxo>> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
+    let active = active_wallet().await;
+    active
         .with_context_async(|ctx| async {
             info!(
                 "Attempting to send OOR payment of {} to pubkey {:?}",
@@ -656,12 +1194,59 @@ pub async fn send_arkoor_payment(
         .await
 }
 
+/// Sends arkoor payments to several destinations while holding the wallet
+/// lock once. The whole batch is validated and checked against the spendable
+/// balance before anything is sent, after that every output is attempted and
+/// gets its own result.
+pub async fn send_arkoor_many(
+    outputs: Vec<(bark::ark::Address, Amount)>,
+) -> anyhow::Result<Vec<anyhow::Result<Vec<Vtxo>>>> {
+    let active = active_wallet().await;
+    active
+        .with_context_async(|ctx| async {
+            for (destination, _) in &outputs {
+                ctx.wallet
+                    .validate_arkoor_address(destination)
+                    .await
+                    .with_context(|| format!("Invalid arkoor destination {}", destination))?;
+            }
+            let total = outputs.iter().map(|(_, amount)| *amount).sum::<Amount>();
+            let spendable = ctx.wallet.balance().await?.spendable;
+            if total > spendable {
+                bail!(
+                    "Batch of {} needs {}, only {} is spendable",
+                    outputs.len(),
+                    total,
+                    spendable
+                );
+            }
+
+            info!("Sending {} OOR payments totalling {}", outputs.len(), total);
+            let mut results = Vec::with_capacity(outputs.len());
+            for (destination, amount) in &outputs {
+                results.push(ctx.wallet.send_arkoor_payment(destination, *amount).await);
+            }
+            Ok(results)
+        })
+        .await
+}
+
 pub async fn check_lightning_payment(
     payment_hash: PaymentHash,
     wait: bool,
 ) -> anyhow::Result<Option<Preimage>> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
+    if wait {
+        // Polls instead of waiting inside bark, which would hold the
+        // mutation lock until the payment settles
+        let Some(key) = active_wallet_key().await else {
+            bail!("Wallet not loaded");
+        };
+        return lightning_wait::wait_payment(&key, payment_hash)
+            .await
+            .map(Some);
+    }
+    let active = active_wallet().await;
+    active
         .with_context_async(|ctx| async {
             ctx.wallet.check_lightning_payment(payment_hash, wait).await
         })
@@ -672,8 +1257,8 @@ pub async fn pay_lightning_invoice(
     destination: lightning::Invoice,
     amount_sat: Option<Amount>,
 ) -> anyhow::Result<LightningSend> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
+    let active = active_wallet().await;
+    active
         .with_context_async(|ctx| async {
             ctx.wallet
                 .pay_lightning_invoice(destination, amount_sat)
@@ -682,61 +1267,108 @@ pub async fn pay_lightning_invoice(
         .await
 }
 
+/// Pays several invoices while holding the wallet lock once. The whole batch
+/// is checked for expired or amountless invoices and against the spendable
+/// balance before anything is paid, after that every invoice is attempted and
+/// gets its own result. A payment the server fails mid-batch leaves the
+/// earlier ones paid, so callers must inspect each result.
+pub async fn pay_lightning_invoices(
+    payments: Vec<(lightning::Invoice, Option<Amount>)>,
+) -> anyhow::Result<Vec<anyhow::Result<LightningSend>>> {
+    let active = active_wallet().await;
+    active
+        .with_context_async(|ctx| async {
+            let mut total = Amount::ZERO;
+            for (i, (invoice, amount)) in payments.iter().enumerate() {
+                let (amount_msat, expires_at) = destination::invoice_terms(invoice);
+                if destination::expired(expires_at) {
+                    bail!("Invoice {} of the batch has expired", i);
+                }
+                total += match (amount, amount_msat) {
+                    (Some(amount), _) => *amount,
+                    (None, Some(msat)) => Amount::from_sat(msat.div_ceil(1000)),
+                    (None, None) => bail!(
+                        "Invoice {} of the batch has no amount and none was given",
+                        i
+                    ),
+                };
+            }
+            let spendable = ctx.wallet.balance().await?.spendable;
+            if total > spendable {
+                bail!(
+                    "Batch of {} needs {}, only {} is spendable",
+                    payments.len(),
+                    total,
+                    spendable
+                );
+            }
+
+            info!("Paying {} invoices totalling {}", payments.len(), total);
+            let mut results = Vec::with_capacity(payments.len());
+            for (invoice, amount) in payments {
+                results.push(ctx.wallet.pay_lightning_invoice(invoice, amount).await);
+            }
+            Ok(results)
+        })
+        .await
+}
+
 pub async fn pay_lightning_offer(
     offer: Offer,
     amount: Option<Amount>,
 ) -> anyhow::Result<LightningSend> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
+    let active = active_wallet().await;
+    active
         .with_context_async(|ctx| async { ctx.wallet.pay_lightning_offer(offer, amount).await })
         .await
 }
 
 pub async fn send_onchain(addr: Address, amount: Amount) -> anyhow::Result<Txid> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
+    let active = active_wallet().await;
+    active
         .with_context_async(|ctx| async { ctx.wallet.send_onchain(addr, amount).await })
         .await
 }
 
 pub async fn pay_lightning_address(
-    addr: &str,
+    addr: LightningAddress,
     amount: Amount,
     comment: Option<&str>,
 ) -> anyhow::Result<LightningSend> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
+    let active = active_wallet().await;
+    active
         .with_context_async(|ctx| async {
-            let lightning_address = LightningAddress::from_str(addr)
-                .with_context(|| format!("Invalid Lightning Address format: '{}'", addr))?;
-
             ctx.wallet
-                .pay_lightning_address(&lightning_address, amount, comment)
+                .pay_lightning_address(&addr, amount, comment)
                 .await
         })
         .await
 }
 
 pub async fn offboard_specific(vtxo_ids: Vec<VtxoId>, address: Address) -> anyhow::Result<Txid> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
+    let active = active_wallet().await;
+    active
         .with_context_async(|ctx| async { ctx.wallet.offboard_vtxos(vtxo_ids, address).await })
         .await
 }
 
 pub async fn offboard_all(address: Address) -> anyhow::Result<Txid> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
-        .with_context_async(|ctx| async { ctx.wallet.offboard_all(address).await })
+    let active = active_wallet().await;
+    active
+        .with_context_async(|ctx| async {
+            cancel::commit();
+            ctx.wallet.offboard_all(address).await
+        })
         .await
 }
 
 pub async fn sync_exits() -> anyhow::Result<()> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
+    let active = active_wallet().await;
+    active
         .with_context_async(|ctx| async {
-            ctx.wallet
-                .sync_exits(&mut ctx.onchain_wallet)
+            let mut onchain_wallet = ctx.onchain_write().await;
+            // bark progresses all exits in one call, so that is the step
+            cancel::step(ctx.wallet.sync_exits(&mut onchain_wallet))
                 .await
                 .context("Failed to sync exits")?;
             Ok(())
@@ -745,8 +1377,8 @@ pub async fn sync_exits() -> anyhow::Result<()> {
 }
 
 pub async fn sync_pending_rounds() -> anyhow::Result<()> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
+    let active = active_wallet().await;
+    active
         .with_context_async(|ctx| async {
             ctx.wallet
                 .sync_pending_rounds()
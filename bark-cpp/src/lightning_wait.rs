@@ -0,0 +1,244 @@
+//! Lightning waits that run as tasks on the runtime instead of parking a
+//! bridge thread for the lifetime of a payment.
+//!
+//! Each wait polls the wallet with non-blocking checks, so the wallet locks
+//! are only held for the duration of a single check and never while sleeping.
+//! A receive is first looked up read-only, and a claim that finds the invoice
+//! unpaid leaves the cached snapshot and the event baseline alone, so a
+//! pending wait doesn't make the rest of the wallet reload on every poll.
+//! A wait keeps polling the wallet that was active when it started, also
+//! after another wallet is selected, and fails once that wallet is closed.
+//! Blocking waits made through the bridge (`wait = true`) poll the same way
+//! on the calling thread, so they don't hold the wallet either.
+//! Finished waits are queued until the bridge collects them with
+//! `wait_for_completions`, which lets one native thread settle any number of
+//! pending promises.
+
+use std::collections::HashMap;
+use std::future::Future;
+use std::path::{Path, PathBuf};
+use std::sync::{Condvar, LazyLock, Mutex, MutexGuard};
+use std::time::Duration;
+
+use anyhow::{anyhow, bail};
+use bark::ark::bitcoin::hex::DisplayHex;
+use bark::ark::lightning::{PaymentHash, Preimage};
+use bark::persist::models::LightningReceive;
+use logger::log::debug;
+use tokio::sync::oneshot;
+
+use crate::cxx::ffi::LightningWaitResult;
+
+const POLL_INTERVAL_MIN: Duration = Duration::from_millis(500);
+const POLL_INTERVAL_MAX: Duration = Duration::from_secs(5);
+
+enum Settled {
+    Payment(Preimage),
+    Receive(LightningReceive),
+}
+
+struct Pending {
+    payment_hash: String,
+    cancel: Option<oneshot::Sender<()>>,
+}
+
+#[derive(Default)]
+struct WaitState {
+    next_id: u64,
+    pending: HashMap<u64, Pending>,
+    completed: Vec<(u64, anyhow::Result<Settled>)>,
+}
+
+static WAITS: LazyLock<(Mutex<WaitState>, Condvar)> =
+    LazyLock::new(|| (Mutex::new(WaitState::default()), Condvar::new()));
+
+fn state() -> MutexGuard<'static, WaitState> {
+    WAITS.0.lock().unwrap_or_else(|e| e.into_inner())
+}
+
+/// Waits until the outgoing payment for `payment_hash` of the wallet under
+/// `wallet_key` has settled and resolves with its preimage.
+pub(crate) fn start_check_payment(wallet_key: PathBuf, payment_hash: PaymentHash) -> u64 {
+    start(payment_hash, move || {
+        let wallet_key = wallet_key.clone();
+        async move {
+            let preimage = poll_payment(&wallet_key, payment_hash).await?;
+            Ok(preimage.map(Settled::Payment))
+        }
+    })
+}
+
+/// Waits until the incoming payment for `payment_hash` of the wallet under
+/// `wallet_key` could be claimed.
+pub(crate) fn start_claim_receive(
+    wallet_key: PathBuf,
+    payment_hash: PaymentHash,
+    token: Option<String>,
+) -> u64 {
+    start(payment_hash, move || {
+        let wallet_key = wallet_key.clone();
+        let token = token.clone();
+        async move {
+            let receive = poll_receive(&wallet_key, payment_hash, token.as_deref()).await?;
+            Ok(receive.map(Settled::Receive))
+        }
+    })
+}
+
+/// Like `start_check_payment`, for callers that block on the outcome
+pub(crate) async fn wait_payment(
+    wallet_key: &Path,
+    payment_hash: PaymentHash,
+) -> anyhow::Result<Preimage> {
+    poll_until_settled(|| poll_payment(wallet_key, payment_hash)).await
+}
+
+/// Like `start_claim_receive`, for callers that block on the outcome
+pub(crate) async fn wait_receive(
+    wallet_key: &Path,
+    payment_hash: PaymentHash,
+    token: Option<&str>,
+) -> anyhow::Result<LightningReceive> {
+    poll_until_settled(|| poll_receive(wallet_key, payment_hash, token)).await
+}
+
+async fn poll_payment(
+    wallet_key: &Path,
+    payment_hash: PaymentHash,
+) -> anyhow::Result<Option<Preimage>> {
+    let wallet = crate::wallet_at(wallet_key).await?;
+    crate::poll_lightning_payment(&wallet, payment_hash).await
+}
+
+async fn poll_receive(
+    wallet_key: &Path,
+    payment_hash: PaymentHash,
+    token: Option<&str>,
+) -> anyhow::Result<Option<LightningReceive>> {
+    let wallet = crate::wallet_at(wallet_key).await?;
+    // Settled by an earlier poll, another claim or maintenance
+    let Some(receive) = crate::receive_status_in(&wallet, payment_hash).await? else {
+        bail!("No lightning receive for {}", payment_hash);
+    };
+    if receive.finished_at.is_some() {
+        return Ok(Some(receive));
+    }
+    if receive.preimage_revealed_at.is_none() && receive.invoice.is_expired() {
+        bail!("Invoice for {} expired before it was paid", payment_hash);
+    }
+
+    let receive = crate::try_claim_paid_lightning_receive(&wallet, payment_hash, token)
+        .await?
+        .filter(|r| r.finished_at.is_some());
+    Ok(receive)
+}
+
+fn start<F, Fut>(payment_hash: PaymentHash, attempt: F) -> u64
+where
+    F: FnMut() -> Fut + Send + 'static,
+    Fut: Future<Output = anyhow::Result<Option<Settled>>> + Send,
+{
+    let (cancel_tx, cancel_rx) = oneshot::channel();
+    let request_id = {
+        let mut state = state();
+        state.next_id += 1;
+        let request_id = state.next_id;
+        state.pending.insert(
+            request_id,
+            Pending {
+                payment_hash: payment_hash.to_string(),
+                cancel: Some(cancel_tx),
+            },
+        );
+        request_id
+    };
+
+    crate::TOKIO_RUNTIME.spawn(async move {
+        let result = tokio::select! {
+            result = poll_until_settled(attempt) => result,
+            _ = cancel_rx => Err(anyhow!("Lightning wait for {} was cancelled", payment_hash)),
+        };
+        complete(request_id, result);
+    });
+    request_id
+}
+
+async fn poll_until_settled<T, F, Fut>(mut attempt: F) -> anyhow::Result<T>
+where
+    F: FnMut() -> Fut,
+    Fut: Future<Output = anyhow::Result<Option<T>>>,
+{
+    let mut interval = POLL_INTERVAL_MIN;
+    loop {
+        if let Some(settled) = attempt().await? {
+            return Ok(settled);
+        }
+        tokio::time::sleep(interval).await;
+        interval = (interval * 2).min(POLL_INTERVAL_MAX);
+    }
+}
+
+fn complete(request_id: u64, result: anyhow::Result<Settled>) {
+    {
+        let mut state = state();
+        state.pending.remove(&request_id);
+        state.completed.push((request_id, result));
+    }
+    WAITS.1.notify_all();
+}
+
+/// Cancels every pending wait for `payment_hash`. The cancelled waits still
+/// complete, with an error. Returns how many waits were cancelled.
+pub(crate) fn cancel(payment_hash: &str) -> u32 {
+    let mut state = state();
+    let mut cancelled = 0;
+    for pending in state.pending.values_mut() {
+        if pending.payment_hash == payment_hash {
+            if let Some(cancel) = pending.cancel.take() {
+                let _ = cancel.send(());
+                cancelled += 1;
+            }
+        }
+    }
+    debug!(
+        "Cancelled {} lightning waits for {}",
+        cancelled, payment_hash
+    );
+    cancelled
+}
+
+/// Blocks for up to `timeout` until at least one wait has finished and
+/// returns all finished waits.
+pub(crate) fn wait_for_completions(timeout: Duration) -> Vec<LightningWaitResult> {
+    let (_, condvar) = &*WAITS;
+    let (mut state, _) = condvar
+        .wait_timeout_while(state(), timeout, |s| s.completed.is_empty())
+        .unwrap_or_else(|e| e.into_inner());
+    let completed = std::mem::take(&mut state.completed);
+    drop(state);
+
+    completed
+        .into_iter()
+        .map(|(request_id, result)| to_ffi(request_id, result))
+        .collect()
+}
+
+fn to_ffi(request_id: u64, result: anyhow::Result<Settled>) -> LightningWaitResult {
+    let mut ffi_result = LightningWaitResult {
+        request_id,
+        error: String::new(),
+        preimage: String::new(),
+        receive: std::ptr::null(),
+    };
+    match result {
+        Ok(Settled::Payment(preimage)) => {
+            ffi_result.preimage = preimage.to_lower_hex_string();
+        }
+        Ok(Settled::Receive(receive)) => {
+            let receive = crate::utils::lightning_receive_to_ffi(&receive);
+            ffi_result.receive = Box::into_raw(Box::new(receive));
+        }
+        Err(e) => ffi_result.error = format!("{:#}", e),
+    }
+    ffi_result
+}
@@ -0,0 +1,147 @@
+//! Opt-in latency metrics for the bridge, kept per FFI function.
+//!
+//! Each call is split into four phases:
+//! - queue wait: from the JS call until a native thread picks it up
+//! - lock wait: waiting for the wallet manager and the mutation lock
+//! - execution: the rest of the time spent in Rust
+//! - conversion: native time outside Rust, mostly converting the result
+//!
+//! Queue wait and conversion are measured by the C++ side and reported
+//! through `record_bridge_timing`, which attributes them to the last Rust
+//! call made on the reporting thread since `begin_bridge_call`. While metrics are disabled every hook
+//! is a single relaxed atomic load.
+
+use std::cell::Cell;
+use std::collections::HashMap;
+use std::future::Future;
+use std::sync::atomic::{AtomicBool, Ordering};
+use std::sync::{LazyLock, Mutex, MutexGuard};
+use std::time::{Duration, Instant};
+
+/// Bucket `i` counts samples below 2^i microseconds, the last bucket
+/// everything above
+pub(crate) const HISTOGRAM_BUCKETS: usize = 24;
+
+#[derive(Clone, Debug, Default, PartialEq)]
+pub struct Histogram {
+    pub count: u64,
+    pub sum_us: u64,
+    pub max_us: u64,
+    pub buckets: [u64; HISTOGRAM_BUCKETS],
+}
+
+impl Histogram {
+    pub(crate) fn bucket_index(us: u64) -> usize {
+        // The number of bits needed for `us` is the first power of two above it
+        let bits = (u64::BITS - us.leading_zeros()) as usize;
+        bits.min(HISTOGRAM_BUCKETS - 1)
+    }
+
+    pub(crate) fn record(&mut self, duration: Duration) {
+        let us = duration.as_micros().min(u64::MAX as u128) as u64;
+        self.count += 1;
+        self.sum_us = self.sum_us.saturating_add(us);
+        self.max_us = self.max_us.max(us);
+        self.buckets[Self::bucket_index(us)] += 1;
+    }
+}
+
+#[derive(Clone, Debug, Default)]
+pub struct CallMetrics {
+    pub queue_wait: Histogram,
+    pub lock_wait: Histogram,
+    pub execution: Histogram,
+    pub conversion: Histogram,
+}
+
+static ENABLED: AtomicBool = AtomicBool::new(false);
+static METRICS: LazyLock<Mutex<HashMap<&'static str, CallMetrics>>> =
+    LazyLock::new(|| Mutex::new(HashMap::new()));
+
+thread_local! {
+    static LOCK_WAIT: Cell<Duration> = const { Cell::new(Duration::ZERO) };
+    // Last call made on this thread and the time spent in Rust since the
+    // bridge last reported, which covers every Rust call one bridge call makes
+    static LAST_CALL: Cell<Option<(&'static str, Duration)>> = const { Cell::new(None) };
+}
+
+fn metrics() -> MutexGuard<'static, HashMap<&'static str, CallMetrics>> {
+    METRICS.lock().unwrap_or_else(|e| e.into_inner())
+}
+
+pub(crate) fn enabled() -> bool {
+    ENABLED.load(Ordering::Relaxed)
+}
+
+pub(crate) fn set_enabled(enabled: bool) {
+    ENABLED.store(enabled, Ordering::Relaxed);
+}
+
+pub(crate) fn reset() {
+    metrics().clear();
+}
+
+pub(crate) fn snapshot() -> Vec<(&'static str, CallMetrics)> {
+    let mut calls = metrics()
+        .iter()
+        .map(|(name, m)| (*name, m.clone()))
+        .collect::<Vec<_>>();
+    calls.sort_unstable_by_key(|(name, _)| *name);
+    calls
+}
+
+/// Runs `future` on the runtime like `TOKIO_RUNTIME.block_on`, recording its
+/// lock wait and execution time under `name`.
+pub(crate) fn block_on<F: Future>(name: &'static str, future: F) -> F::Output {
+    let run = || crate::alloc_stats::track_call(name, || crate::TOKIO_RUNTIME.block_on(future));
+    if !enabled() {
+        return run();
+    }
+
+    LOCK_WAIT.set(Duration::ZERO);
+    let started = Instant::now();
+    let output = run();
+    let elapsed = started.elapsed();
+    let lock_wait = LOCK_WAIT.replace(Duration::ZERO).min(elapsed);
+
+    let mut metrics = metrics();
+    let call = metrics.entry(name).or_default();
+    call.lock_wait.record(lock_wait);
+    call.execution.record(elapsed - lock_wait);
+    drop(metrics);
+    let in_rust = LAST_CALL.get().map_or(Duration::ZERO, |(_, d)| d);
+    LAST_CALL.set(Some((name, in_rust + elapsed)));
+    output
+}
+
+/// Awaits `future`, counting the time as lock wait of the current call
+pub(crate) async fn lock_wait<F: Future>(future: F) -> F::Output {
+    if !enabled() {
+        return future.await;
+    }
+    let started = Instant::now();
+    let output = future.await;
+    LOCK_WAIT.set(LOCK_WAIT.get() + started.elapsed());
+    output
+}
+
+/// Forgets the last call made on this thread, so Rust calls made outside the
+/// bridge are not attributed to the next bridge call
+pub(crate) fn begin_bridge_call() {
+    LAST_CALL.set(None);
+}
+
+/// Records the phases the bridge measured around the last call made on this
+/// thread: how long it was queued, and its total native time.
+pub(crate) fn record_bridge_timing(queue_wait: Duration, total: Duration) {
+    let Some((name, in_rust)) = LAST_CALL.take() else {
+        return;
+    };
+    if !enabled() {
+        return;
+    }
+    let mut metrics = metrics();
+    let call = metrics.entry(name).or_default();
+    call.queue_wait.record(queue_wait);
+    call.conversion.record(total.saturating_sub(in_rust));
+}
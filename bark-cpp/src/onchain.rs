@@ -1,67 +1,156 @@
-use bark::onchain::{ChainSync, Utxo};
+use std::ops::{Deref, DerefMut};
+use std::path::Path;
+use std::sync::Arc;
+use std::time::{Duration, Instant, SystemTime, UNIX_EPOCH};
+
+use anyhow::Context;
+use bark::onchain::{ChainSync, OnchainWallet, Utxo};
+use bdk_wallet::LocalOutput;
 use bdk_wallet::bitcoin::{Address, Amount, FeeRate, Txid};
+use bitcoin_ext::BlockHeight;
+use logger::log::{debug, warn};
+use tokio::fs;
+use tokio::sync::RwLockWriteGuard;
+
+use crate::{ActiveWallet, WalletContext, active_wallet, events};
+
+const CHECKPOINT_FILE: &str = "onchain_checkpoint.json";
+
+/// Mempool transactions are only picked up by a sync, so a sync is never
+/// skipped for longer than this even if no block was mined.
+const MAX_SKIP_AGE: Duration = Duration::from_secs(10 * 60);
+
+/// Balance and outputs of the onchain wallet, read after each change to it
+#[derive(Clone)]
+pub struct OnchainView {
+    pub balance: bdk_wallet::Balance,
+    pub unspent: Arc<[LocalOutput]>,
+    pub utxos: Arc<[Utxo]>,
+}
+
+impl OnchainView {
+    pub(crate) fn read(wallet: &OnchainWallet) -> Self {
+        OnchainView {
+            balance: wallet.balance(),
+            unspent: wallet.list_unspent().into(),
+            utxos: wallet.utxos().into(),
+        }
+    }
+}
+
+/// Exclusive access to the onchain wallet that refreshes the view of its
+/// context when dropped, including when the future holding it is dropped
+pub(crate) struct OnchainWriteGuard<'a> {
+    wallet: RwLockWriteGuard<'a, OnchainWallet>,
+    view: &'a std::sync::RwLock<OnchainView>,
+}
+
+impl<'a> OnchainWriteGuard<'a> {
+    pub(crate) fn new(
+        wallet: RwLockWriteGuard<'a, OnchainWallet>,
+        view: &'a std::sync::RwLock<OnchainView>,
+    ) -> Self {
+        OnchainWriteGuard { wallet, view }
+    }
+}
+
+impl Deref for OnchainWriteGuard<'_> {
+    type Target = OnchainWallet;
+
+    fn deref(&self) -> &OnchainWallet {
+        &self.wallet
+    }
+}
+
+impl DerefMut for OnchainWriteGuard<'_> {
+    fn deref_mut(&mut self) -> &mut OnchainWallet {
+        &mut self.wallet
+    }
+}
 
-use crate::GLOBAL_WALLET_MANAGER;
+impl Drop for OnchainWriteGuard<'_> {
+    fn drop(&mut self) {
+        let view = OnchainView::read(&self.wallet);
+        *self.view.write().unwrap_or_else(|e| e.into_inner()) = view;
+    }
+}
 
 /// Get onchain balance
 pub async fn onchain_balance() -> anyhow::Result<bdk_wallet::Balance> {
-    let manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager.with_context_ref(|ctx| Ok(ctx.onchain_wallet.balance()))
+    let active = active_wallet().await;
+    active
+        .with_context_ref_async(|ctx| async { Ok(ctx.onchain_view().balance) })
+        .await
 }
 
 /// Get a new address
 pub async fn address() -> anyhow::Result<Address> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
-        .with_context_async(|ctx| async { ctx.onchain_wallet.address().await })
+    let active = active_wallet().await;
+    active
+        .with_context_async(|ctx| async { ctx.onchain_write().await.address().await })
         .await
 }
 
 /// Get unspent outputs
-pub async fn list_unspent() -> anyhow::Result<Vec<bdk_wallet::LocalOutput>> {
-    let manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager.with_context_ref(|ctx| Ok(ctx.onchain_wallet.list_unspent()))
+pub async fn list_unspent() -> anyhow::Result<Arc<[LocalOutput]>> {
+    let active = active_wallet().await;
+    active
+        .with_context_ref_async(|ctx| async { Ok(ctx.onchain_view().unspent) })
+        .await
 }
 
 /// Get utxos
-pub async fn utxos() -> anyhow::Result<Vec<Utxo>> {
-    let manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager.with_context_ref(|ctx| Ok(ctx.onchain_wallet.utxos()))
+pub async fn utxos() -> anyhow::Result<Arc<[Utxo]>> {
+    let active = active_wallet().await;
+    active
+        .with_context_ref_async(|ctx| async { Ok(ctx.onchain_view().utxos) })
+        .await
 }
 
-/// Send onchain transaction
-pub async fn send(dest: Address, amount: Amount, fee_rate: FeeRate) -> anyhow::Result<Txid> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
+/// Send onchain transaction from `wallet`, the wallet its destination and
+/// fee rate were checked against
+pub(crate) async fn send(
+    wallet: &ActiveWallet,
+    dest: Address,
+    amount: Amount,
+    fee_rate: FeeRate,
+) -> anyhow::Result<Txid> {
+    wallet
         .with_context_async(|ctx| async {
-            ctx.onchain_wallet
+            let mut onchain_wallet = ctx.onchain_write().await;
+            onchain_wallet
                 .send(&ctx.wallet.chain, dest, amount, fee_rate)
                 .await
         })
         .await
 }
 
-/// Send many onchain transactions
-pub async fn send_many(
+/// Send many onchain transactions from `wallet`
+pub(crate) async fn send_many(
+    wallet: &ActiveWallet,
     destinations: &[(Address, Amount)],
     fee_rate: FeeRate,
 ) -> anyhow::Result<Txid> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
+    wallet
         .with_context_async(|ctx| async {
-            ctx.onchain_wallet
+            let mut onchain_wallet = ctx.onchain_write().await;
+            onchain_wallet
                 .send_many(&ctx.wallet.chain, destinations, fee_rate)
                 .await
         })
         .await
 }
 
-/// Drain the wallet to a destination address with a specified fee rate
-pub async fn drain(destination: Address, fee_rate: FeeRate) -> anyhow::Result<Txid> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
+/// Drain `wallet` to a destination address with a specified fee rate
+pub(crate) async fn drain(
+    wallet: &ActiveWallet,
+    destination: Address,
+    fee_rate: FeeRate,
+) -> anyhow::Result<Txid> {
+    wallet
         .with_context_async(|ctx| async {
-            ctx.onchain_wallet
+            let mut onchain_wallet = ctx.onchain_write().await;
+            onchain_wallet
                 .drain(&ctx.wallet.chain, destination, fee_rate)
                 .await
         })
@@ -70,8 +159,149 @@ pub async fn drain(destination: Address, fee_rate: FeeRate) -> anyhow::Result<Tx
 
 /// Synchronize the onchain wallet with the blockchain
 pub async fn sync() -> anyhow::Result<()> {
-    let mut manager = GLOBAL_WALLET_MANAGER.lock().await;
-    manager
-        .with_context_async(|ctx| async { ctx.onchain_wallet.sync(&ctx.wallet.chain).await })
+    let active = active_wallet().await;
+    active
+        .with_context_async(|ctx| async {
+            let mut onchain_wallet = ctx.onchain_write().await;
+            onchain_wallet.sync(&ctx.wallet.chain).await?;
+            drop(onchain_wallet);
+            record_sync_checkpoint(ctx).await;
+            Ok(())
+        })
+        .await
+}
+
+/// Chain tip the onchain wallet was last synced to, persisted in the datadir
+#[derive(Clone, Copy, Debug, PartialEq)]
+pub struct SyncCheckpoint {
+    pub tip_height: BlockHeight,
+    /// Unix seconds
+    pub synced_at: u64,
+}
+
+pub struct SyncReport {
+    pub skipped: bool,
+    /// Tip of the previous sync, 0 if there was none
+    pub from_height: BlockHeight,
+    pub tip_height: BlockHeight,
+    pub duration: Duration,
+}
+
+pub(crate) fn unix_now() -> u64 {
+    SystemTime::now()
+        .duration_since(UNIX_EPOCH)
+        .map_or(0, |d| d.as_secs())
+}
+
+pub(crate) fn parse_checkpoint(json: &str) -> Option<SyncCheckpoint> {
+    let value = serde_json::from_str::<serde_json::Value>(json).ok()?;
+    Some(SyncCheckpoint {
+        tip_height: u32::try_from(value.get("tip_height")?.as_u64()?).ok()?,
+        synced_at: value.get("synced_at")?.as_u64()?,
+    })
+}
+
+pub(crate) fn encode_checkpoint(checkpoint: &SyncCheckpoint) -> String {
+    serde_json::json!({
+        "tip_height": checkpoint.tip_height,
+        "synced_at": checkpoint.synced_at,
+    })
+    .to_string()
+}
+
+pub(crate) async fn read_checkpoint(datadir: &Path) -> Option<SyncCheckpoint> {
+    let json = fs::read_to_string(datadir.join(CHECKPOINT_FILE))
         .await
+        .ok()?;
+    parse_checkpoint(&json)
+}
+
+/// Whether a sync can be skipped because the chain did not move since
+/// `checkpoint` and it is recent enough.
+pub(crate) fn can_skip_sync(
+    checkpoint: &SyncCheckpoint,
+    tip_height: BlockHeight,
+    now: u64,
+) -> bool {
+    checkpoint.tip_height == tip_height
+        && now.saturating_sub(checkpoint.synced_at) < MAX_SKIP_AGE.as_secs()
+}
+
+/// Stores `tip_height` as the sync checkpoint. Failing to do so only costs a
+/// redundant sync later, so errors are logged and not returned.
+pub(crate) async fn write_sync_checkpoint(ctx: &WalletContext, tip_height: BlockHeight) {
+    let checkpoint = SyncCheckpoint {
+        tip_height,
+        synced_at: unix_now(),
+    };
+    let path = ctx.datadir.join(CHECKPOINT_FILE);
+    if let Err(e) = fs::write(&path, encode_checkpoint(&checkpoint)).await {
+        warn!("Failed to write {}: {:#}", path.display(), e);
+    }
+}
+
+/// Records a checkpoint after a sync that did not report the tip it synced to
+pub(crate) async fn record_sync_checkpoint(ctx: &WalletContext) {
+    match ctx.wallet.chain.tip().await {
+        Ok(tip_height) => write_sync_checkpoint(ctx, tip_height).await,
+        Err(e) => warn!("Not recording onchain sync checkpoint: {:#}", e),
+    }
+}
+
+/// Syncs the onchain wallet unless nothing can have changed since the last
+/// sync. The wallet resumes from its own persisted chain checkpoint, so a
+/// sync only fetches blocks mined since then.
+///
+/// Progress is reported as `onchain_sync` wallet events.
+pub async fn sync_incremental(force: bool) -> anyhow::Result<SyncReport> {
+    let started = Instant::now();
+    let active = active_wallet().await;
+
+    let (checkpoint, tip_height) = active
+        .with_context_ref_async(|ctx| async {
+            let tip_height = ctx
+                .wallet
+                .chain
+                .tip()
+                .await
+                .context("Failed to get chain tip")?;
+            Ok((read_checkpoint(&ctx.datadir).await, tip_height))
+        })
+        .await?;
+    let from_height = checkpoint.map_or(0, |c| c.tip_height);
+
+    let skip = checkpoint.is_some_and(|c| can_skip_sync(&c, tip_height, unix_now()));
+    if skip && !force {
+        debug!("Onchain wallet is at tip {}, skipping sync", tip_height);
+        events::push_onchain_sync("skipped", from_height, tip_height);
+        return Ok(SyncReport {
+            skipped: true,
+            from_height,
+            tip_height,
+            duration: started.elapsed(),
+        });
+    }
+
+    events::push_onchain_sync("started", from_height, tip_height);
+    let result = active
+        .with_context_async(|ctx| async {
+            let mut onchain_wallet = ctx.onchain_write().await;
+            onchain_wallet.sync(&ctx.wallet.chain).await?;
+            drop(onchain_wallet);
+            // The tip from before the sync, a block mined meanwhile is
+            // picked up next time
+            write_sync_checkpoint(ctx, tip_height).await;
+            Ok(())
+        })
+        .await;
+    let status = if result.is_ok() { "finished" } else { "failed" };
+    events::push_onchain_sync(status, from_height, tip_height);
+    result?;
+
+    Ok(SyncReport {
+        skipped: false,
+        from_height,
+        tip_height,
+        duration: started.elapsed(),
+    })
 }
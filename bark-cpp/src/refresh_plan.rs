@@ -0,0 +1,244 @@
+//! Refresh planning that groups expiring VTXOs into as few rounds as possible.
+//!
+//! Refreshing each VTXO as soon as it crosses the expiry threshold costs one
+//! round for every VTXO that crosses it at a different height. A plan instead
+//! waits until the earliest VTXO can't wait for a later round, then takes along
+//! every VTXO that would become due within the planning horizon, so they all
+//! share that one round. Dust is folded into the round as well, since it is
+//! not worth a round of its own.
+//!
+//! Planning only reads local state. The caller can inspect the plan and hand
+//! its VTXO ids to `execute`, which refreshes exactly those.
+
+use std::collections::HashSet;
+
+use anyhow::{Context, bail};
+use bark::WalletVtxo;
+use bark::ark::bitcoin::Amount;
+use bark::ark::{Vtxo, VtxoId};
+use bark::round::RoundStatus;
+use bark::vtxo::VtxoState;
+use bitcoin_ext::BlockHeight;
+use logger::log::info;
+
+use crate::{active_wallet, events};
+
+/// How far past the first due VTXO others are taken along, about a day
+pub(crate) const DEFAULT_HORIZON_BLOCKS: BlockHeight = 144;
+
+/// VTXOs below this are only refreshed together with others
+pub(crate) const DEFAULT_DUST_LIMIT: Amount = Amount::from_sat(330);
+
+/// Target seconds between blocks, used to express the round interval in blocks
+const BLOCK_INTERVAL_SECS: u64 = 600;
+
+#[derive(Clone, Copy, Debug, PartialEq)]
+pub(crate) struct PlanOpts {
+    /// Blocks past the first due VTXO within which others join its round
+    pub horizon_blocks: BlockHeight,
+    /// Fold VTXOs below `dust_limit` into the planned round
+    pub fold_dust: bool,
+    pub dust_limit: Amount,
+}
+
+impl Default for PlanOpts {
+    fn default() -> Self {
+        PlanOpts {
+            horizon_blocks: DEFAULT_HORIZON_BLOCKS,
+            fold_dust: true,
+            dust_limit: DEFAULT_DUST_LIMIT,
+        }
+    }
+}
+
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub(crate) enum PlanReason {
+    /// Reaches the refresh threshold before the round after the next one
+    Due,
+    /// Becomes due within the horizon and would need a round of its own
+    Horizon,
+    /// Below the dust limit
+    Dust,
+}
+
+impl PlanReason {
+    pub(crate) fn name(self) -> &'static str {
+        match self {
+            PlanReason::Due => "due",
+            PlanReason::Horizon => "horizon",
+            PlanReason::Dust => "dust",
+        }
+    }
+}
+
+#[derive(Clone, Debug, PartialEq)]
+pub(crate) struct Candidate {
+    pub id: VtxoId,
+    pub amount: Amount,
+    pub expiry_height: BlockHeight,
+}
+
+#[derive(Clone, Debug, PartialEq)]
+pub(crate) struct PlannedVtxo {
+    pub candidate: Candidate,
+    pub reason: PlanReason,
+}
+
+#[derive(Clone, Debug, Default, PartialEq)]
+pub(crate) struct RefreshPlan {
+    pub tip: BlockHeight,
+    /// Blocks between two rounds, at least 1
+    pub round_blocks: BlockHeight,
+    /// Height by which the planned round has to happen, `None` if the plan
+    /// is empty
+    pub refresh_by: Option<BlockHeight>,
+    /// True if waiting for a later round would let a VTXO pass the threshold
+    pub due_now: bool,
+    /// Ordered by expiry height
+    pub vtxos: Vec<PlannedVtxo>,
+    pub total: Amount,
+    /// Height at which the VTXOs left out of the plan need the next round
+    pub next_refresh_by: Option<BlockHeight>,
+}
+
+/// Blocks between two rounds for a server with the given round interval
+pub(crate) fn round_blocks(round_interval_secs: u64) -> BlockHeight {
+    round_interval_secs
+        .div_ceil(BLOCK_INTERVAL_SECS)
+        .clamp(1, BlockHeight::MAX as u64) as BlockHeight
+}
+
+/// Plans the next refresh round for `candidates`. A VTXO is due for refresh
+/// `threshold` blocks before it expires.
+pub(crate) fn plan(
+    candidates: &[Candidate],
+    tip: BlockHeight,
+    threshold: BlockHeight,
+    round_blocks: BlockHeight,
+    opts: &PlanOpts,
+) -> RefreshPlan {
+    let round_blocks = round_blocks.max(1);
+    let due_height = |c: &Candidate| c.expiry_height.saturating_sub(threshold);
+    let is_dust = |c: &Candidate| opts.fold_dust && c.amount < opts.dust_limit;
+
+    let mut plan = RefreshPlan {
+        tip,
+        round_blocks,
+        ..Default::default()
+    };
+
+    // Dust alone never starts a round, the first regular VTXO to become due
+    // decides when the round happens
+    let Some(refresh_by) = candidates
+        .iter()
+        .filter(|c| !is_dust(c))
+        .map(due_height)
+        .min()
+    else {
+        return plan;
+    };
+    let must_join = tip.saturating_add(round_blocks);
+    let window_end = refresh_by.saturating_add(opts.horizon_blocks.max(round_blocks));
+
+    for candidate in candidates {
+        let due = due_height(candidate);
+        let reason = if is_dust(candidate) {
+            PlanReason::Dust
+        } else if due <= must_join {
+            PlanReason::Due
+        } else if due <= window_end {
+            PlanReason::Horizon
+        } else {
+            plan.next_refresh_by = Some(plan.next_refresh_by.map_or(due, |h| h.min(due)));
+            continue;
+        };
+        plan.vtxos.push(PlannedVtxo {
+            candidate: candidate.clone(),
+            reason,
+        });
+        plan.total += candidate.amount;
+    }
+    plan.vtxos.sort_by_key(|v| v.candidate.expiry_height);
+    plan.refresh_by = Some(refresh_by);
+    plan.due_now = refresh_by <= must_join;
+    plan
+}
+
+fn spendable_candidates(vtxos: &[WalletVtxo]) -> Vec<Candidate> {
+    vtxos
+        .iter()
+        .filter(|v| matches!(v.state, VtxoState::Spendable))
+        .map(|v| Candidate {
+            id: v.vtxo.id(),
+            amount: v.vtxo.amount(),
+            expiry_height: v.vtxo.expiry_height(),
+        })
+        .collect()
+}
+
+/// Plans the next refresh round for the spendable VTXOs of the wallet
+pub(crate) async fn compute(opts: PlanOpts) -> anyhow::Result<RefreshPlan> {
+    let ark_info = crate::get_ark_info().await?;
+    let active = active_wallet().await;
+    active
+        .with_context_ref_async(|ctx| async {
+            let tip = ctx
+                .wallet
+                .chain
+                .tip()
+                .await
+                .context("Failed to get chain tip")?;
+            let threshold = ctx.wallet.config().vtxo_refresh_expiry_threshold;
+            let vtxos = ctx.wallet.vtxos().await?;
+
+            Ok(plan(
+                &spendable_candidates(&vtxos),
+                tip,
+                threshold,
+                round_blocks(ark_info.round_interval.as_secs()),
+                &opts,
+            ))
+        })
+        .await
+}
+
+/// Refreshes the VTXOs of a plan in one round. Fails without refreshing
+/// anything if one of them is no longer spendable, since the plan is stale.
+pub(crate) async fn execute(vtxo_ids: Vec<VtxoId>) -> anyhow::Result<Option<RoundStatus>> {
+    if vtxo_ids.is_empty() {
+        return Ok(None);
+    }
+    let wanted = vtxo_ids.iter().collect::<HashSet<_>>();
+
+    let active = active_wallet().await;
+    let status = active
+        .with_context_async(|ctx| async {
+            let vtxos = ctx
+                .wallet
+                .vtxos()
+                .await?
+                .into_iter()
+                .filter(|v| matches!(v.state, VtxoState::Spendable))
+                .filter(|v| wanted.contains(&v.vtxo.id()))
+                .map(|v| v.vtxo)
+                .collect::<Vec<Vtxo>>();
+            if vtxos.len() != wanted.len() {
+                bail!(
+                    "{} of the {} planned vtxos are no longer spendable, plan the refresh again",
+                    wanted.len() - vtxos.len(),
+                    wanted.len()
+                );
+            }
+
+            info!("Refreshing {} planned vtxos", vtxos.len());
+            ctx.wallet
+                .refresh_vtxos(vtxos)
+                .await
+                .context("Failed to refresh vtxos")
+        })
+        .await?;
+    if let Some(status) = &status {
+        events::push_round_status(status);
+    }
+    Ok(status)
+}
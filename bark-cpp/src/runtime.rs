@@ -0,0 +1,100 @@
+//! Sizing of the Tokio runtime that runs every bridge call.
+//!
+//! The runtime is built on first use, so `configure` has to be called before
+//! any other call that touches the wallet. Without it the runtime keeps Tokio's
+//! defaults: one worker per core and up to 512 blocking threads.
+
+use std::sync::atomic::{AtomicBool, Ordering};
+use std::sync::{Mutex, MutexGuard};
+use std::time::Duration;
+
+use anyhow::bail;
+use logger::log::info;
+use tokio::runtime::{Builder, Runtime};
+
+#[derive(Clone, Debug, Default, PartialEq)]
+pub struct RuntimeConfig {
+    /// Worker threads of the multi-threaded runtime, 0 for one per core
+    pub worker_threads: usize,
+    /// Run every task on a single runtime thread instead of a worker pool
+    pub current_thread: bool,
+    /// Stack size of runtime threads in bytes, 0 for Tokio's default
+    pub thread_stack_size: usize,
+    /// Upper bound on threads for blocking work, 0 for Tokio's default
+    pub max_blocking_threads: usize,
+    /// How long an idle blocking thread is kept around, 0 for Tokio's default
+    pub blocking_keep_alive: Duration,
+}
+
+static CONFIG: Mutex<Option<RuntimeConfig>> = Mutex::new(None);
+static BUILT: AtomicBool = AtomicBool::new(false);
+
+fn config() -> MutexGuard<'static, Option<RuntimeConfig>> {
+    CONFIG.lock().unwrap_or_else(|e| e.into_inner())
+}
+
+/// Sets the configuration the runtime is built with. Fails once the runtime
+/// is running, since it can't be resized.
+pub(crate) fn configure(runtime_config: RuntimeConfig) -> anyhow::Result<()> {
+    let mut config = config();
+    if BUILT.load(Ordering::Acquire) {
+        bail!("The runtime is already running, configure it before the first wallet call");
+    }
+    *config = Some(runtime_config);
+    Ok(())
+}
+
+/// Builds the runtime from the configured sizing. Only called once, by the
+/// initializer of `TOKIO_RUNTIME`.
+pub(crate) fn build() -> Runtime {
+    // Holding the lock keeps a concurrent `configure` from being dropped
+    let config = config();
+    let runtime_config = config.clone().unwrap_or_default();
+
+    let mut builder = if runtime_config.current_thread {
+        Builder::new_current_thread()
+    } else {
+        let mut builder = Builder::new_multi_thread();
+        if runtime_config.worker_threads > 0 {
+            builder.worker_threads(runtime_config.worker_threads);
+        }
+        builder
+    };
+    builder
+        .enable_all()
+        .thread_name("bark-runtime")
+        .on_thread_start(|| {
+            crate::alloc_stats::set_thread_subsystem(crate::alloc_stats::Subsystem::Runtime);
+        });
+    if runtime_config.thread_stack_size > 0 {
+        builder.thread_stack_size(runtime_config.thread_stack_size);
+    }
+    if runtime_config.max_blocking_threads > 0 {
+        builder.max_blocking_threads(runtime_config.max_blocking_threads);
+    }
+    if !runtime_config.blocking_keep_alive.is_zero() {
+        builder.thread_keep_alive(runtime_config.blocking_keep_alive);
+    }
+    let runtime = builder.build().expect("Failed to create Tokio runtime");
+
+    if runtime_config.current_thread {
+        // Tasks of a current-thread runtime only make progress inside
+        // `Runtime::block_on`. Background tasks like lightning waits and event
+        // delivery need it driven even while no bridge call is running. The
+        // thread waits for `TOKIO_RUNTIME` to finish initializing.
+        let mut thread = std::thread::Builder::new().name("bark-runtime".to_string());
+        if runtime_config.thread_stack_size > 0 {
+            thread = thread.stack_size(runtime_config.thread_stack_size);
+        }
+        thread
+            .spawn(|| {
+                crate::alloc_stats::set_thread_subsystem(crate::alloc_stats::Subsystem::Runtime);
+                crate::TOKIO_RUNTIME.block_on(std::future::pending::<()>())
+            })
+            .expect("Failed to start the runtime thread");
+    }
+
+    info!("Started Tokio runtime with {:?}", runtime_config);
+    BUILT.store(true, Ordering::Release);
+    runtime
+}
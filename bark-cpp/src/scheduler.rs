@@ -0,0 +1,384 @@
+//! Maintenance that only runs the stages that are due.
+//!
+//! The `maintenance*` calls redo all of their work on every invocation. A
+//! scheduled pass instead syncs with the server, then looks at cheap local
+//! state (the balance breakdown, the next required refresh height and the
+//! onchain sync checkpoint) and runs only the stages that have work to do.
+//!
+//! Stages that do not depend on each other run concurrently within the pass.
+//! They share the wallet's server and chain source clients, so wall-clock
+//! time is close to that of the slowest stage rather than the sum.
+//!
+//! Overlapping requests share a pass: a caller that arrives while a pass is
+//! running waits for it and receives its report, unless it forces stages the
+//! running pass did not force, in which case it runs its own pass afterwards.
+//! Passes, their reports and the time of the last server sync are kept per
+//! wallet, and a pass stays on the wallet that was active when it started.
+
+use std::collections::HashMap;
+use std::path::{Path, PathBuf};
+use std::sync::{LazyLock, Mutex, MutexGuard};
+use std::time::{Duration, Instant};
+
+use anyhow::{Context, bail};
+use bark::ark::bitcoin::Amount;
+use bitcoin_ext::BlockHeight;
+use logger::log::{debug, warn};
+use tokio::sync::Notify;
+
+use crate::{WalletContext, active_wallet_key, onchain, wallet_at};
+
+pub(crate) const STAGE_SYNC: u32 = 1 << 0;
+pub(crate) const STAGE_ONCHAIN: u32 = 1 << 1;
+pub(crate) const STAGE_BOARDS: u32 = 1 << 2;
+pub(crate) const STAGE_ROUNDS: u32 = 1 << 3;
+pub(crate) const STAGE_EXITS: u32 = 1 << 4;
+pub(crate) const STAGE_REFRESH: u32 = 1 << 5;
+
+/// Stages in the order a pass runs them
+pub(crate) const STAGES: [(u32, &str); 6] = [
+    (STAGE_SYNC, "sync"),
+    (STAGE_ONCHAIN, "onchain"),
+    (STAGE_BOARDS, "boards"),
+    (STAGE_ROUNDS, "rounds"),
+    (STAGE_EXITS, "exits"),
+    (STAGE_REFRESH, "refresh"),
+];
+
+/// Stages between the server sync and the refresh, grouped so that groups
+/// do not contend for the same lock. Onchain sync and exits both need the
+/// onchain wallet exclusively, boards and rounds only talk to the server and
+/// the chain source.
+pub(crate) const CONCURRENT_GROUPS: [&[u32]; 3] = [
+    &[STAGE_ONCHAIN, STAGE_EXITS],
+    &[STAGE_BOARDS],
+    &[STAGE_ROUNDS],
+];
+
+/// Incoming arkoor payments are only seen by a server sync, so it is not
+/// skipped for longer than this.
+const SYNC_INTERVAL: Duration = Duration::from_secs(30);
+
+#[derive(Clone, Debug, Default)]
+pub struct MaintenanceReport {
+    pub ran: u32,
+    pub skipped: u32,
+    pub failed: u32,
+    /// One entry per failed stage, prefixed with the stage name
+    pub errors: Vec<String>,
+    /// True if this request was served by a pass another caller started
+    pub coalesced: bool,
+    pub duration: Duration,
+}
+
+/// What a pass found out about the wallet before choosing its stages
+#[derive(Clone, Copy, Debug, Default)]
+pub(crate) struct WalletSignals {
+    pub onchain_stale: bool,
+    pub pending_board: bool,
+    pub pending_in_round: bool,
+    pub pending_exit: bool,
+    pub refresh_due: bool,
+}
+
+/// Stages after the server sync that have work to do given `signals`, plus
+/// the `forced` ones
+pub(crate) fn due_stages(signals: &WalletSignals, forced: u32) -> u32 {
+    let mut due = forced & !STAGE_SYNC;
+    let checks = [
+        (STAGE_ONCHAIN, signals.onchain_stale),
+        (STAGE_BOARDS, signals.pending_board),
+        (STAGE_ROUNDS, signals.pending_in_round),
+        (STAGE_EXITS, signals.pending_exit),
+        (STAGE_REFRESH, signals.refresh_due),
+    ];
+    for (stage, is_due) in checks {
+        if is_due {
+            due |= stage;
+        }
+    }
+    due
+}
+
+pub(crate) fn parse_stages(names: &[String]) -> anyhow::Result<u32> {
+    let mut mask = 0;
+    for name in names {
+        let Some((stage, _)) = STAGES.iter().find(|(_, n)| n == name) else {
+            bail!("Unknown maintenance stage: {}", name);
+        };
+        mask |= stage;
+    }
+    Ok(mask)
+}
+
+pub(crate) fn stage_names(mask: u32) -> Vec<String> {
+    STAGES
+        .iter()
+        .filter(|(stage, _)| mask & stage != 0)
+        .map(|(_, name)| name.to_string())
+        .collect()
+}
+
+#[derive(Default)]
+struct WalletSchedule {
+    running: Option<Pass>,
+    last_sync: Option<Instant>,
+    // Report of the most recent pass, by pass id
+    last_report: Option<(u64, MaintenanceReport)>,
+}
+
+#[derive(Default)]
+struct SchedulerState {
+    // By wallet key
+    wallets: HashMap<PathBuf, WalletSchedule>,
+    next_id: u64,
+}
+
+#[derive(Clone, Copy)]
+struct Pass {
+    id: u64,
+    forced: u32,
+}
+
+static SCHEDULER: LazyLock<(Mutex<SchedulerState>, Notify)> =
+    LazyLock::new(|| (Mutex::new(SchedulerState::default()), Notify::new()));
+
+fn state() -> MutexGuard<'static, SchedulerState> {
+    SCHEDULER.0.lock().unwrap_or_else(|e| e.into_inner())
+}
+
+/// Unregisters the running pass of a wallet and wakes the callers waiting
+/// for it, also when the pass panics or its future is dropped. Waiters that
+/// find no report for the pass then start one of their own.
+struct RunningPass<'a>(&'a Path);
+
+impl Drop for RunningPass<'_> {
+    fn drop(&mut self) {
+        if let Some(schedule) = state().wallets.get_mut(self.0) {
+            schedule.running = None;
+        }
+        SCHEDULER.1.notify_waiters();
+    }
+}
+
+/// Runs the maintenance stages of the active wallet that are due, and always
+/// the `forced` ones. Stage failures do not stop the pass, they are listed in
+/// the report.
+pub async fn run(forced: u32) -> anyhow::Result<MaintenanceReport> {
+    let Some(key) = active_wallet_key().await else {
+        bail!("Wallet not loaded");
+    };
+    let id = loop {
+        let notified = SCHEDULER.1.notified();
+        let pass = {
+            let mut state = state();
+            let state = &mut *state;
+            let schedule = state.wallets.entry(key.clone()).or_default();
+            match schedule.running {
+                Some(pass) => pass,
+                None => {
+                    state.next_id += 1;
+                    let id = state.next_id;
+                    schedule.running = Some(Pass { id, forced });
+                    break id;
+                }
+            }
+        };
+
+        notified.await;
+        if pass.forced & forced != forced {
+            // The running pass may have skipped stages this caller forces
+            continue;
+        }
+        let scheduler = state();
+        let last_report = scheduler
+            .wallets
+            .get(&key)
+            .and_then(|s| s.last_report.as_ref());
+        if let Some((id, report)) = last_report {
+            if *id == pass.id {
+                debug!("Joined maintenance pass {}", pass.id);
+                return Ok(MaintenanceReport {
+                    coalesced: true,
+                    ..report.clone()
+                });
+            }
+        }
+    };
+
+    let running = RunningPass(&key);
+    let result = run_pass(&key, forced).await;
+
+    if let Ok(report) = &result {
+        let mut state = state();
+        let schedule = state.wallets.entry(key.clone()).or_default();
+        if report.ran & STAGE_SYNC != 0 && report.failed & STAGE_SYNC == 0 {
+            schedule.last_sync = Some(Instant::now());
+        }
+        schedule.last_report = Some((id, report.clone()));
+    }
+    drop(running);
+    result
+}
+
+async fn run_pass(key: &Path, forced: u32) -> anyhow::Result<MaintenanceReport> {
+    let started = Instant::now();
+    let sync_stale = state()
+        .wallets
+        .get(key)
+        .and_then(|s| s.last_sync)
+        .is_none_or(|at| at.elapsed() >= SYNC_INTERVAL);
+
+    let wallet = wallet_at(key).await?;
+    let mut report = wallet
+        .with_context_async(|ctx| async {
+            let mut report = MaintenanceReport::default();
+
+            // Everything below looks at local state, which is only current
+            // after a server sync
+            if sync_stale || forced & STAGE_SYNC != 0 {
+                ctx.wallet.sync().await;
+                report.ran |= STAGE_SYNC;
+            } else {
+                report.skipped |= STAGE_SYNC;
+            }
+
+            let tip = ctx
+                .wallet
+                .chain
+                .tip()
+                .await
+                .context("Failed to get chain tip")?;
+            let signals = read_signals(ctx, tip).await?;
+            let due = due_stages(&signals, forced);
+            debug!("Maintenance stages due: {:?}", stage_names(due));
+
+            // Groups run concurrently, the stages within a group in order.
+            // Refreshing looks at the vtxos the other stages settle, so it
+            // runs last.
+            let [onchain, boards, rounds] = CONCURRENT_GROUPS;
+            let (onchain, boards, rounds) = tokio::join!(
+                run_group(ctx, onchain, due, tip),
+                run_group(ctx, boards, due, tip),
+                run_group(ctx, rounds, due, tip),
+            );
+            let refresh = run_group(ctx, &[STAGE_REFRESH], due, tip).await;
+
+            let mut results = [onchain, boards, rounds, refresh]
+                .into_iter()
+                .flatten()
+                .collect::<Vec<_>>();
+            results.sort_by_key(|(stage, _)| stage_index(*stage));
+            for (stage, result) in results {
+                let Some(result) = result else {
+                    report.skipped |= stage;
+                    continue;
+                };
+                report.ran |= stage;
+                if let Err(e) = result {
+                    let name = stage_name(stage);
+                    warn!("Maintenance stage {} failed: {:#}", name, e);
+                    report.failed |= stage;
+                    report.errors.push(format!("{}: {:#}", name, e));
+                }
+            }
+            Ok(report)
+        })
+        .await?;
+
+    report.duration = started.elapsed();
+    Ok(report)
+}
+
+fn stage_index(stage: u32) -> usize {
+    STAGES
+        .iter()
+        .position(|(s, _)| *s == stage)
+        .unwrap_or(STAGES.len())
+}
+
+fn stage_name(stage: u32) -> &'static str {
+    STAGES
+        .get(stage_index(stage))
+        .map_or("unknown", |(_, name)| name)
+}
+
+/// Runs the due stages of `group` in order. Skipped stages yield `None`.
+async fn run_group(
+    ctx: &WalletContext,
+    group: &[u32],
+    due: u32,
+    tip: BlockHeight,
+) -> Vec<(u32, Option<anyhow::Result<()>>)> {
+    let mut results = Vec::with_capacity(group.len());
+    for &stage in group {
+        let result = if due & stage != 0 {
+            Some(run_stage(ctx, stage, tip).await)
+        } else {
+            None
+        };
+        results.push((stage, result));
+    }
+    results
+}
+
+async fn read_signals(ctx: &WalletContext, tip: BlockHeight) -> anyhow::Result<WalletSignals> {
+    let balance = ctx.wallet.balance().await?;
+    let next_refresh = ctx
+        .wallet
+        .get_next_required_refresh_blockheight()
+        .await
+        .context("Failed to get next required refresh blockheight")?;
+    let checkpoint = onchain::read_checkpoint(&ctx.datadir).await;
+
+    Ok(WalletSignals {
+        onchain_stale: !checkpoint
+            .is_some_and(|c| onchain::can_skip_sync(&c, tip, onchain::unix_now())),
+        pending_board: balance.pending_board > Amount::ZERO,
+        pending_in_round: balance.pending_in_round > Amount::ZERO,
+        pending_exit: balance.pending_exit.is_some_and(|a| a > Amount::ZERO),
+        refresh_due: next_refresh.is_some_and(|height| height <= tip),
+    })
+}
+
+pub(crate) async fn run_stage(
+    ctx: &WalletContext,
+    stage: u32,
+    tip: BlockHeight,
+) -> anyhow::Result<()> {
+    match stage {
+        STAGE_ONCHAIN => {
+            let mut onchain_wallet = ctx.onchain_write().await;
+            onchain_wallet.sync(&ctx.wallet.chain).await?;
+            drop(onchain_wallet);
+            onchain::write_sync_checkpoint(ctx, tip).await;
+        }
+        STAGE_BOARDS => {
+            ctx.wallet
+                .sync_pending_boards()
+                .await
+                .context("Failed to sync pending boards")?;
+        }
+        STAGE_ROUNDS => {
+            ctx.wallet
+                .sync_pending_rounds()
+                .await
+                .context("Failed to sync pending rounds")?;
+        }
+        STAGE_EXITS => {
+            let mut onchain_wallet = ctx.onchain_write().await;
+            ctx.wallet
+                .sync_exits(&mut onchain_wallet)
+                .await
+                .context("Failed to sync exits")?;
+        }
+        STAGE_REFRESH => {
+            ctx.wallet
+                .maintenance_refresh()
+                .await
+                .context("Failed to perform vtxo maintenance refresh")?;
+        }
+        _ => unreachable!("unknown maintenance stage {}", stage),
+    }
+    Ok(())
+}
@@ -0,0 +1,133 @@
+//! Cached Ark server info, revalidated in the background.
+//!
+//! The server info (round interval, expiry deltas, max VTXO amount) rarely
+//! changes, yet send, offboard and refresh paths all read it. Reads are served
+//! from the cache; once an entry is older than the TTL it is still returned,
+//! and a background task fetches a fresh one. When that fetch fails the
+//! server connection is re-established before trying again, which keeps the
+//! connection usable without callers having to call `refresh_server`.
+
+use std::sync::atomic::{AtomicBool, AtomicU64, Ordering};
+use std::sync::{Mutex, MutexGuard};
+use std::time::{Duration, Instant};
+
+use anyhow::{Context, bail};
+use bark::ark::ArkInfo;
+use logger::log::{debug, warn};
+
+use crate::{ActiveWallet, singleflight};
+
+/// Age after which cached server info is revalidated
+pub(crate) const DEFAULT_TTL: Duration = Duration::from_secs(300);
+
+static TTL_SECS: AtomicU64 = AtomicU64::new(DEFAULT_TTL.as_secs());
+static REVALIDATING: AtomicBool = AtomicBool::new(false);
+// Bumped whenever the cache is dropped, so a fetch that started for another
+// wallet or connection doesn't store its result
+static GENERATION: AtomicU64 = AtomicU64::new(0);
+static CACHE: Mutex<Option<Cached>> = Mutex::new(None);
+
+struct Cached {
+    info: ArkInfo,
+    fetched: Instant,
+}
+
+fn cache() -> MutexGuard<'static, Option<Cached>> {
+    CACHE.lock().unwrap_or_else(|e| e.into_inner())
+}
+
+pub(crate) fn ttl() -> Duration {
+    Duration::from_secs(TTL_SECS.load(Ordering::Relaxed))
+}
+
+/// Sets the age at which cached info is revalidated, zero disables the cache
+pub(crate) fn set_ttl(ttl: Duration) {
+    TTL_SECS.store(ttl.as_secs(), Ordering::Relaxed);
+    if ttl.is_zero() {
+        forget();
+    }
+}
+
+/// Drops the cached info, for a new wallet or server connection
+pub(crate) fn forget() {
+    GENERATION.fetch_add(1, Ordering::AcqRel);
+    *cache() = None;
+}
+
+/// Cached info and its age
+pub(crate) fn cached() -> Option<(ArkInfo, Duration)> {
+    cache()
+        .as_ref()
+        .map(|c| (c.info.clone(), c.fetched.elapsed()))
+}
+
+pub(crate) fn store(generation: u64, info: &ArkInfo) {
+    let mut cache = cache();
+    if GENERATION.load(Ordering::Acquire) == generation && !ttl().is_zero() {
+        *cache = Some(Cached {
+            info: info.clone(),
+            fetched: Instant::now(),
+        });
+    }
+}
+
+/// Server info from the cache, fetched when there is none
+pub(crate) async fn ark_info() -> anyhow::Result<ArkInfo> {
+    if let Some((info, age)) = cached() {
+        if age >= ttl() {
+            revalidate_in_background();
+        }
+        return Ok(info);
+    }
+    fetch().await
+}
+
+/// Fetches the server info and caches it
+pub(crate) async fn fetch() -> anyhow::Result<ArkInfo> {
+    let generation = GENERATION.load(Ordering::Acquire);
+    let info = singleflight::ARK_INFO
+        .run(singleflight::read_window(), |active| async move {
+            fetch_uncached(&active).await
+        })
+        .await?;
+    store(generation, &info);
+    Ok(info)
+}
+
+async fn fetch_uncached(active: &ActiveWallet) -> anyhow::Result<ArkInfo> {
+    let info = active
+        .with_context_ref_async(|ctx| async {
+            ctx.wallet
+                .ark_info()
+                .await
+                .context("Failed to get ark info")
+        })
+        .await?;
+
+    match info {
+        Some(info) => Ok(info),
+        None => bail!("Failed to get ark info, returned as null"),
+    }
+}
+
+fn revalidate_in_background() {
+    if REVALIDATING.swap(true, Ordering::AcqRel) {
+        return;
+    }
+    crate::TOKIO_RUNTIME.spawn(async {
+        if let Err(e) = fetch().await {
+            debug!("Reconnecting to the Ark server after: {:#}", e);
+            let reconnected = singleflight::REFRESH_SERVER
+                .run(Duration::ZERO, |active| async move {
+                    crate::reconnect_server(&active).await
+                })
+                .await;
+            if let Err(e) = reconnected {
+                warn!("Failed to reconnect to the Ark server: {:#}", e);
+            } else if let Err(e) = fetch().await {
+                warn!("Failed to revalidate the Ark server info: {:#}", e);
+            }
+        }
+        REVALIDATING.store(false, Ordering::Release);
+    });
+}
@@ -0,0 +1,127 @@
+//! Coalescing of identical bridge calls that overlap.
+//!
+//! Components of the app call `sync`, `refresh_server`, `maintenance` or
+//! `get_ark_info` independently, often all at once when the app comes to the
+//! foreground. Without coalescing every caller repeats the same network work
+//! one after the other. A `Flight` runs the operation for the first caller;
+//! everyone who arrives while it runs waits for it and gets the same result,
+//! errors included, instead of starting it again.
+//!
+//! Idempotent reads can also hand out a finished result for a while after it
+//! completed. That freshness window defaults to zero, so by default only
+//! callers that overlap share a result.
+//!
+//! Results are only shared between callers of the same wallet. The wallet is
+//! resolved when a caller arrives and handed to the operation, so a run that
+//! started before `select_wallet` never answers a caller that arrived after.
+
+use std::future::Future;
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::sync::{Mutex, MutexGuard, Weak};
+use std::time::{Duration, Instant};
+
+use bark::ark::ArkInfo;
+use logger::log::debug;
+
+use crate::{ActiveWallet, WalletContext, metrics};
+
+static READ_WINDOW_MS: AtomicU64 = AtomicU64::new(0);
+
+pub(crate) static SYNC: Flight<()> = Flight::new("sync");
+pub(crate) static REFRESH_SERVER: Flight<()> = Flight::new("refresh_server");
+pub(crate) static MAINTENANCE: Flight<()> = Flight::new("maintenance");
+pub(crate) static ARK_INFO: Flight<ArkInfo> = Flight::new("get_ark_info");
+
+/// How long a finished idempotent read is handed to later callers
+pub(crate) fn read_window() -> Duration {
+    Duration::from_millis(READ_WINDOW_MS.load(Ordering::Relaxed))
+}
+
+pub(crate) fn set_read_window(window: Duration) {
+    let ms = window.as_millis().min(u64::MAX as u128) as u64;
+    READ_WINDOW_MS.store(ms, Ordering::Relaxed);
+}
+
+/// Drops every finished result, so no call reuses one from another wallet
+pub(crate) fn forget_all() {
+    SYNC.forget();
+    REFRESH_SERVER.forget();
+    MAINTENANCE.forget();
+    ARK_INFO.forget();
+}
+
+struct Landed<T> {
+    at: Instant,
+    wallet: Option<Weak<WalletContext>>,
+    // Errors are shared as their message, `anyhow::Error` can't be cloned
+    result: Result<T, String>,
+}
+
+/// Single-flight state of one operation
+pub(crate) struct Flight<T> {
+    name: &'static str,
+    // Held by the caller running the operation, the others queue on it
+    running: tokio::sync::Mutex<()>,
+    landed: Mutex<Option<Landed<T>>>,
+}
+
+impl<T: Clone> Flight<T> {
+    pub(crate) const fn new(name: &'static str) -> Self {
+        Flight {
+            name,
+            running: tokio::sync::Mutex::const_new(()),
+            landed: Mutex::new(None),
+        }
+    }
+
+    fn landed(&self) -> MutexGuard<'_, Option<Landed<T>>> {
+        self.landed.lock().unwrap_or_else(|e| e.into_inner())
+    }
+
+    pub(crate) fn forget(&self) {
+        *self.landed() = None;
+    }
+
+    /// Runs `op` on the active wallet unless a run on the same wallet that
+    /// overlaps this call, or a successful one that finished less than
+    /// `fresh_for` ago, already has a result
+    pub(crate) async fn run<F, Fut>(&self, fresh_for: Duration, op: F) -> anyhow::Result<T>
+    where
+        F: FnOnce(ActiveWallet) -> Fut,
+        Fut: Future<Output = anyhow::Result<T>>,
+    {
+        let arrived = Instant::now();
+        let active = crate::active_wallet().await;
+        let wallet = active.downgrade();
+        let _running = metrics::lock_wait(self.running.lock()).await;
+
+        if let Some(landed) = self.landed().as_ref() {
+            // Whatever finished after this call arrived was running meanwhile
+            let overlapped = landed.at >= arrived;
+            let fresh = landed.result.is_ok() && landed.at.elapsed() < fresh_for;
+            if (overlapped || fresh) && same_wallet(&landed.wallet, &wallet) {
+                debug!("Sharing the result of an in-flight {}", self.name);
+                return landed.result.clone().map_err(anyhow::Error::msg);
+            }
+        }
+
+        let result = op(active).await;
+        *self.landed() = Some(Landed {
+            at: Instant::now(),
+            wallet,
+            result: result
+                .as_ref()
+                .map(T::clone)
+                .map_err(|e| format!("{:#}", e)),
+        });
+        result
+    }
+}
+
+fn same_wallet(a: &Option<Weak<WalletContext>>, b: &Option<Weak<WalletContext>>) -> bool {
+    match (a, b) {
+        (Some(a), Some(b)) => a.ptr_eq(b),
+        (None, None) => true,
+        _ => false,
+    }
+}
@@ -0,0 +1,86 @@
+//! In-memory cache of the wallet state that screens read on every render.
+//!
+//! Entries are filled lazily by the read paths in `cxx.rs` and dropped as soon
+//! as a state-mutating call starts (see `ActiveWallet::with_context_async`)
+//! or the wallet is loaded or closed. Reads that raced with a mutation carry
+//! a stale generation and are not stored.
+
+use std::sync::{LazyLock, Mutex, MutexGuard};
+
+use crate::cxx::ffi::{BarkVtxo, OffchainBalance, OnChainBalance};
+
+#[derive(Default)]
+pub(crate) struct Snapshot {
+    pub offchain_balance: Option<OffchainBalance>,
+    pub onchain_balance: Option<OnChainBalance>,
+    pub vtxos: Option<Vec<BarkVtxo>>,
+    pub first_expiring_vtxo_blockheight: Option<Option<u32>>,
+}
+
+#[derive(Default)]
+struct SnapshotState {
+    generation: u64,
+    mutations_in_flight: usize,
+    snapshot: Snapshot,
+}
+
+static SNAPSHOT: LazyLock<Mutex<SnapshotState>> = LazyLock::new(Default::default);
+
+fn state() -> MutexGuard<'static, SnapshotState> {
+    // The state stays consistent even if a holder panicked, so ignore poisoning
+    SNAPSHOT.lock().unwrap_or_else(|e| e.into_inner())
+}
+
+/// Taken before querying the wallet and handed back to `store`.
+#[derive(Clone, Copy)]
+pub(crate) struct Generation(Option<u64>);
+
+pub(crate) fn generation() -> Generation {
+    let state = state();
+    Generation((state.mutations_in_flight == 0).then_some(state.generation))
+}
+
+pub(crate) fn read<T>(f: impl FnOnce(&Snapshot) -> T) -> T {
+    f(&state().snapshot)
+}
+
+/// Stores a freshly read value unless the wallet was mutated since `generation`.
+pub(crate) fn store(generation: Generation, f: impl FnOnce(&mut Snapshot)) {
+    let mut state = state();
+    if state.mutations_in_flight == 0 && generation.0 == Some(state.generation) {
+        f(&mut state.snapshot);
+    }
+}
+
+pub(crate) fn invalidate() {
+    let mut state = state();
+    state.generation += 1;
+    state.snapshot = Snapshot::default();
+}
+
+/// Keeps the cache disabled while a state-mutating call is running.
+pub(crate) struct MutationGuard(());
+
+pub(crate) fn begin_mutation() -> MutationGuard {
+    let mut state = state();
+    state.mutations_in_flight += 1;
+    state.generation += 1;
+    state.snapshot = Snapshot::default();
+    MutationGuard(())
+}
+
+/// Like `begin_mutation` for calls that usually change nothing. Reads keep
+/// being served from the cache, but none are stored until the guard is
+/// dropped. Call `invalidate` if the wallet did change.
+pub(crate) fn begin_attempt() -> MutationGuard {
+    let mut state = state();
+    state.mutations_in_flight += 1;
+    state.generation += 1;
+    MutationGuard(())
+}
+
+impl Drop for MutationGuard {
+    fn drop(&mut self) {
+        state().mutations_in_flight -= 1;
+    }
+}
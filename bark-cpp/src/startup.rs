@@ -0,0 +1,127 @@
+//! Wallet open bookkeeping: a process-wide cache of the derived seed and a
+//! timing breakdown of the last open.
+//!
+//! Deriving the BIP39 seed runs 2048 rounds of PBKDF2-HMAC-SHA512, which is a
+//! noticeable part of opening a wallet on slow devices. The seed only depends
+//! on the mnemonic, so it is kept in memory after the first open and reused
+//! when the same wallet is reopened, for example after a close by a headless
+//! worker. It never touches disk and is wiped when replaced. Copies handed
+//! out are `Seed`s too, so they are wiped once the caller is done with them.
+
+use std::sync::{Mutex, MutexGuard};
+use std::time::{Duration, Instant};
+
+use bark::ark::bitcoin::hashes::{Hash, sha256};
+use bip39::Mnemonic;
+
+/// Durations of the phases of `WalletManager::open_wallet`
+#[derive(Clone, Copy, Debug, Default)]
+pub struct OpenTimings {
+    pub db_open: Duration,
+    pub read_properties: Duration,
+    pub seed: Duration,
+    pub seed_cached: bool,
+    pub onchain_load: Duration,
+    /// Opening the bark wallet, including the handshake with the server
+    pub wallet_open: Duration,
+    pub total: Duration,
+}
+
+/// A seed that is wiped when dropped
+pub(crate) struct Seed([u8; 64]);
+
+impl Seed {
+    pub(crate) fn new(seed: [u8; 64]) -> Self {
+        Seed(seed)
+    }
+
+    pub(crate) fn as_bytes(&self) -> &[u8; 64] {
+        &self.0
+    }
+}
+
+impl Drop for Seed {
+    fn drop(&mut self) {
+        for byte in self.0.iter_mut() {
+            // Volatile so the wipe is not optimized away as a dead store
+            unsafe { std::ptr::write_volatile(byte, 0) };
+        }
+    }
+}
+
+struct CachedSeed {
+    fingerprint: [u8; 32],
+    seed: Seed,
+}
+
+static SEED_CACHE: Mutex<Option<CachedSeed>> = Mutex::new(None);
+static LAST_OPEN: Mutex<Option<OpenTimings>> = Mutex::new(None);
+
+fn seed_cache() -> MutexGuard<'static, Option<CachedSeed>> {
+    SEED_CACHE.lock().unwrap_or_else(|e| e.into_inner())
+}
+
+fn fingerprint(mnemonic: &Mnemonic) -> [u8; 32] {
+    let (entropy, len) = mnemonic.to_entropy_array();
+    sha256::Hash::hash(&entropy[..len]).to_byte_array()
+}
+
+/// Returns the seed of `mnemonic` with an empty passphrase, and whether it
+/// came from the cache.
+pub(crate) fn seed(mnemonic: &Mnemonic) -> (Seed, bool) {
+    let fingerprint = fingerprint(mnemonic);
+    if let Some(cached) = seed_cache().as_ref() {
+        if cached.fingerprint == fingerprint {
+            return (Seed(cached.seed.0), true);
+        }
+    }
+
+    let seed = Seed(mnemonic.to_seed(""));
+    *seed_cache() = Some(CachedSeed {
+        fingerprint,
+        seed: Seed(seed.0),
+    });
+    (seed, false)
+}
+
+/// Wipes the cached seed, so the next open derives it again
+pub(crate) fn forget_seed() {
+    *seed_cache() = None;
+}
+
+/// Collects `OpenTimings` while a wallet is being opened
+pub(crate) struct OpenTimer {
+    started: Instant,
+    phase_started: Instant,
+    pub timings: OpenTimings,
+}
+
+impl OpenTimer {
+    pub fn start() -> Self {
+        let now = Instant::now();
+        Self {
+            started: now,
+            phase_started: now,
+            timings: OpenTimings::default(),
+        }
+    }
+
+    /// Returns the time since the previous phase ended
+    pub fn phase(&mut self) -> Duration {
+        let now = Instant::now();
+        let elapsed = now - self.phase_started;
+        self.phase_started = now;
+        elapsed
+    }
+
+    pub fn finish(mut self) -> OpenTimings {
+        self.timings.total = self.started.elapsed();
+        *LAST_OPEN.lock().unwrap_or_else(|e| e.into_inner()) = Some(self.timings);
+        self.timings
+    }
+}
+
+/// Timings of the most recent successful wallet open in this process
+pub fn last_open_timings() -> Option<OpenTimings> {
+    *LAST_OPEN.lock().unwrap_or_else(|e| e.into_inner())
+}
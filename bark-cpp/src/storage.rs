@@ -0,0 +1,332 @@
+//! SQLite tuning for the bark persister.
+//!
+//! `SqliteClient` opens its own connections with SQLite's defaults, so the
+//! settings of a `StorageProfile` are applied in two places. Settings stored
+//! in the database file (journal mode, page size) are set on a short-lived
+//! connection before the client opens the file. Per-connection settings
+//! (synchronous level, cache and mmap size) are applied by an SQLite auto
+//! extension. Auto extensions run for every connection the process opens, so
+//! the settings are registered per database file and only applied to
+//! connections to that file, for as long as the returned `ConnectionSettings`
+//! is kept.
+//!
+//! After the client has run its migrations, indexes are added for the bark
+//! columns the VTXO state and expiry height lookups use. Their names carry the version of the bark persister this was built against, and
+//! indexes of other versions are dropped before the client opens the file, so
+//! a migration of a newer bark never runs against a column that one of these
+//! indexes still references.
+
+use std::collections::HashMap;
+use std::ffi::{CStr, CString, c_char, c_int};
+use std::path::Path;
+use std::str::FromStr;
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::sync::{LazyLock, Mutex, MutexGuard, Once};
+
+use anyhow::{Context, bail};
+use bark::persist::sqlite::SqliteClient;
+use logger::log::{debug, warn};
+use rusqlite::{Connection, ffi};
+
+/// Bark columns used by the VTXO state and expiry lookups. Each is only
+/// indexed if the persister's schema has it. Movements are always read in
+/// full by bark, so an index on them would only slow down writes.
+const INDEXED_COLUMNS: [(&str, &str); 3] = [
+    ("bark_vtxo", "expiry_height"),
+    ("bark_vtxo_state", "state_kind"),
+    ("bark_vtxo_state", "created_at"),
+];
+
+const INDEX_PREFIX: &str = "bark_cpp_";
+
+#[derive(Clone, Copy, Debug, Default, PartialEq, Eq)]
+pub enum JournalMode {
+    #[default]
+    Wal,
+    Delete,
+    Truncate,
+}
+
+impl JournalMode {
+    fn as_sql(self) -> &'static str {
+        match self {
+            JournalMode::Wal => "WAL",
+            JournalMode::Delete => "DELETE",
+            JournalMode::Truncate => "TRUNCATE",
+        }
+    }
+}
+
+impl FromStr for JournalMode {
+    type Err = anyhow::Error;
+
+    fn from_str(s: &str) -> anyhow::Result<Self> {
+        match s.to_ascii_lowercase().as_str() {
+            "" | "wal" => Ok(JournalMode::Wal),
+            "delete" => Ok(JournalMode::Delete),
+            "truncate" => Ok(JournalMode::Truncate),
+            _ => bail!("Unknown journal mode '{}', use wal, delete or truncate", s),
+        }
+    }
+}
+
+#[derive(Clone, Copy, Debug, Default, PartialEq, Eq)]
+pub enum Synchronous {
+    Off,
+    Normal,
+    /// SQLite's default, every commit survives a power loss
+    #[default]
+    Full,
+    Extra,
+}
+
+impl Synchronous {
+    fn as_sql(self) -> &'static str {
+        match self {
+            Synchronous::Off => "OFF",
+            Synchronous::Normal => "NORMAL",
+            Synchronous::Full => "FULL",
+            Synchronous::Extra => "EXTRA",
+        }
+    }
+}
+
+impl FromStr for Synchronous {
+    type Err = anyhow::Error;
+
+    fn from_str(s: &str) -> anyhow::Result<Self> {
+        match s.to_ascii_lowercase().as_str() {
+            "off" => Ok(Synchronous::Off),
+            "normal" => Ok(Synchronous::Normal),
+            "" | "full" => Ok(Synchronous::Full),
+            "extra" => Ok(Synchronous::Extra),
+            _ => bail!(
+                "Unknown synchronous level '{}', use off, normal, full or extra",
+                s
+            ),
+        }
+    }
+}
+
+/// SQLite settings for the wallet database. Zero sizes keep SQLite's default.
+#[derive(Clone, Debug, Default, PartialEq, Eq)]
+pub struct StorageProfile {
+    pub journal_mode: JournalMode,
+    /// With WAL, `Normal` only fsyncs at checkpoints. The last commits can
+    /// be lost on power loss, but the database is never corrupted.
+    pub synchronous: Synchronous,
+    pub mmap_size: u64,
+    pub cache_size_kib: u32,
+    /// Only applied when the database is created
+    pub page_size: u32,
+}
+
+impl StorageProfile {
+    /// Statements run on every new connection
+    pub(crate) fn connection_pragmas(&self) -> String {
+        let mut sql = format!("PRAGMA synchronous = {};", self.synchronous.as_sql());
+        if self.mmap_size > 0 {
+            sql.push_str(&format!("PRAGMA mmap_size = {};", self.mmap_size));
+        }
+        if self.cache_size_kib > 0 {
+            // Negative values are in KiB rather than pages
+            sql.push_str(&format!("PRAGMA cache_size = -{};", self.cache_size_kib));
+        }
+        sql
+    }
+}
+
+struct Registration {
+    id: u64,
+    sql: CString,
+}
+
+// Keyed by the database file name as SQLite reports it
+static CONNECTION_PRAGMAS: LazyLock<Mutex<HashMap<CString, Registration>>> =
+    LazyLock::new(|| Mutex::new(HashMap::new()));
+static NEXT_REGISTRATION: AtomicU64 = AtomicU64::new(0);
+static AUTO_EXTENSION: Once = Once::new();
+
+fn connection_pragmas() -> MutexGuard<'static, HashMap<CString, Registration>> {
+    CONNECTION_PRAGMAS.lock().unwrap_or_else(|e| e.into_inner())
+}
+
+/// Keeps the per-connection settings of a database applied to the
+/// connections opened to it. Dropping it stops applying them.
+pub(crate) struct ConnectionSettings {
+    filename: CString,
+    id: u64,
+}
+
+impl Drop for ConnectionSettings {
+    fn drop(&mut self) {
+        let mut pragmas = connection_pragmas();
+        // A later open of the same file may have registered its own settings
+        if pragmas
+            .get(&self.filename)
+            .is_some_and(|registration| registration.id == self.id)
+        {
+            pragmas.remove(&self.filename);
+        }
+    }
+}
+
+unsafe extern "C" fn apply_connection_pragmas(
+    db: *mut ffi::sqlite3,
+    _err: *mut *mut c_char,
+    _api: *const ffi::sqlite3_api_routines,
+) -> c_int {
+    let filename = unsafe { ffi::sqlite3_db_filename(db, c"main".as_ptr()) };
+    if filename.is_null() {
+        return ffi::SQLITE_OK;
+    }
+    let filename = unsafe { CStr::from_ptr(filename) };
+    if let Some(Registration { sql, .. }) = connection_pragmas().get(filename) {
+        // A failed pragma leaves the connection at SQLite's defaults, which
+        // is no reason to fail opening it
+        unsafe {
+            ffi::sqlite3_exec(
+                db,
+                sql.as_ptr(),
+                None,
+                std::ptr::null_mut(),
+                std::ptr::null_mut(),
+            )
+        };
+    }
+    ffi::SQLITE_OK
+}
+
+/// Makes every connection opened to the database of `conn` from now on use
+/// the settings of `profile`
+fn install_connection_pragmas(
+    conn: &Connection,
+    profile: &StorageProfile,
+) -> anyhow::Result<ConnectionSettings> {
+    let filename = conn
+        .path()
+        .filter(|path| !path.is_empty())
+        .context("The wallet database has no file name")?;
+    let filename = CString::new(filename).context("The wallet database path contains NUL")?;
+    let sql = CString::new(profile.connection_pragmas()).expect("pragmas contain no NUL");
+    let id = NEXT_REGISTRATION.fetch_add(1, Ordering::Relaxed);
+    connection_pragmas().insert(filename.clone(), Registration { id, sql });
+
+    AUTO_EXTENSION.call_once(|| {
+        let rc = unsafe {
+            ffi::sqlite3_auto_extension(Some(std::mem::transmute(
+                apply_connection_pragmas as *const (),
+            )))
+        };
+        if rc != ffi::SQLITE_OK {
+            warn!("Failed to register the SQLite connection settings: {}", rc);
+        }
+    });
+    Ok(ConnectionSettings { filename, id })
+}
+
+fn index_prefix() -> String {
+    let version = env!("BARK_PERSIST_VERSION")
+        .chars()
+        .map(|c| if c.is_ascii_alphanumeric() { c } else { '_' })
+        .collect::<String>();
+    format!("{}v{}_", INDEX_PREFIX, version)
+}
+
+/// Sets the file level settings and drops indexes this version doesn't use
+fn prepare_file(conn: &Connection, profile: &StorageProfile, new: bool) -> anyhow::Result<()> {
+    if new && profile.page_size > 0 {
+        conn.pragma_update(None, "page_size", profile.page_size)?;
+    }
+    let mode: String =
+        conn.pragma_update_and_check(None, "journal_mode", profile.journal_mode.as_sql(), |row| {
+            row.get(0)
+        })?;
+    if !mode.eq_ignore_ascii_case(profile.journal_mode.as_sql()) {
+        warn!(
+            "Database stayed in journal mode {} instead of {}",
+            mode,
+            profile.journal_mode.as_sql()
+        );
+    }
+
+    let expected = index_names();
+    let stale = conn
+        .prepare("SELECT name FROM sqlite_master WHERE type = 'index' AND name GLOB ?1")?
+        .query_map([format!("{}*", INDEX_PREFIX)], |row| {
+            row.get::<_, String>(0)
+        })?
+        .collect::<Result<Vec<_>, _>>()?
+        .into_iter()
+        .filter(|name| !expected.contains(name));
+    for name in stale {
+        debug!("Dropping index {}, this version does not use it", name);
+        conn.execute(&format!("DROP INDEX IF EXISTS \"{}\"", name), [])?;
+    }
+    Ok(())
+}
+
+fn index_name(table: &str, column: &str) -> String {
+    format!("{}{}_{}", index_prefix(), table, column)
+}
+
+/// Names of the indexes this version creates, any other is dropped
+fn index_names() -> Vec<String> {
+    INDEXED_COLUMNS
+        .iter()
+        .map(|(table, column)| index_name(table, column))
+        .collect()
+}
+
+/// Adds the indexes for the filtered columns that don't exist yet
+fn ensure_indexes(conn: &Connection) -> anyhow::Result<()> {
+    for (table, column) in INDEXED_COLUMNS {
+        let present: bool = conn
+            .prepare_cached("SELECT count(*) > 0 FROM pragma_table_info(?1) WHERE name = ?2")?
+            .query_row([table, column], |row| row.get(0))?;
+        if !present {
+            debug!(
+                "Not indexing {}.{}, the schema has no such column",
+                table, column
+            );
+            continue;
+        }
+        conn.execute(
+            &format!(
+                "CREATE INDEX IF NOT EXISTS \"{}\" ON \"{table}\"(\"{column}\")",
+                index_name(table, column)
+            ),
+            [],
+        )?;
+    }
+    // Lets the query planner pick up the new indexes
+    conn.execute_batch("PRAGMA optimize;")?;
+    Ok(())
+}
+
+/// Opens the wallet database at `path` with the settings of `profile`. The
+/// per-connection settings stay applied while the returned settings are kept.
+pub(crate) fn open(
+    path: &Path,
+    profile: &StorageProfile,
+) -> anyhow::Result<(SqliteClient, ConnectionSettings)> {
+    let new = !path.exists();
+    let conn = Connection::open(path).context("Failed to open the wallet database")?;
+    let settings = install_connection_pragmas(&conn, profile)?;
+    if let Err(e) = prepare_file(&conn, profile, new) {
+        warn!("Failed to apply the storage profile: {:#}", e);
+    }
+    drop(conn);
+
+    let db = SqliteClient::open(path.to_path_buf())?;
+
+    match Connection::open(path) {
+        Ok(conn) => {
+            if let Err(e) = ensure_indexes(&conn) {
+                warn!("Failed to create the wallet database indexes: {:#}", e);
+            }
+        }
+        Err(e) => warn!("Failed to open the wallet database for indexing: {}", e),
+    }
+    Ok((db, settings))
+}
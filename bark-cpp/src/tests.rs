@@ -31,6 +31,13 @@ fn setup_test_wallet_opts() -> (tempfile::TempDir, ffi::CreateOpts) {
         htlc_recv_claim_delta: 18,
         vtxo_exit_margin: 12,
         round_tx_required_confirmations: 0,
+        storage: ffi::StorageOpts {
+            journal_mode: "".to_string(),
+            synchronous: "".to_string(),
+            mmap_size: 0,
+            cache_size_kib: 0,
+            page_size: 0,
+        },
     };
 
     let create_opts = ffi::CreateOpts {
@@ -298,7 +305,7 @@ fn test_send_many_onchain_ffi() {
 fn test_board_all_ffi() {
     let _fixture = WalletTestFixture::new();
     // Requires wallet to be funded.
-    let board_all_res = cxx::board_all();
+    let board_all_res = cxx::board_all(ffi::CallLimits::default());
     assert!(
         board_all_res.is_ok(),
         "board_all failed: {:?}",
@@ -343,7 +350,7 @@ fn test_offboard_ffi() {
     let _fixture = WalletTestFixture::new();
     // This test would require creating VTXOs first.
     // We test that the call with no VTXOs doesn't panic.
-    let offboard_all_res = cxx::offboard_all("");
+    let offboard_all_res = cxx::offboard_all("", ffi::CallLimits::default());
     assert!(offboard_all_res.is_ok());
 
     let offboard_specific_res = cxx::offboard_specific(vec![], "");
@@ -363,3 +370,795 @@ fn test_claim_bolt11_payment_ffi() {
     // The key is that it shouldn't panic.
     assert!(claim_res.is_err(), "Claiming an unpaid invoice should fail");
 }
+
+#[test]
+fn test_wallet_snapshot_invalidation() {
+    use crate::snapshot;
+
+    let balance = ffi::OnChainBalance {
+        immature: 0,
+        trusted_pending: 0,
+        untrusted_pending: 0,
+        confirmed: 1_000,
+    };
+
+    // A read that completes without interference is cached
+    snapshot::invalidate();
+    let generation = snapshot::generation();
+    snapshot::store(generation, |s| s.onchain_balance = Some(balance.clone()));
+    assert!(cxx::cached_wallet_snapshot().has_onchain_balance);
+
+    // Starting a mutation drops the cached values
+    let mutation = snapshot::begin_mutation();
+    assert!(!cxx::cached_wallet_snapshot().has_onchain_balance);
+
+    // Reads taken while the mutation runs are never stored
+    let during = snapshot::generation();
+    snapshot::store(during, |s| s.onchain_balance = Some(balance.clone()));
+    assert!(!cxx::cached_wallet_snapshot().has_onchain_balance);
+
+    // Nor are reads that started before it
+    let before = generation;
+    drop(mutation);
+    snapshot::store(before, |s| s.onchain_balance = Some(balance.clone()));
+    assert!(!cxx::cached_wallet_snapshot().has_onchain_balance);
+
+    let after = snapshot::generation();
+    snapshot::store(after, |s| s.first_expiring_vtxo_blockheight = Some(None));
+    let cached = cxx::cached_wallet_snapshot();
+    assert!(cached.has_first_expiring_vtxo_blockheight);
+    assert!(cached.first_expiring_vtxo_blockheight.is_null());
+}
+
+#[test]
+fn test_ffi_history_query_defaults() {
+    let query = crate::utils::ffi_history_query_to_query(&ffi::HistoryQuery {
+        cursor: 0,
+        limit: 0,
+        status: "".to_string(),
+        subsystem_kind: "".to_string(),
+        created_after: 0,
+        created_before: 0,
+        include_metadata: false,
+    });
+    assert_eq!(query.cursor, None);
+    assert_eq!(query.limit, crate::utils::DEFAULT_HISTORY_PAGE_SIZE);
+    assert_eq!(query.status, None);
+    assert_eq!(query.subsystem_kind, None);
+    assert_eq!(query.created_after, None);
+    assert_eq!(query.created_before, None);
+
+    let query = crate::utils::ffi_history_query_to_query(&ffi::HistoryQuery {
+        cursor: 42,
+        limit: 10,
+        status: "finished".to_string(),
+        subsystem_kind: "send".to_string(),
+        created_after: 1_700_000_000,
+        created_before: 1_800_000_000,
+        include_metadata: true,
+    });
+    assert_eq!(query.cursor, Some(42));
+    assert_eq!(query.limit, 10);
+    assert_eq!(query.status.as_deref(), Some("finished"));
+    assert_eq!(query.subsystem_kind.as_deref(), Some("send"));
+    assert_eq!(query.created_after, Some(1_700_000_000));
+    assert_eq!(query.created_before, Some(1_800_000_000));
+}
+
+#[test]
+fn test_wallet_event_diff_and_coalesce() {
+    use crate::events::{self, MOVEMENT_CREATED, MOVEMENT_UPDATED, VTXO_STATE_CHANGED};
+    use std::collections::HashMap;
+
+    let prev = HashMap::from([
+        ("a".to_string(), "Spendable".to_string()),
+        ("b".to_string(), "Spendable".to_string()),
+    ]);
+    let next = HashMap::from([
+        ("a".to_string(), "Locked".to_string()),
+        ("c".to_string(), "Spendable".to_string()),
+    ]);
+    let mut vtxo_events = events::diff_vtxo_states(&prev, &next);
+    vtxo_events.sort_by(|x, y| x.id.cmp(&y.id));
+    let summary = vtxo_events
+        .iter()
+        .map(|e| (e.id.as_str(), e.status.as_str(), e.detail.as_str()))
+        .collect::<Vec<_>>();
+    assert_eq!(
+        summary,
+        vec![
+            ("a", "Locked", "Spendable"),
+            ("b", "Spent", "Spendable"),
+            ("c", "Spendable", ""),
+        ]
+    );
+    assert!(vtxo_events.iter().all(|e| e.kind == VTXO_STATE_CHANGED));
+
+    let prev = HashMap::from([(1, ("pending".to_string(), 10))]);
+    let next = HashMap::from([
+        (1, ("finished".to_string(), 20)),
+        (2, ("pending".to_string(), 30)),
+    ]);
+    let movement_events = events::diff_movements(&prev, &next);
+    assert_eq!(movement_events.len(), 2);
+    assert_eq!(movement_events[0].kind, MOVEMENT_UPDATED);
+    assert_eq!(movement_events[1].kind, MOVEMENT_CREATED);
+
+    // A created movement that is updated within one batch stays created
+    let mut queue = Vec::new();
+    for event in movement_events {
+        events::coalesce(&mut queue, event);
+    }
+    events::coalesce(
+        &mut queue,
+        ffi::WalletEvent {
+            kind: MOVEMENT_UPDATED.to_string(),
+            id: "2".to_string(),
+            status: "finished".to_string(),
+            detail: "pending".to_string(),
+        },
+    );
+    assert_eq!(queue.len(), 2);
+    assert_eq!(queue[1].kind, MOVEMENT_CREATED);
+    assert_eq!(queue[1].status, "finished");
+
+    // A vtxo that returns to its starting state within one batch is dropped
+    for event in vtxo_events {
+        events::coalesce(&mut queue, event);
+    }
+    events::coalesce(
+        &mut queue,
+        ffi::WalletEvent {
+            kind: VTXO_STATE_CHANGED.to_string(),
+            id: "a".to_string(),
+            status: "Spendable".to_string(),
+            detail: "Locked".to_string(),
+        },
+    );
+    assert!(!queue.iter().any(|e| e.id == "a"));
+    assert_eq!(queue.len(), 4);
+}
+
+#[test]
+fn test_lightning_wait_cancel() {
+    let payment_hash = "0".repeat(64);
+    let request_id = cxx::start_check_lightning_payment(payment_hash.clone())
+        .expect("Failed to start lightning wait");
+
+    // Without a loaded wallet the wait either fails right away or is cancelled
+    assert!(cxx::cancel_lightning_wait(&payment_hash) <= 1);
+    let deadline = std::time::Instant::now() + std::time::Duration::from_secs(5);
+    let result = loop {
+        let results = cxx::wait_for_lightning_completions(100);
+        if let Some(result) = results.into_iter().find(|r| r.request_id == request_id) {
+            break result;
+        }
+        assert!(
+            std::time::Instant::now() < deadline,
+            "Lightning wait did not complete"
+        );
+    };
+    assert!(!result.error.is_empty());
+    assert!(result.preimage.is_empty());
+    assert!(result.receive.is_null());
+
+    assert!(cxx::start_check_lightning_payment("not a hash".to_string()).is_err());
+}
+
+#[test]
+fn test_vtxo_columns_layout() {
+    use crate::columnar::{VTXO_COLUMNS_HEADER_LEN, encode_vtxo_columns, vtxo_columns_len};
+
+    let empty = encode_vtxo_columns(&[]);
+    assert_eq!(empty.len(), VTXO_COLUMNS_HEADER_LEN);
+    assert_eq!(u32::from_le_bytes(empty[0..4].try_into().unwrap()), 1);
+    assert_eq!(u32::from_le_bytes(empty[4..8].try_into().unwrap()), 0);
+
+    // 8 header + 15 scalar bytes, padded to 24, then two 36 byte points
+    assert_eq!(vtxo_columns_len(1), 24 + 72);
+    // Columns of 3 vtxos: u64 from 8, u32 from 32, u16 from 44, u8 from 50
+    assert_eq!(vtxo_columns_len(3), 56 + 3 * 72);
+}
+
+#[test]
+fn test_onchain_utxo_filter() {
+    let utxo = |amount_sat, confirmation_height| ffi::OnchainUtxo {
+        outpoint: String::new(),
+        amount_sat,
+        confirmation_height,
+        kind: "external".to_string(),
+    };
+    let keep_all = ffi::OnchainUtxoFilter {
+        min_amount_sat: 0,
+        confirmed_only: false,
+    };
+    assert!(crate::utils::onchain_utxo_matches(&keep_all, &utxo(0, 0)));
+
+    let filter = ffi::OnchainUtxoFilter {
+        min_amount_sat: 1_000,
+        confirmed_only: true,
+    };
+    assert!(crate::utils::onchain_utxo_matches(
+        &filter,
+        &utxo(1_000, 800_000)
+    ));
+    assert!(!crate::utils::onchain_utxo_matches(
+        &filter,
+        &utxo(999, 800_000)
+    ));
+    assert!(!crate::utils::onchain_utxo_matches(
+        &filter,
+        &utxo(5_000, 0)
+    ));
+}
+
+#[test]
+fn test_onchain_sync_checkpoint() {
+    use crate::onchain::{SyncCheckpoint, can_skip_sync, encode_checkpoint, parse_checkpoint};
+
+    let checkpoint = SyncCheckpoint {
+        tip_height: 850_000,
+        synced_at: 1_700_000_000,
+    };
+    assert_eq!(
+        parse_checkpoint(&encode_checkpoint(&checkpoint)),
+        Some(checkpoint)
+    );
+    assert_eq!(parse_checkpoint("not json"), None);
+    assert_eq!(parse_checkpoint(r#"{"tip_height": 1}"#), None);
+
+    // Skipped only while the tip is unchanged and the last sync is recent
+    assert!(can_skip_sync(&checkpoint, 850_000, 1_700_000_060));
+    assert!(!can_skip_sync(&checkpoint, 850_001, 1_700_000_060));
+    assert!(!can_skip_sync(&checkpoint, 850_000, 1_700_003_600));
+}
+
+#[test]
+fn test_maintenance_due_stages() {
+    use crate::scheduler::{
+        STAGE_BOARDS, STAGE_EXITS, STAGE_ONCHAIN, STAGE_REFRESH, STAGE_SYNC, WalletSignals,
+        due_stages, parse_stages, stage_names,
+    };
+
+    // Nothing pending means nothing to do
+    let idle = WalletSignals::default();
+    assert_eq!(due_stages(&idle, 0), 0);
+
+    let busy = WalletSignals {
+        onchain_stale: true,
+        pending_exit: true,
+        refresh_due: true,
+        ..Default::default()
+    };
+    assert_eq!(
+        due_stages(&busy, 0),
+        STAGE_ONCHAIN | STAGE_EXITS | STAGE_REFRESH
+    );
+    // Forced stages always run, the server sync is decided separately
+    assert_eq!(due_stages(&idle, STAGE_SYNC | STAGE_BOARDS), STAGE_BOARDS);
+
+    let names = stage_names(STAGE_REFRESH | STAGE_SYNC);
+    assert_eq!(names, vec!["sync".to_string(), "refresh".to_string()]);
+    assert_eq!(parse_stages(&names).unwrap(), STAGE_SYNC | STAGE_REFRESH);
+    assert!(parse_stages(&["everything".to_string()]).is_err());
+}
+
+#[test]
+fn test_maintenance_groups_cover_stages() {
+    use crate::scheduler::{CONCURRENT_GROUPS, STAGE_REFRESH, STAGE_SYNC, STAGES};
+
+    // Every stage between the server sync and the refresh is in exactly one
+    // concurrent group
+    let mut seen = 0;
+    for stage in CONCURRENT_GROUPS.iter().flat_map(|g| g.iter()) {
+        assert_eq!(seen & stage, 0, "stage {} is in two groups", stage);
+        seen |= stage;
+    }
+    let all = STAGES.iter().fold(0, |mask, (stage, _)| mask | stage);
+    assert_eq!(seen, all & !(STAGE_SYNC | STAGE_REFRESH));
+}
+
+#[test]
+fn test_seed_cache() {
+    use crate::startup::{forget_seed, seed};
+    use bip39::Mnemonic;
+    use std::str::FromStr;
+
+    let first = Mnemonic::from_str(
+        "abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about",
+    )
+    .unwrap();
+    let second = Mnemonic::from_str(
+        "legal winner thank year wave sausage worth useful legal winner thank yellow",
+    )
+    .unwrap();
+
+    forget_seed();
+    let (derived, cached) = seed(&first);
+    assert!(!cached);
+    assert_eq!(derived.as_bytes(), &first.to_seed(""));
+    let (again, cached) = seed(&first);
+    assert!(cached);
+    assert_eq!(again.as_bytes(), derived.as_bytes());
+
+    // A different mnemonic replaces the cached seed
+    let (other, cached) = seed(&second);
+    assert!(!cached);
+    assert_eq!(other.as_bytes(), &second.to_seed(""));
+    assert!(!seed(&first).1);
+
+    // Mnemonic helpers derive their seed locally and leave the cache alone
+    let secp = bark::ark::bitcoin::secp256k1::Secp256k1::new();
+    let network = bark::ark::bitcoin::Network::Regtest;
+    let key = crate::keys::mnemonic_purpose_key(&secp, &second, network).unwrap();
+    let expected = crate::keys::purpose_key(&secp, &second.to_seed(""), network).unwrap();
+    assert_eq!(key, expected);
+    assert!(seed(&first).1);
+
+    forget_seed();
+    assert!(!seed(&first).1);
+}
+
+#[test]
+fn test_latency_histogram_buckets() {
+    use crate::metrics::{HISTOGRAM_BUCKETS, Histogram};
+    use std::time::Duration;
+
+    // Bucket i counts samples below 2^i microseconds
+    assert_eq!(Histogram::bucket_index(0), 0);
+    assert_eq!(Histogram::bucket_index(1), 1);
+    assert_eq!(Histogram::bucket_index(3), 2);
+    assert_eq!(Histogram::bucket_index(4), 3);
+    assert_eq!(Histogram::bucket_index(u64::MAX), HISTOGRAM_BUCKETS - 1);
+
+    let mut histogram = Histogram::default();
+    histogram.record(Duration::from_micros(5));
+    histogram.record(Duration::from_micros(7));
+    histogram.record(Duration::from_secs(3600));
+    assert_eq!(histogram.count, 3);
+    assert_eq!(histogram.max_us, 3_600_000_000);
+    assert_eq!(histogram.sum_us, 3_600_000_012);
+    assert_eq!(histogram.buckets[3], 2);
+    assert_eq!(histogram.buckets[HISTOGRAM_BUCKETS - 1], 1);
+}
+
+#[test]
+fn test_configure_runtime_after_start_fails() {
+    use crate::runtime::{RuntimeConfig, configure};
+
+    // Any earlier call may have started the runtime already, make sure it did
+    crate::TOKIO_RUNTIME.block_on(async {});
+    assert!(
+        configure(RuntimeConfig {
+            worker_threads: 2,
+            ..Default::default()
+        })
+        .is_err()
+    );
+}
+
+#[test]
+fn test_derive_keypair_range() {
+    use crate::keys::{MAX_RANGE, derive_keypair, derive_range, purpose_key, range};
+    use bark::ark::bitcoin::Network;
+    use bark::ark::bitcoin::secp256k1::Secp256k1;
+    use bip39::Mnemonic;
+
+    let mnemonic = Mnemonic::from_str(
+        "abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about",
+    )
+    .unwrap();
+    let secp = Secp256k1::new();
+    let key = purpose_key(&secp, &mnemonic.to_seed(""), Network::Regtest).unwrap();
+
+    // Large enough to be split across threads, and in index order
+    let keypairs = derive_range(&key, 7, 300).unwrap();
+    assert_eq!(keypairs.len(), 300);
+    for (offset, keypair) in keypairs.iter().enumerate() {
+        let index = 7 + offset as u32;
+        assert_eq!(*keypair, derive_keypair(&secp, &key, index).unwrap());
+    }
+
+    assert!(derive_range(&key, 0, 0).unwrap().is_empty());
+    assert!(range(0, MAX_RANGE + 1).is_err());
+    assert!(range(u32::MAX, 2).is_err());
+}
+
+#[test]
+fn test_batch_payments_reject_unparseable_entries() {
+    // Parsing happens before the wallet is touched, so a bad entry fails the
+    // whole batch without a wallet being loaded
+    let outputs = vec![ffi::SendManyOutput {
+        destination: "not-an-ark-address".to_string(),
+        amount_sat: 1000,
+    }];
+    let err = cxx::send_arkoor_many(outputs).unwrap_err();
+    assert!(err.to_string().contains("not-an-ark-address"));
+
+    let payments = vec![ffi::LightningInvoicePayment {
+        invoice: "lnbc-not-an-invoice".to_string(),
+        amount_sat: 0,
+    }];
+    let err = cxx::pay_lightning_invoices(payments).unwrap_err();
+    assert!(err.to_string().contains("lnbc-not-an-invoice"));
+}
+
+#[test]
+fn test_refresh_plan_batches_expiring_vtxos() {
+    use crate::refresh_plan::{Candidate, PlanOpts, PlanReason, plan};
+    use bark::ark::VtxoId;
+
+    let candidate = |vout: u32, sat: u64, expiry_height: u32| Candidate {
+        id: VtxoId::from_str(&format!("{}:{}", "11".repeat(32), vout)).unwrap(),
+        amount: Amount::from_sat(sat),
+        expiry_height,
+    };
+    let opts = PlanOpts {
+        horizon_blocks: 50,
+        ..Default::default()
+    };
+    // tip 1000, due 100 blocks before expiry, one round every 2 blocks
+    let candidates = [
+        candidate(0, 10_000, 1101),
+        candidate(1, 20_000, 1140),
+        candidate(2, 30_000, 1500),
+        candidate(3, 100, 1800),
+    ];
+
+    let refresh = plan(&candidates, 1000, 100, 2, &opts);
+    assert!(refresh.due_now);
+    assert_eq!(refresh.refresh_by, Some(1001));
+    let reasons = refresh
+        .vtxos
+        .iter()
+        .map(|v| (v.candidate.expiry_height, v.reason))
+        .collect::<Vec<_>>();
+    assert_eq!(
+        reasons,
+        vec![
+            (1101, PlanReason::Due),
+            (1140, PlanReason::Horizon),
+            (1800, PlanReason::Dust),
+        ]
+    );
+    assert_eq!(refresh.total, Amount::from_sat(30_100));
+    assert_eq!(refresh.next_refresh_by, Some(1400));
+
+    // Nothing is due yet, the plan still says what the next round will hold
+    let later = plan(&candidates[1..], 1000, 100, 2, &opts);
+    assert!(!later.due_now);
+    assert_eq!(later.refresh_by, Some(1040));
+
+    // Dust alone does not start a round
+    let dust = plan(&candidates[3..], 1000, 100, 2, &opts);
+    assert!(dust.vtxos.is_empty());
+    assert_eq!(dust.refresh_by, None);
+}
+
+#[test]
+fn test_storage_profile_applied_on_open() {
+    use crate::storage::{self, StorageProfile, Synchronous};
+
+    let temp_dir = tempdir().unwrap();
+    let path = temp_dir.path().join(crate::DB_FILE);
+    let profile = StorageProfile {
+        synchronous: Synchronous::Normal,
+        cache_size_kib: 8 * 1024,
+        page_size: 8192,
+        ..Default::default()
+    };
+    let (_db, settings) = storage::open(&path, &profile).unwrap();
+
+    let conn = rusqlite::Connection::open(&path).unwrap();
+    let pragma = |name: &str| {
+        conn.query_row(&format!("PRAGMA {}", name), [], |row| row.get::<_, i64>(0))
+            .unwrap()
+    };
+    let journal_mode: String = conn
+        .query_row("PRAGMA journal_mode", [], |row| row.get(0))
+        .unwrap();
+    assert_eq!(journal_mode, "wal");
+    assert_eq!(pragma("page_size"), 8192);
+    assert_eq!(
+        profile.connection_pragmas(),
+        "PRAGMA synchronous = NORMAL;PRAGMA cache_size = -8192;"
+    );
+    // The settings apply to new connections to this database only
+    assert_eq!(pragma("synchronous"), 1);
+    assert_eq!(pragma("cache_size"), -8192);
+    let other = rusqlite::Connection::open(temp_dir.path().join("other.sqlite")).unwrap();
+    let synchronous: i64 = other
+        .query_row("PRAGMA synchronous", [], |row| row.get(0))
+        .unwrap();
+    assert_eq!(synchronous, 2);
+    drop(settings);
+    let reopened = rusqlite::Connection::open(&path).unwrap();
+    let synchronous: i64 = reopened
+        .query_row("PRAGMA synchronous", [], |row| row.get(0))
+        .unwrap();
+    assert_eq!(synchronous, 2);
+
+    let indexes: i64 = conn
+        .query_row(
+            "SELECT count(*) FROM sqlite_master WHERE type = 'index' AND name GLOB 'bark_cpp_*'",
+            [],
+            |row| row.get(0),
+        )
+        .unwrap();
+    assert!(indexes > 0);
+    assert!("fast".parse::<Synchronous>().is_err());
+}
+
+#[test]
+#[ignore = "requires live regtest backend"]
+fn test_switch_between_open_wallets() {
+    cxx::init_logger();
+    if cxx::is_wallet_loaded() {
+        cxx::close_wallet().unwrap();
+    }
+
+    let mut temp_dirs = Vec::new();
+    let mut datadirs = Vec::new();
+    let mut pubkeys = Vec::new();
+    for _ in 0..2 {
+        let (temp_dir, opts) = setup_test_wallet_opts();
+        let datadir = temp_dir.path().to_str().unwrap().to_string();
+        let (_, mut load_opts) = setup_test_wallet_opts();
+        load_opts.mnemonic = opts.mnemonic.clone();
+        cxx::create_wallet(&datadir, opts).unwrap();
+        cxx::load_wallet(&datadir, load_opts).unwrap();
+        pubkeys.push(cxx::peak_keypair(0).unwrap().public_key);
+        temp_dirs.push(temp_dir);
+        datadirs.push(datadir);
+    }
+    assert_ne!(pubkeys[0], pubkeys[1]);
+
+    // Both stay open, the last loaded one is active
+    assert_eq!(
+        cxx::open_wallets(),
+        vec![datadirs[1].clone(), datadirs[0].clone()]
+    );
+    cxx::select_wallet(&datadirs[0]).unwrap();
+    assert_eq!(cxx::peak_keypair(0).unwrap().public_key, pubkeys[0]);
+
+    // Closing the inactive wallet keeps the active one
+    cxx::close_wallet_at(&datadirs[1]).unwrap();
+    assert!(cxx::is_wallet_loaded());
+    assert!(cxx::select_wallet(&datadirs[1]).is_err());
+
+    cxx::close_wallet().unwrap();
+    assert!(!cxx::is_wallet_loaded());
+    assert!(cxx::open_wallets().is_empty());
+}
+
+#[test]
+fn test_single_flight_shares_overlapping_calls() {
+    use crate::singleflight::Flight;
+    use std::sync::atomic::{AtomicU32, Ordering};
+    use std::time::Duration;
+
+    static FLIGHT: Flight<u32> = Flight::new("test");
+    static RUNS: AtomicU32 = AtomicU32::new(0);
+    let op = |_: crate::ActiveWallet| async {
+        tokio::time::sleep(Duration::from_millis(50)).await;
+        Ok(RUNS.fetch_add(1, Ordering::SeqCst))
+    };
+
+    // Callers that arrive while the first one runs get its result
+    let results = crate::TOKIO_RUNTIME.block_on(async {
+        let calls = (0..4)
+            .map(|_| crate::TOKIO_RUNTIME.spawn(FLIGHT.run(Duration::ZERO, op)))
+            .collect::<Vec<_>>();
+        let mut results = Vec::new();
+        for call in calls {
+            results.push(call.await.unwrap().unwrap());
+        }
+        results
+    });
+    assert_eq!(results, vec![0; 4]);
+    assert_eq!(RUNS.load(Ordering::SeqCst), 1);
+
+    // A later call runs again, unless the result is still fresh
+    let run = |fresh_for| {
+        crate::TOKIO_RUNTIME
+            .block_on(FLIGHT.run(fresh_for, op))
+            .unwrap()
+    };
+    assert_eq!(run(Duration::ZERO), 1);
+    assert_eq!(run(Duration::from_secs(60)), 1);
+    FLIGHT.forget();
+    assert_eq!(run(Duration::from_secs(60)), 2);
+
+    // Errors are shared with overlapping calls but never stay fresh
+    FLIGHT.forget();
+    let failed = crate::TOKIO_RUNTIME
+        .block_on(FLIGHT.run(Duration::from_secs(60), |_| async {
+            anyhow::bail!("server unreachable")
+        }))
+        .unwrap_err();
+    assert_eq!(failed.to_string(), "server unreachable");
+    assert_eq!(run(Duration::from_secs(60)), 3);
+}
+
+#[test]
+fn test_history_export_row_formats() {
+    use crate::history_export::{Format, csv_field, json_row};
+
+    assert_eq!("CSV".parse::<Format>().unwrap(), Format::Csv);
+    assert_eq!("jsonl".parse::<Format>().unwrap(), Format::Jsonl);
+    assert!("xlsx".parse::<Format>().is_err());
+
+    assert_eq!(csv_field("finished"), "finished");
+    assert_eq!(csv_field("a,b"), "\"a,b\"");
+    assert_eq!(csv_field("say \"hi\""), "\"say \"\"hi\"\"\"");
+
+    let movement = ffi::BarkMovement {
+        id: 7,
+        status: "finished".to_string(),
+        subsystem_name: "bark.arkoor".to_string(),
+        subsystem_kind: "send".to_string(),
+        metadata_json: "{\"note\":\"rent\"}".to_string(),
+        intended_balance_sat: -1_000,
+        effective_balance_sat: -1_010,
+        offchain_fee_sat: 10,
+        sent_to: vec![ffi::BarkMovementDestination {
+            destination: "ark1dest".to_string(),
+            payment_method: "ark".to_string(),
+            amount_sat: 1_000,
+        }],
+        received_on: vec![],
+        input_vtxos: vec!["in:0".to_string()],
+        output_vtxos: vec![],
+        exited_vtxos: vec![],
+        created_at: "2025-01-01T00:00:00+00:00".to_string(),
+        updated_at: "2025-01-01T00:00:00+00:00".to_string(),
+        completed_at: String::new(),
+    };
+    let row = json_row(&movement);
+    assert_eq!(row["id"], 7);
+    assert_eq!(row["sent_to"][0]["payment_method"], "ark");
+    // Metadata is embedded as JSON, not as an escaped string
+    assert_eq!(row["metadata"]["note"], "rent");
+}
+
+#[test]
+fn test_log_filter_directives() {
+    use logger::log::LevelFilter;
+
+    // Directives from the bridge come after the default level
+    let filter = cxx::parse_log_filter("bark_cpp::events=trace").unwrap();
+    assert_eq!(filter.level_for("bark"), crate::DEFAULT_LOG_LEVEL);
+    assert_eq!(filter.level_for("bark_cpp::events"), LevelFilter::Trace);
+}
+
+#[test]
+fn test_parse_destination_kinds_and_cache() {
+    use crate::destination::{self, Kind, lnurl_description};
+
+    let onchain = destination::parse("bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t4").unwrap();
+    assert_eq!(onchain.kind, Kind::Onchain);
+    assert!(!onchain.is_expired());
+    // The same string is parsed once
+    let again = destination::parse("bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t4").unwrap();
+    assert!(std::sync::Arc::ptr_eq(&onchain, &again));
+
+    let lnaddr = destination::parse("lightning:satoshi@example.com").unwrap();
+    assert_eq!(lnaddr.kind, Kind::LightningAddress);
+    assert!(destination::ark_address("satoshi@example.com").is_err());
+
+    let err = cxx::parse_destination("definitely-not-a-destination", false).unwrap_err();
+    assert!(err.to_string().contains("definitely-not-a-destination"));
+
+    assert_eq!(
+        lnurl_description(
+            r#"[["text/plain","Pay Satoshi"],["text/identifier","satoshi@example.com"]]"#
+        ),
+        "Pay Satoshi"
+    );
+    assert_eq!(lnurl_description("not json"), "");
+}
+
+#[test]
+fn test_cancel_tokens_and_deadlines() {
+    use crate::cancel::{self, CallLimits};
+    use std::time::Duration;
+
+    let slow = || async {
+        tokio::time::sleep(Duration::from_secs(30)).await;
+        anyhow::Ok(())
+    };
+
+    let timeout = CallLimits {
+        token: 0,
+        timeout: Some(Duration::from_millis(20)),
+    };
+    let err = crate::TOKIO_RUNTIME
+        .block_on(cancel::run("slow", timeout, slow()))
+        .unwrap_err();
+    assert!(err.to_string().contains("timed out"));
+
+    // Cancelling before the call starts stops it at once
+    let token = cancel::create_token();
+    assert!(cancel::cancel(token));
+    let limits = CallLimits {
+        token,
+        timeout: None,
+    };
+    let err = crate::TOKIO_RUNTIME
+        .block_on(cancel::run("slow", limits, slow()))
+        .unwrap_err();
+    assert!(err.to_string().contains("cancelled"));
+
+    // A committed call runs to completion
+    let committed = async {
+        cancel::commit();
+        tokio::time::sleep(Duration::from_millis(50)).await;
+        anyhow::Ok(7)
+    };
+    let out = crate::TOKIO_RUNTIME.block_on(cancel::run("committed", limits, committed));
+    assert_eq!(out.unwrap(), 7);
+
+    // A stop during a step lets it finish and fails the call before the next
+    let steps = std::sync::atomic::AtomicU32::new(0);
+    let stepped = async {
+        for _ in 0..2 {
+            cancel::checkpoint()?;
+            cancel::step(tokio::time::sleep(Duration::from_millis(50))).await;
+            steps.fetch_add(1, std::sync::atomic::Ordering::Relaxed);
+        }
+        anyhow::Ok(())
+    };
+    let err = crate::TOKIO_RUNTIME
+        .block_on(cancel::run("stepped", timeout, stepped))
+        .unwrap_err();
+    assert!(err.to_string().contains("timed out"));
+    assert_eq!(steps.load(std::sync::atomic::Ordering::Relaxed), 1);
+
+    cancel::release(token);
+    assert!(!cancel::cancel(token));
+    assert!(
+        crate::TOKIO_RUNTIME
+            .block_on(cancel::run("slow", limits, slow()))
+            .is_err()
+    );
+}
+
+#[test]
+fn test_alloc_stats_per_subsystem_and_call() {
+    use crate::alloc_stats::{self, Subsystem};
+
+    assert_eq!(
+        alloc_stats::set_thread_subsystem(Subsystem::Runtime),
+        Subsystem::Bridge
+    );
+    assert_eq!(
+        alloc_stats::set_thread_subsystem(Subsystem::Bridge),
+        Subsystem::Runtime
+    );
+
+    // The call's value passes through and the thread returns to its subsystem
+    let len = alloc_stats::track_call("test_alloc", || vec![0u8; 4096].len());
+    assert_eq!(len, 4096);
+    assert_eq!(
+        alloc_stats::set_thread_subsystem(Subsystem::Bridge),
+        Subsystem::Bridge
+    );
+
+    let subsystems = alloc_stats::subsystem_stats();
+    assert_eq!(subsystems.last().map(|s| s.name), Some("sqlite"));
+    let calls = alloc_stats::call_stats();
+    if alloc_stats::enabled() {
+        assert_eq!(subsystems.len(), Subsystem::ALL.len() + 1);
+        let (_, call) = calls
+            .iter()
+            .find(|(name, _)| *name == "test_alloc")
+            .expect("call was tracked");
+        assert!(call.calls >= 1);
+        assert!(call.bytes >= 4096);
+        let wallet = &subsystems[Subsystem::Wallet as usize];
+        assert!(wallet.peak_bytes >= wallet.current_bytes);
+    } else {
+        assert_eq!(subsystems.len(), 1);
+        assert!(calls.is_empty());
+    }
+}
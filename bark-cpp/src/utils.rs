@@ -5,23 +5,23 @@ use bark::{
     Config, Wallet as BarkWallet, WalletVtxo,
     ark::{
         Vtxo, VtxoId,
-        bitcoin::{FeeRate, Network, secp256k1::PublicKey},
+        bitcoin::{FeeRate, Network},
     },
-    lightning_invoice::Bolt11Invoice,
-    lnurllib::lightning_address::LightningAddress,
     movement::{Movement, PaymentMethod},
-    onchain::OnchainWallet,
-    persist::sqlite::SqliteClient,
+    onchain::{OnchainWallet, Utxo},
+    persist::models::LightningReceive,
     round::RoundStatus,
     vtxo::VtxoState,
 };
 
+use bdk_wallet::{KeychainKind, LocalOutput};
 use bitcoin_ext::FeeRateExt;
 use logger::log::{debug, info};
 use tokio::fs;
 use tonic::transport::Uri;
 
 use crate::cxx::ffi;
+use crate::storage::StorageProfile;
 
 pub(crate) const DB_FILE: &str = "db.sqlite";
 
@@ -97,6 +97,7 @@ pub struct ConfigOpts {
     pub htlc_recv_claim_delta: u16,
     pub vtxo_exit_margin: u16,
     pub round_tx_required_confirmations: u32,
+    pub storage: StorageProfile,
 }
 
 #[derive(Debug, Clone)]
@@ -118,6 +119,55 @@ pub struct CreateOpts {
     pub config: ConfigOpts,
 }
 
+/// Filters and page bounds for `history_page`. `None` leaves a filter open.
+#[derive(Debug, Clone, Default)]
+pub struct HistoryQuery {
+    /// Only movements with an id below this one, i.e. older than the cursor
+    pub cursor: Option<u32>,
+    pub limit: usize,
+    pub status: Option<String>,
+    pub subsystem_kind: Option<String>,
+    /// Unix seconds, inclusive
+    pub created_after: Option<i64>,
+    /// Unix seconds, exclusive
+    pub created_before: Option<i64>,
+}
+
+impl HistoryQuery {
+    pub fn matches(&self, movement: &Movement) -> bool {
+        let created_at = movement.time.created_at.timestamp();
+        self.cursor.is_none_or(|cursor| movement.id.0 < cursor)
+            && self
+                .status
+                .as_deref()
+                .is_none_or(|status| movement.status.as_str() == status)
+            && self
+                .subsystem_kind
+                .as_deref()
+                .is_none_or(|kind| movement.subsystem.kind == kind)
+            && self.created_after.is_none_or(|after| created_at >= after)
+            && self.created_before.is_none_or(|before| created_at < before)
+    }
+}
+
+pub(crate) const DEFAULT_HISTORY_PAGE_SIZE: usize = 50;
+
+pub fn ffi_history_query_to_query(query: &ffi::HistoryQuery) -> HistoryQuery {
+    let non_empty = |s: &str| (!s.is_empty()).then(|| s.to_string());
+    let non_zero = |v: u64| (v != 0).then_some(v as i64);
+    HistoryQuery {
+        cursor: (query.cursor != 0).then_some(query.cursor),
+        limit: match query.limit {
+            0 => DEFAULT_HISTORY_PAGE_SIZE,
+            limit => limit as usize,
+        },
+        status: non_empty(&query.status),
+        subsystem_kind: non_empty(&query.subsystem_kind),
+        created_after: non_zero(query.created_after),
+        created_before: non_zero(query.created_before),
+    }
+}
+
 pub enum RefreshMode {
     DefaultThreshold,
     ThresholdBlocks(u32),
@@ -133,6 +183,7 @@ pub(crate) async fn try_create_wallet(
     net: Network,
     config: Config,
     mnemonic: Option<bip39::Mnemonic>,
+    storage: &StorageProfile,
 ) -> anyhow::Result<()> {
     info!("Creating new bark Wallet at {}", datadir.display());
 
@@ -150,7 +201,8 @@ pub(crate) async fn try_create_wallet(
     let seed = mnemonic.to_seed("");
 
     // open db
-    let db = Arc::new(SqliteClient::open(datadir.join(DB_FILE))?);
+    let (db, _settings) = crate::storage::open(&datadir.join(DB_FILE), storage)?;
+    let db = Arc::new(db);
 
     let bdk_wallet = OnchainWallet::load_or_create(net, seed, db.clone()).await?;
     BarkWallet::create_with_onchain(&mnemonic, net, config, db, &bdk_wallet, false)
@@ -160,32 +212,6 @@ pub(crate) async fn try_create_wallet(
     Ok(())
 }
 
-/// Represents the different destinations for the `send` command
-pub enum SendDestination {
-    VtxoPubkey(PublicKey),
-    Bolt11(Bolt11Invoice),
-    LnAddress(LightningAddress),
-    // Potentially add LNURL string later if direct LNURL payment is supported
-}
-
-/// Parses the destination string into a supported type.
-pub fn parse_send_destination(destination: &str) -> anyhow::Result<SendDestination> {
-    if let Ok(pk) = PublicKey::from_str(destination) {
-        Ok(SendDestination::VtxoPubkey(pk))
-    } else if let Ok(invoice) = Bolt11Invoice::from_str(destination) {
-        // Further validation might be needed (e.g., expiry) but basic parsing is enough here
-        Ok(SendDestination::Bolt11(invoice))
-    } else if let Ok(lnaddr) = LightningAddress::from_str(destination) {
-        Ok(SendDestination::LnAddress(lnaddr))
-    } else {
-        // Could check for raw lnurl string here if needed
-        bail!(
-            "Destination is not a valid VTXO pubkey, bolt11 invoice, or lightning address: {}",
-            destination
-        )
-    }
-}
-
 /// Configuration of the Bark wallet.
 /// Merge CreateOpts into ConfigOpts
 pub fn merge_config_opts(opts: CreateOpts) -> anyhow::Result<(Config, Network)> {
@@ -254,6 +280,13 @@ pub fn ffi_config_to_config(opts: ffi::CreateOpts) -> anyhow::Result<CreateOpts>
         htlc_recv_claim_delta: opts.config.htlc_recv_claim_delta,
         vtxo_exit_margin: opts.config.vtxo_exit_margin,
         round_tx_required_confirmations: opts.config.round_tx_required_confirmations,
+        storage: StorageProfile {
+            journal_mode: opts.config.storage.journal_mode.parse()?,
+            synchronous: opts.config.storage.synchronous.parse()?,
+            mmap_size: opts.config.storage.mmap_size,
+            cache_size_kib: opts.config.storage.cache_size_kib,
+            page_size: opts.config.storage.page_size,
+        },
     };
 
     let create_opts = CreateOpts {
@@ -268,45 +301,97 @@ pub fn ffi_config_to_config(opts: ffi::CreateOpts) -> anyhow::Result<CreateOpts>
     Ok(create_opts)
 }
 
-pub fn wallet_vtxo_to_bark_vtxo(wallet_vtxo: WalletVtxo) -> crate::cxx::ffi::BarkVtxo {
-    let state_name = match &wallet_vtxo.state {
+pub fn vtxo_state_name(state: &VtxoState) -> &'static str {
+    match state {
         VtxoState::Spendable => "Spendable",
         VtxoState::Spent => "Spent",
         VtxoState::Locked { movement_id: _ } => "Locked",
     }
-    .to_string();
+}
 
-    crate::cxx::ffi::BarkVtxo {
-        amount: wallet_vtxo.vtxo.amount().to_sat(),
-        expiry_height: wallet_vtxo.vtxo.expiry_height(),
-        server_pubkey: wallet_vtxo.vtxo.server_pubkey().to_string(),
-        exit_delta: wallet_vtxo.vtxo.exit_delta(),
-        anchor_point: format!(
-            "{}:{}",
-            wallet_vtxo.vtxo.chain_anchor().txid,
-            wallet_vtxo.vtxo.chain_anchor().vout
-        ),
-        point: format!(
-            "{}:{}",
-            wallet_vtxo.vtxo.point().txid,
-            wallet_vtxo.vtxo.point().vout
-        ),
-        state: state_name,
-    }
+/// "txid:vout", with room for the longest vout
+const OUTPOINT_STR_LEN: usize = 64 + 1 + 10;
+
+fn outpoint_string(txid: impl std::fmt::Display, vout: u32) -> String {
+    use std::fmt::Write;
+    let mut s = String::with_capacity(OUTPOINT_STR_LEN);
+    let _ = write!(s, "{}:{}", txid, vout);
+    s
 }
 
-pub fn vtxo_to_bark_vtxo(vtxo: &Vtxo) -> crate::cxx::ffi::BarkVtxo {
+fn vtxo_to_ffi(vtxo: &Vtxo, state: &str) -> crate::cxx::ffi::BarkVtxo {
+    let anchor = vtxo.chain_anchor();
+    let point = vtxo.point();
     crate::cxx::ffi::BarkVtxo {
         amount: vtxo.amount().to_sat(),
         expiry_height: vtxo.expiry_height(),
         server_pubkey: vtxo.server_pubkey().to_string(),
         exit_delta: vtxo.exit_delta(),
-        anchor_point: format!("{}:{}", vtxo.chain_anchor().txid, vtxo.chain_anchor().vout),
-        point: format!("{}:{}", vtxo.point().txid, vtxo.point().vout),
-        state: "unknown".to_string(),
+        anchor_point: outpoint_string(anchor.txid, anchor.vout),
+        point: outpoint_string(point.txid, point.vout),
+        state: state.to_string(),
+    }
+}
+
+pub fn wallet_vtxo_to_bark_vtxo(wallet_vtxo: WalletVtxo) -> crate::cxx::ffi::BarkVtxo {
+    vtxo_to_ffi(&wallet_vtxo.vtxo, vtxo_state_name(&wallet_vtxo.state))
+}
+
+/// Converts a list of wallet vtxos, sized up front for the whole list.
+pub fn wallet_vtxos_to_bark_vtxos(wallet_vtxos: Vec<WalletVtxo>) -> Vec<crate::cxx::ffi::BarkVtxo> {
+    wallet_vtxos
+        .iter()
+        .map(|v| vtxo_to_ffi(&v.vtxo, vtxo_state_name(&v.state)))
+        .collect()
+}
+
+pub fn vtxo_to_bark_vtxo(vtxo: &Vtxo) -> crate::cxx::ffi::BarkVtxo {
+    vtxo_to_ffi(vtxo, "unknown")
+}
+
+/// Like `vtxo_to_bark_vtxo`, for a list of vtxos.
+pub fn vtxos_to_bark_vtxos(vtxos: &[Vtxo]) -> Vec<crate::cxx::ffi::BarkVtxo> {
+    vtxos.iter().map(vtxo_to_bark_vtxo).collect()
+}
+
+pub fn local_output_to_ffi(output: &LocalOutput) -> ffi::OnchainUtxo {
+    let kind = match output.keychain {
+        KeychainKind::External => "external",
+        KeychainKind::Internal => "internal",
+    };
+    ffi::OnchainUtxo {
+        outpoint: output.outpoint.to_string(),
+        amount_sat: output.txout.value.to_sat(),
+        confirmation_height: output
+            .chain_position
+            .confirmation_height_upper_bound()
+            .unwrap_or(0),
+        kind: kind.to_string(),
+    }
+}
+
+pub fn utxo_to_ffi(utxo: &Utxo) -> ffi::OnchainUtxo {
+    match utxo {
+        Utxo::Local(local) => ffi::OnchainUtxo {
+            outpoint: local.outpoint.to_string(),
+            amount_sat: local.amount.to_sat(),
+            confirmation_height: local.confirmation_height.unwrap_or(0),
+            kind: "local".to_string(),
+        },
+        Utxo::Exit(exit) => ffi::OnchainUtxo {
+            outpoint: exit.vtxo.point().to_string(),
+            amount_sat: exit.vtxo.amount().to_sat(),
+            confirmation_height: exit.height,
+            kind: "exit".to_string(),
+        },
     }
 }
 
+pub fn onchain_utxo_matches(filter: &ffi::OnchainUtxoFilter, utxo: &ffi::OnchainUtxo) -> bool {
+    utxo.amount_sat >= filter.min_amount_sat
+        && (!filter.confirmed_only || utxo.confirmation_height != 0)
+}
+
 fn payment_method_to_ffi(pm: &PaymentMethod) -> (String, String) {
     match pm {
         PaymentMethod::Ark(addr) => ("ark".to_string(), addr.to_string()),
@@ -327,6 +412,15 @@ fn payment_method_to_ffi(pm: &PaymentMethod) -> (String, String) {
 
 pub fn movement_to_bark_movement(
     movement: &Movement,
+) -> anyhow::Result<crate::cxx::ffi::BarkMovement> {
+    movement_to_bark_movement_with(movement, true)
+}
+
+/// Like `movement_to_bark_movement`, but leaves `metadata_json` empty unless
+/// `include_metadata` is set, since serializing it dominates list conversions.
+pub fn movement_to_bark_movement_with(
+    movement: &Movement,
+    include_metadata: bool,
 ) -> anyhow::Result<crate::cxx::ffi::BarkMovement> {
     let sent_to: Vec<crate::cxx::ffi::BarkMovementDestination> = movement
         .sent_to
@@ -354,7 +448,11 @@ pub fn movement_to_bark_movement(
         })
         .collect();
 
-    let metadata_json = serde_json::to_string(&movement.metadata)?;
+    let metadata_json = if include_metadata {
+        serde_json::to_string(&movement.metadata)?
+    } else {
+        String::new()
+    };
 
     let input_vtxos: Vec<String> = movement.input_vtxos.iter().map(|v| v.to_string()).collect();
     let output_vtxos: Vec<String> = movement
@@ -396,11 +494,25 @@ pub fn movement_to_bark_movement(
     })
 }
 
-pub fn round_status_to_ffi(status: RoundStatus) -> crate::cxx::ffi::RoundStatus {
+pub fn lightning_receive_to_ffi(receive: &LightningReceive) -> ffi::LightningReceive {
+    ffi::LightningReceive {
+        payment_hash: receive.payment_hash.to_string(),
+        payment_preimage: receive.payment_preimage.to_string(),
+        invoice: receive.invoice.to_string(),
+        preimage_revealed_at: receive.preimage_revealed_at.map_or(std::ptr::null(), |v| {
+            Box::into_raw(Box::new(v.timestamp() as u64))
+        }),
+        finished_at: receive.finished_at.map_or(std::ptr::null(), |v| {
+            Box::into_raw(Box::new(v.timestamp() as u64))
+        }),
+    }
+}
+
+pub fn round_status_to_ffi(status: &RoundStatus) -> crate::cxx::ffi::RoundStatus {
     let is_final = status.is_final();
     let is_success = status.is_success();
 
-    let (status_str, funding_txid, unsigned_funding_txids, error) = match &status {
+    let (status_str, funding_txid, unsigned_funding_txids, error) = match status {
         RoundStatus::Confirmed { funding_txid } => (
             "confirmed".to_string(),
             funding_txid.to_string(),
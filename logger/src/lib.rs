@@ -1,42 +1,332 @@
 // Re-export the log crate for consumers of this library
 pub extern crate log;
 
+use std::collections::VecDeque;
+use std::fmt;
+use std::str::FromStr;
+use std::sync::atomic::{AtomicUsize, Ordering};
+use std::sync::{Mutex, MutexGuard, OnceLock, RwLock};
+use std::time::{SystemTime, UNIX_EPOCH};
+
 #[cfg(target_os = "android")]
-use android_logger::Config;
-use log::LevelFilter;
+use android_logger::{AndroidLogger, Config};
+use log::{LevelFilter, Log, Metadata, Record};
 #[cfg(target_os = "ios")]
 use oslog::OsLogger;
 
-pub struct Logger {}
+/// Which records reach the system log, parsed from `env_logger` style
+/// directives: `info,bark=warn,bark_cpp::events=debug`. A bare level sets the
+/// default, `module=level` overrides it for that module and its children.
+#[derive(Clone, Debug, PartialEq, Eq)]
+pub struct Filter {
+    default: LevelFilter,
+    // Sorted by descending length, so the first match is the most specific
+    modules: Vec<(String, LevelFilter)>,
+}
 
-impl Logger {
+impl Filter {
+    pub fn new(default: LevelFilter) -> Self {
+        Filter {
+            default,
+            modules: Vec::new(),
+        }
+    }
+
+    pub fn level_for(&self, target: &str) -> LevelFilter {
+        self.modules
+            .iter()
+            .find(|(module, _)| {
+                target
+                    .strip_prefix(module.as_str())
+                    .is_some_and(|rest| rest.is_empty() || rest.starts_with("::"))
+            })
+            .map_or(self.default, |(_, level)| *level)
+    }
+
+    /// Most verbose level any module is logged at
+    pub fn max_level(&self) -> LevelFilter {
+        self.modules
+            .iter()
+            .map(|(_, level)| *level)
+            .fold(self.default, LevelFilter::max)
+    }
+}
+
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct ParseFilterError(String);
+
+impl fmt::Display for ParseFilterError {
+    fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+        write!(f, "invalid log filter directive '{}'", self.0)
+    }
+}
+
+impl std::error::Error for ParseFilterError {}
+
+impl FromStr for Filter {
+    type Err = ParseFilterError;
+
+    fn from_str(spec: &str) -> Result<Self, ParseFilterError> {
+        let mut filter = Filter::new(LevelFilter::Info);
+        for directive in spec.split(',').map(str::trim).filter(|d| !d.is_empty()) {
+            let invalid = || ParseFilterError(directive.to_string());
+            match directive.split_once('=') {
+                Some((module, level)) => {
+                    let level = level.trim().parse().map_err(|_| invalid())?;
+                    let module = module.trim();
+                    if module.is_empty() {
+                        return Err(invalid());
+                    }
+                    filter.modules.retain(|(m, _)| m != module);
+                    filter.modules.push((module.to_string(), level));
+                }
+                None => filter.default = directive.parse().map_err(|_| invalid())?,
+            }
+        }
+        filter.modules.sort_by(|a, b| b.0.len().cmp(&a.0.len()));
+        Ok(filter)
+    }
+}
+
+/// How logging is set up at init. See `Logger::configure` to change it later.
+#[derive(Clone, Debug, PartialEq, Eq)]
+pub struct LogConfig {
+    pub filter: Filter,
+    /// Lines kept in memory for `dump`, 0 disables the buffer
+    pub ring_capacity: usize,
+    /// Records at or above this level go to the buffer, independent of
+    /// `filter`, so it can hold detail the system log doesn't get
+    pub ring_level: LevelFilter,
+}
+
+impl LogConfig {
     pub fn new(level: LevelFilter) -> Self {
-        #[cfg(target_os = "android")]
-        {
-            android_logger::init_once(Config::default().with_max_level(level).with_tag("NitroArk"));
-            log::info!("Android logger initialized.");
+        LogConfig {
+            filter: Filter::new(level),
+            ring_capacity: 0,
+            ring_level: LevelFilter::Debug,
         }
+    }
+}
+
+struct Ring {
+    capacity: usize,
+    level: LevelFilter,
+    lines: VecDeque<String>,
+}
+
+/// Filters records before they reach the platform logger and keeps the
+/// optional ring buffer
+struct Dispatch {
+    sink: Box<dyn Log>,
+    filter: RwLock<Filter>,
+    // `Ring::active_level` as a number, so records skip the ring lock while
+    // the buffer is off or they are too verbose for it
+    ring_level: AtomicUsize,
+    ring: Mutex<Ring>,
+}
+
+static DISPATCH: OnceLock<&'static Dispatch> = OnceLock::new();
+
+impl Dispatch {
+    fn filter(&self) -> Filter {
+        self.filter
+            .read()
+            .unwrap_or_else(|e| e.into_inner())
+            .clone()
+    }
 
-        #[cfg(target_os = "ios")]
-        {
-            OsLogger::new("com.nitro.ark")
-                .level_filter(level)
-                .init()
-                .unwrap();
-            log::info!("oslog initialized.");
+    fn ring(&self) -> MutexGuard<'_, Ring> {
+        self.ring.lock().unwrap_or_else(|e| e.into_inner())
+    }
+
+    fn apply(&self, config: LogConfig) {
+        let ring_level = {
+            let mut ring = self.ring();
+            ring.capacity = config.ring_capacity;
+            ring.level = config.ring_level;
+            while ring.lines.len() > ring.capacity {
+                ring.lines.pop_front();
+            }
+            ring.active_level()
+        };
+        self.ring_level
+            .store(ring_level as usize, Ordering::Relaxed);
+        let max = config.filter.max_level().max(ring_level);
+        *self.filter.write().unwrap_or_else(|e| e.into_inner()) = config.filter;
+        // Records above the max level are dropped by the log macros before
+        // their arguments are formatted
+        log::set_max_level(max);
+    }
+
+    fn to_ring(&self, metadata: &Metadata) -> bool {
+        metadata.level() as usize <= self.ring_level.load(Ordering::Relaxed)
+    }
+
+    fn to_sink(&self, metadata: &Metadata) -> bool {
+        metadata.level()
+            <= self
+                .filter
+                .read()
+                .unwrap_or_else(|e| e.into_inner())
+                .level_for(metadata.target())
+    }
+}
+
+impl Ring {
+    fn active_level(&self) -> LevelFilter {
+        if self.capacity == 0 {
+            LevelFilter::Off
+        } else {
+            self.level
         }
+    }
 
-        #[cfg(not(any(target_os = "android", target_os = "ios")))]
-        {
+    fn push(&mut self, record: &Record) {
+        if self.lines.len() >= self.capacity {
+            self.lines.pop_front();
+        }
+        let ms = SystemTime::now()
+            .duration_since(UNIX_EPOCH)
+            .map_or(0, |d| d.as_millis());
+        self.lines.push_back(format!(
+            "{} {} {}: {}",
+            ms,
+            record.level(),
+            record.target(),
+            record.args()
+        ));
+    }
+}
+
+impl Log for Dispatch {
+    fn enabled(&self, metadata: &Metadata) -> bool {
+        self.to_sink(metadata) || self.to_ring(metadata)
+    }
+
+    fn log(&self, record: &Record) {
+        if self.to_sink(record.metadata()) {
+            self.sink.log(record);
+        }
+        if self.to_ring(record.metadata()) {
+            let mut ring = self.ring();
+            if ring.capacity > 0 {
+                ring.push(record);
+            }
+        }
+    }
+
+    fn flush(&self) {
+        self.sink.flush();
+    }
+}
+
+/// Platform logger that passes every record, filtering happens in `Dispatch`
+fn platform_sink() -> Box<dyn Log> {
+    #[cfg(target_os = "android")]
+    {
+        Box::new(AndroidLogger::new(
+            Config::default()
+                .with_max_level(LevelFilter::Trace)
+                .with_tag("NitroArk"),
+        ))
+    }
+
+    #[cfg(target_os = "ios")]
+    {
+        Box::new(OsLogger::new("com.nitro.ark").level_filter(LevelFilter::Trace))
+    }
+
+    #[cfg(not(any(target_os = "android", target_os = "ios")))]
+    {
+        Box::new(
             env_logger::builder()
-                .filter_level(level)
+                .filter_level(LevelFilter::Trace)
                 .parse_default_env()
-                .init();
-            log::info!("Standard (env_logger) initialized.");
-        }
+                .build(),
+        )
+    }
+}
 
+pub struct Logger {}
+
+impl Logger {
+    pub fn new(level: LevelFilter) -> Self {
+        Logger::with_config(LogConfig::new(level))
+    }
+
+    /// Installs the logger. Later calls only apply `config`.
+    pub fn with_config(config: LogConfig) -> Self {
+        let mut installed = false;
+        let dispatch = DISPATCH.get_or_init(|| {
+            installed = true;
+            Box::leak(Box::new(Dispatch {
+                sink: platform_sink(),
+                filter: RwLock::new(Filter::new(LevelFilter::Off)),
+                ring_level: AtomicUsize::new(0),
+                ring: Mutex::new(Ring {
+                    capacity: 0,
+                    level: LevelFilter::Off,
+                    lines: VecDeque::new(),
+                }),
+            }))
+        });
+        dispatch.apply(config);
+        if installed {
+            if log::set_logger(*dispatch).is_err() {
+                eprintln!("Another logger is already installed, NitroArk logging is disabled");
+            }
+            log::info!("Logger initialized.");
+        }
         Logger {}
     }
+
+    /// Replaces the filter and ring buffer settings of the installed logger
+    pub fn configure(config: LogConfig) {
+        Logger::with_config(config);
+    }
+
+    /// Replaces only the filter, keeping the ring buffer settings
+    pub fn set_filter(filter: Filter) {
+        match DISPATCH.get() {
+            Some(dispatch) => {
+                let (ring_capacity, ring_level) = {
+                    let ring = dispatch.ring();
+                    (ring.capacity, ring.level)
+                };
+                dispatch.apply(LogConfig {
+                    filter,
+                    ring_capacity,
+                    ring_level,
+                });
+            }
+            None => {
+                Logger::with_config(LogConfig {
+                    filter,
+                    ..LogConfig::new(LevelFilter::Off)
+                });
+            }
+        }
+    }
+
+    /// Current filter, `None` before the logger is installed
+    pub fn filter() -> Option<Filter> {
+        DISPATCH.get().map(|dispatch| dispatch.filter())
+    }
+
+    /// Lines held by the ring buffer, oldest first
+    pub fn dump() -> Vec<String> {
+        DISPATCH
+            .get()
+            .map(|dispatch| dispatch.ring().lines.iter().cloned().collect())
+            .unwrap_or_default()
+    }
+
+    pub fn clear_dump() {
+        if let Some(dispatch) = DISPATCH.get() {
+            dispatch.ring().lines.clear();
+        }
+    }
 }
 
 impl Default for Logger {
@@ -44,3 +334,27 @@ impl Default for Logger {
         Logger::new(LevelFilter::Debug)
     }
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_filter_directives() {
+        let filter: Filter = "warn,bark=info,bark::round=trace".parse().unwrap();
+        assert_eq!(filter.level_for("bark_cpp"), LevelFilter::Warn);
+        assert_eq!(filter.level_for("bark::movement"), LevelFilter::Info);
+        // The most specific module wins
+        assert_eq!(filter.level_for("bark::round::signing"), LevelFilter::Trace);
+        // Only whole path segments match
+        assert_eq!(filter.level_for("barkley"), LevelFilter::Warn);
+        assert_eq!(filter.max_level(), LevelFilter::Trace);
+
+        assert_eq!(
+            "".parse::<Filter>().unwrap(),
+            Filter::new(LevelFilter::Info)
+        );
+        assert!("bark=loud".parse::<Filter>().is_err());
+        assert!("=debug".parse::<Filter>().is_err());
+    }
+}
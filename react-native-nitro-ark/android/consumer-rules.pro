@@ -0,0 +1,4 @@
+# NitroArkJni.cpp looks these classes and their constructors up by name in
+# JNI_OnLoad and fails to load the library when one is missing, so R8 must
+# neither strip nor rename them in minified apps.
+-keep class com.margelo.nitro.nitroark.*Result* { <init>(...); }
@@ -1,19 +1,94 @@
 #include <android/log.h>
+#include <algorithm>
 #include <cstdint>
 #include <exception>
 #include <jni.h>
 #include <optional>
 #include <stdexcept>
 #include <string>
-#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "NitroArkJni.hpp"
 #include "generated/ark_cxx.h"
 
 namespace {
 
 constexpr const char* LOG_TAG = "NitroArkJni";
 
+// Global class references and method IDs, resolved once in InitializeJniCache.
+// JNI IDs stay valid for as long as their class is loaded, which the global
+// references guarantee.
+struct JniCache {
+  jclass runtimeExceptionClass = nullptr;
+  jclass integerClass = nullptr;
+  jmethodID integerIntValue = nullptr;
+  jclass longClass = nullptr;
+  jmethodID longLongValue = nullptr;
+  jclass listClass = nullptr;
+  jmethodID listSize = nullptr;
+  jmethodID listGet = nullptr;
+  jclass arrayListClass = nullptr;
+  jmethodID arrayListCtor = nullptr;
+  jmethodID arrayListAdd = nullptr;
+  jclass keyPairResultClass = nullptr;
+  jmethodID keyPairResultCtor = nullptr;
+  jclass bolt11InvoiceClass = nullptr;
+  jmethodID bolt11InvoiceCtor = nullptr;
+  jclass offchainBalanceClass = nullptr;
+  jmethodID offchainBalanceCtor = nullptr;
+  jclass onchainBalanceClass = nullptr;
+  jmethodID onchainBalanceCtor = nullptr;
+  jclass vtxoClass = nullptr;
+  jmethodID vtxoCtor = nullptr;
+  jclass movementDestinationClass = nullptr;
+  jmethodID movementDestinationCtor = nullptr;
+  jclass movementClass = nullptr;
+  jmethodID movementCtor = nullptr;
+};
+
+JniCache gJni;
+
+// Deletes a local reference when it goes out of scope. Used by the helpers
+// that build objects from many fields, so every early return cleans up.
+template <typename T> class ScopedLocalRef {
+public:
+  ScopedLocalRef(JNIEnv* env, T ref) : env_(env), ref_(ref) {}
+  ~ScopedLocalRef() {
+    if (ref_ != nullptr) {
+      env_->DeleteLocalRef(ref_);
+    }
+  }
+  ScopedLocalRef(const ScopedLocalRef&) = delete;
+  ScopedLocalRef& operator=(const ScopedLocalRef&) = delete;
+
+  T get() const { return ref_; }
+  explicit operator bool() const { return ref_ != nullptr; }
+
+private:
+  JNIEnv* env_;
+  T ref_;
+};
+
+jclass FindGlobalClass(JNIEnv* env, const char* className) {
+  jclass local = env->FindClass(className);
+  if (local == nullptr) {
+    __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "JNI class not found: %s", className);
+    return nullptr;
+  }
+  auto global = static_cast<jclass>(env->NewGlobalRef(local));
+  env->DeleteLocalRef(local);
+  return global;
+}
+
+jmethodID FindMethod(JNIEnv* env, jclass cls, const char* methodName, const char* methodSig) {
+  jmethodID mid = env->GetMethodID(cls, methodName, methodSig);
+  if (mid == nullptr) {
+    __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "JNI method not found: %s%s", methodName, methodSig);
+  }
+  return mid;
+}
+
 // Convert a jstring to a std::string, handling null safely.
 std::string JStringToString(JNIEnv* env, jstring jStr) {
   if (jStr == nullptr) {
@@ -29,47 +104,22 @@ std::string JStringToString(JNIEnv* env, jstring jStr) {
 }
 
 void ThrowJavaException(JNIEnv* env, const char* message) {
-  jclass exClass = env->FindClass("java/lang/RuntimeException");
-  if (exClass != nullptr) {
-    env->ThrowNew(exClass, message);
-    env->DeleteLocalRef(exClass);
-  }
+  env->ThrowNew(gJni.runtimeExceptionClass, message);
   __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, "Throwing Java exception: %s", message);
 }
 
-template <typename T, typename J>
-std::optional<T> GetOptionalNumber(JNIEnv* env, jobject obj, const char* className, const char* methodName,
-                                   const char* methodSig) {
+std::optional<int32_t> GetOptionalInt(JNIEnv* env, jobject obj) {
   if (obj == nullptr) {
     return std::nullopt;
   }
-  jclass cls = env->FindClass(className);
-  if (cls == nullptr) {
-    return std::nullopt;
-  }
-
-  std::optional<T> result = std::nullopt;
-  jmethodID mid = env->GetMethodID(cls, methodName, methodSig);
-  if (mid != nullptr) {
-    if constexpr (std::is_same_v<J, jint>) {
-      jint value = env->CallIntMethod(obj, mid);
-      result = static_cast<T>(value);
-    } else if constexpr (std::is_same_v<J, jlong>) {
-      jlong value = env->CallLongMethod(obj, mid);
-      result = static_cast<T>(value);
-    }
-  }
-
-  env->DeleteLocalRef(cls);
-  return result;
-}
-
-std::optional<int32_t> GetOptionalInt(JNIEnv* env, jobject obj) {
-  return GetOptionalNumber<int32_t, jint>(env, obj, "java/lang/Integer", "intValue", "()I");
+  return static_cast<int32_t>(env->CallIntMethod(obj, gJni.integerIntValue));
 }
 
 std::optional<int64_t> GetOptionalLong(JNIEnv* env, jobject obj) {
-  return GetOptionalNumber<int64_t, jlong>(env, obj, "java/lang/Long", "longValue", "()J");
+  if (obj == nullptr) {
+    return std::nullopt;
+  }
+  return static_cast<int64_t>(env->CallLongMethod(obj, gJni.longLongValue));
 }
 
 void HandleException(JNIEnv* env, const std::exception& e) {
@@ -83,100 +133,41 @@ void HandleUnknownException(JNIEnv* env) {
 }
 
 // Helpers to construct Java/Kotlin objects for return values.
-jobject MakeArrayList(JNIEnv* env, const std::vector<std::string>& elements) {
-  jclass arrayListClass = env->FindClass("java/util/ArrayList");
-  if (arrayListClass == nullptr)
-    return nullptr;
-  jmethodID arrayListCtor = env->GetMethodID(arrayListClass, "<init>", "()V");
-  jmethodID arrayListAdd = env->GetMethodID(arrayListClass, "add", "(Ljava/lang/Object;)Z");
-  if (arrayListCtor == nullptr || arrayListAdd == nullptr) {
-    env->DeleteLocalRef(arrayListClass);
-    return nullptr;
-  }
-
-  jobject arrayListObj = env->NewObject(arrayListClass, arrayListCtor);
-  if (arrayListObj == nullptr) {
-    env->DeleteLocalRef(arrayListClass);
-    return nullptr;
-  }
-
-  for (const auto& element : elements) {
-    jstring jStr = env->NewStringUTF(element.c_str());
-    if (jStr == nullptr) {
-      env->DeleteLocalRef(arrayListObj);
-      env->DeleteLocalRef(arrayListClass);
-      return nullptr;
-    }
-    env->CallBooleanMethod(arrayListObj, arrayListAdd, jStr);
-    env->DeleteLocalRef(jStr);
-    if (env->ExceptionCheck()) {
-      env->DeleteLocalRef(arrayListObj);
-      env->DeleteLocalRef(arrayListClass);
-      return nullptr;
-    }
-  }
-  env->DeleteLocalRef(arrayListClass);
-  return arrayListObj;
-}
-
 jobject MakeKeyPairResult(JNIEnv* env, const bark_cxx::KeyPairResult& keypair) {
-  jclass cls = env->FindClass("com/margelo/nitro/nitroark/KeyPairResultAndroid");
-  if (cls == nullptr)
-    return nullptr;
-  jmethodID ctor = env->GetMethodID(cls, "<init>", "(Ljava/lang/String;Ljava/lang/String;)V");
-  if (ctor == nullptr) {
-    env->DeleteLocalRef(cls);
-    return nullptr;
-  }
-
   std::string pub(keypair.public_key.data(), keypair.public_key.length());
   std::string sec(keypair.secret_key.data(), keypair.secret_key.length());
 
   jstring jPub = env->NewStringUTF(pub.c_str());
   if (jPub == nullptr) {
-    env->DeleteLocalRef(cls);
     return nullptr;
   }
 
   jstring jSec = env->NewStringUTF(sec.c_str());
   if (jSec == nullptr) {
     env->DeleteLocalRef(jPub);
-    env->DeleteLocalRef(cls);
     return nullptr;
   }
 
-  jobject result = env->NewObject(cls, ctor, jPub, jSec);
+  jobject result = env->NewObject(gJni.keyPairResultClass, gJni.keyPairResultCtor, jPub, jSec);
 
   env->DeleteLocalRef(jPub);
   env->DeleteLocalRef(jSec);
-  env->DeleteLocalRef(cls);
   return result;
 }
 
 jobject MakeBolt11Invoice(JNIEnv* env, const bark_cxx::Bolt11Invoice& invoice) {
-  jclass cls = env->FindClass("com/margelo/nitro/nitroark/Bolt11InvoiceResult");
-  if (cls == nullptr)
-    return nullptr;
-  jmethodID ctor = env->GetMethodID(cls, "<init>", "(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;)V");
-  if (ctor == nullptr) {
-    env->DeleteLocalRef(cls);
-    return nullptr;
-  }
-
   std::string bolt11(invoice.bolt11_invoice.data(), invoice.bolt11_invoice.length());
   std::string paymentSecret(invoice.payment_secret.data(), invoice.payment_secret.length());
   std::string paymentHash(invoice.payment_hash.data(), invoice.payment_hash.length());
 
   jstring jBolt11 = env->NewStringUTF(bolt11.c_str());
   if (jBolt11 == nullptr) {
-    env->DeleteLocalRef(cls);
     return nullptr;
   }
 
   jstring jSecret = env->NewStringUTF(paymentSecret.c_str());
   if (jSecret == nullptr) {
     env->DeleteLocalRef(jBolt11);
-    env->DeleteLocalRef(cls);
     return nullptr;
   }
 
@@ -184,23 +175,232 @@ jobject MakeBolt11Invoice(JNIEnv* env, const bark_cxx::Bolt11Invoice& invoice) {
   if (jHash == nullptr) {
     env->DeleteLocalRef(jBolt11);
     env->DeleteLocalRef(jSecret);
-    env->DeleteLocalRef(cls);
     return nullptr;
   }
 
-  jobject result = env->NewObject(cls, ctor, jBolt11, jSecret, jHash);
+  jobject result = env->NewObject(gJni.bolt11InvoiceClass, gJni.bolt11InvoiceCtor, jBolt11, jSecret, jHash);
 
   env->DeleteLocalRef(jBolt11);
   env->DeleteLocalRef(jSecret);
   env->DeleteLocalRef(jHash);
-  env->DeleteLocalRef(cls);
   return result;
 }
 
+jstring NewJString(JNIEnv* env, const rust::String& value) {
+  std::string str(value.data(), value.length());
+  return env->NewStringUTF(str.c_str());
+}
+
+// Returns null for an empty string, which the bridge uses for absent values.
+jstring NewOptionalJString(JNIEnv* env, const rust::String& value) {
+  return value.length() == 0 ? nullptr : NewJString(env, value);
+}
+
+// Builds a java.util.ArrayList from a Rust vector, converting each element
+// with `makeItem`. Element references are released as soon as they are added
+// so large lists do not exhaust the local reference table.
+template <typename T, typename F> jobject MakeList(JNIEnv* env, const rust::Vec<T>& items, F&& makeItem) {
+  jobject list = env->NewObject(gJni.arrayListClass, gJni.arrayListCtor, static_cast<jint>(items.size()));
+  if (list == nullptr) {
+    return nullptr;
+  }
+
+  for (const auto& item : items) {
+    jobject element = makeItem(env, item);
+    if (element == nullptr) {
+      env->DeleteLocalRef(list);
+      return nullptr;
+    }
+    env->CallBooleanMethod(list, gJni.arrayListAdd, element);
+    env->DeleteLocalRef(element);
+    if (env->ExceptionCheck()) {
+      env->DeleteLocalRef(list);
+      return nullptr;
+    }
+  }
+  return list;
+}
+
+jobject MakeStringList(JNIEnv* env, const rust::Vec<rust::String>& items) {
+  return MakeList(env, items, [](JNIEnv* env, const rust::String& item) -> jobject { return NewJString(env, item); });
+}
+
+rust::Vec<rust::String> ToRustStringVec(JNIEnv* env, jobject list) {
+  rust::Vec<rust::String> result;
+  if (list == nullptr) {
+    return result;
+  }
+  jint size = env->CallIntMethod(list, gJni.listSize);
+  result.reserve(static_cast<size_t>(size));
+  for (jint i = 0; i < size; i++) {
+    ScopedLocalRef<jstring> item(env, static_cast<jstring>(env->CallObjectMethod(list, gJni.listGet, i)));
+    if (env->ExceptionCheck()) {
+      throw std::runtime_error("Failed to read list element");
+    }
+    result.push_back(rust::String(JStringToString(env, item.get())));
+  }
+  return result;
+}
+
+jobject MakeOffchainBalance(JNIEnv* env, const bark_cxx::OffchainBalance& balance) {
+  return env->NewObject(gJni.offchainBalanceClass, gJni.offchainBalanceCtor, static_cast<jlong>(balance.spendable),
+                        static_cast<jlong>(balance.pending_lightning_send),
+                        static_cast<jlong>(balance.pending_in_round), static_cast<jlong>(balance.pending_exit),
+                        static_cast<jlong>(balance.pending_board));
+}
+
+jobject MakeOnchainBalance(JNIEnv* env, const bark_cxx::OnChainBalance& balance) {
+  return env->NewObject(gJni.onchainBalanceClass, gJni.onchainBalanceCtor, static_cast<jlong>(balance.immature),
+                        static_cast<jlong>(balance.trusted_pending), static_cast<jlong>(balance.untrusted_pending),
+                        static_cast<jlong>(balance.confirmed));
+}
+
+jobject MakeVtxo(JNIEnv* env, const bark_cxx::BarkVtxo& vtxo) {
+  ScopedLocalRef<jstring> serverPubkey(env, NewJString(env, vtxo.server_pubkey));
+  ScopedLocalRef<jstring> anchorPoint(env, NewJString(env, vtxo.anchor_point));
+  ScopedLocalRef<jstring> point(env, NewJString(env, vtxo.point));
+  ScopedLocalRef<jstring> state(env, NewJString(env, vtxo.state));
+  if (!serverPubkey || !anchorPoint || !point || !state) {
+    return nullptr;
+  }
+  return env->NewObject(gJni.vtxoClass, gJni.vtxoCtor, static_cast<jlong>(vtxo.amount),
+                        static_cast<jint>(vtxo.expiry_height), serverPubkey.get(), static_cast<jint>(vtxo.exit_delta),
+                        anchorPoint.get(), point.get(), state.get());
+}
+
+jobject MakeVtxoList(JNIEnv* env, const rust::Vec<bark_cxx::BarkVtxo>& vtxos) {
+  return MakeList(env, vtxos, MakeVtxo);
+}
+
+jobject MakeMovementDestination(JNIEnv* env, const bark_cxx::BarkMovementDestination& destination) {
+  ScopedLocalRef<jstring> address(env, NewJString(env, destination.destination));
+  ScopedLocalRef<jstring> paymentMethod(env, NewJString(env, destination.payment_method));
+  if (!address || !paymentMethod) {
+    return nullptr;
+  }
+  return env->NewObject(gJni.movementDestinationClass, gJni.movementDestinationCtor, address.get(),
+                        paymentMethod.get(), static_cast<jlong>(destination.amount_sat));
+}
+
+jobject MakeMovement(JNIEnv* env, const bark_cxx::BarkMovement& movement) {
+  ScopedLocalRef<jstring> status(env, NewJString(env, movement.status));
+  ScopedLocalRef<jstring> subsystemName(env, NewJString(env, movement.subsystem_name));
+  ScopedLocalRef<jstring> subsystemKind(env, NewJString(env, movement.subsystem_kind));
+  ScopedLocalRef<jstring> metadataJson(env, NewJString(env, movement.metadata_json));
+  ScopedLocalRef<jobject> sentTo(env, MakeList(env, movement.sent_to, MakeMovementDestination));
+  ScopedLocalRef<jobject> receivedOn(env, MakeList(env, movement.received_on, MakeMovementDestination));
+  ScopedLocalRef<jobject> inputVtxos(env, MakeStringList(env, movement.input_vtxos));
+  ScopedLocalRef<jobject> outputVtxos(env, MakeStringList(env, movement.output_vtxos));
+  ScopedLocalRef<jobject> exitedVtxos(env, MakeStringList(env, movement.exited_vtxos));
+  ScopedLocalRef<jstring> createdAt(env, NewJString(env, movement.created_at));
+  ScopedLocalRef<jstring> updatedAt(env, NewJString(env, movement.updated_at));
+  ScopedLocalRef<jstring> completedAt(env, NewOptionalJString(env, movement.completed_at));
+  if (!status || !subsystemName || !subsystemKind || !metadataJson || !sentTo || !receivedOn || !inputVtxos ||
+      !outputVtxos || !exitedVtxos || !createdAt || !updatedAt || env->ExceptionCheck()) {
+    return nullptr;
+  }
+  return env->NewObject(gJni.movementClass, gJni.movementCtor, static_cast<jint>(movement.id), status.get(),
+                        subsystemName.get(), subsystemKind.get(), metadataJson.get(),
+                        static_cast<jlong>(movement.intended_balance_sat),
+                        static_cast<jlong>(movement.effective_balance_sat),
+                        static_cast<jlong>(movement.offchain_fee_sat), sentTo.get(), receivedOn.get(),
+                        inputVtxos.get(), outputVtxos.get(), exitedVtxos.get(), createdAt.get(), updatedAt.get(),
+                        completedAt.get());
+}
+
 } // namespace
 
+namespace nitroark::jni {
+
+bool InitializeJniCache(JNIEnv* env) {
+  struct ClassEntry {
+    jclass* cls;
+    const char* name;
+  };
+  struct MethodEntry {
+    jmethodID* mid;
+    jclass* cls;
+    const char* name;
+    const char* sig;
+  };
+
+  JniCache cache;
+  const ClassEntry classes[] = {
+      {&cache.runtimeExceptionClass, "java/lang/RuntimeException"},
+      {&cache.integerClass, "java/lang/Integer"},
+      {&cache.longClass, "java/lang/Long"},
+      {&cache.listClass, "java/util/List"},
+      {&cache.arrayListClass, "java/util/ArrayList"},
+      {&cache.keyPairResultClass, "com/margelo/nitro/nitroark/KeyPairResultAndroid"},
+      {&cache.bolt11InvoiceClass, "com/margelo/nitro/nitroark/Bolt11InvoiceResult"},
+      {&cache.offchainBalanceClass, "com/margelo/nitro/nitroark/OffchainBalanceResult"},
+      {&cache.onchainBalanceClass, "com/margelo/nitro/nitroark/OnchainBalanceResult"},
+      {&cache.vtxoClass, "com/margelo/nitro/nitroark/BarkVtxoResult"},
+      {&cache.movementDestinationClass, "com/margelo/nitro/nitroark/MovementDestinationResult"},
+      {&cache.movementClass, "com/margelo/nitro/nitroark/BarkMovementResult"},
+  };
+  const MethodEntry methods[] = {
+      {&cache.integerIntValue, &cache.integerClass, "intValue", "()I"},
+      {&cache.longLongValue, &cache.longClass, "longValue", "()J"},
+      {&cache.listSize, &cache.listClass, "size", "()I"},
+      {&cache.listGet, &cache.listClass, "get", "(I)Ljava/lang/Object;"},
+      {&cache.arrayListCtor, &cache.arrayListClass, "<init>", "(I)V"},
+      {&cache.arrayListAdd, &cache.arrayListClass, "add", "(Ljava/lang/Object;)Z"},
+      {&cache.keyPairResultCtor, &cache.keyPairResultClass, "<init>", "(Ljava/lang/String;Ljava/lang/String;)V"},
+      {&cache.bolt11InvoiceCtor, &cache.bolt11InvoiceClass, "<init>",
+       "(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;)V"},
+      {&cache.offchainBalanceCtor, &cache.offchainBalanceClass, "<init>", "(JJJJJ)V"},
+      {&cache.onchainBalanceCtor, &cache.onchainBalanceClass, "<init>", "(JJJJ)V"},
+      {&cache.vtxoCtor, &cache.vtxoClass, "<init>",
+       "(JILjava/lang/String;ILjava/lang/String;Ljava/lang/String;Ljava/lang/String;)V"},
+      {&cache.movementDestinationCtor, &cache.movementDestinationClass, "<init>",
+       "(Ljava/lang/String;Ljava/lang/String;J)V"},
+      {&cache.movementCtor, &cache.movementClass, "<init>",
+       "(ILjava/lang/String;Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;JJJLjava/util/List;"
+       "Ljava/util/List;Ljava/util/List;Ljava/util/List;Ljava/util/List;Ljava/lang/String;Ljava/lang/String;"
+       "Ljava/lang/String;)V"},
+  };
+
+  for (const auto& entry : classes) {
+    *entry.cls = FindGlobalClass(env, entry.name);
+    if (*entry.cls == nullptr) {
+      return false;
+    }
+  }
+  for (const auto& entry : methods) {
+    *entry.mid = FindMethod(env, *entry.cls, entry.name, entry.sig);
+    if (*entry.mid == nullptr) {
+      return false;
+    }
+  }
+
+  gJni = cache;
+  __android_log_print(ANDROID_LOG_INFO, LOG_TAG, "JNI cache initialized");
+  return true;
+}
+
+} // namespace nitroark::jni
+
 extern "C" {
 
+JNIEXPORT void JNICALL Java_com_margelo_nitro_nitroark_NitroArkNative_configureRuntime(
+    JNIEnv* env, jobject /*thiz*/, jint jWorkerThreads, jboolean jCurrentThread, jlong jThreadStackSize,
+    jint jMaxBlockingThreads, jlong jBlockingKeepAliveMs) {
+  try {
+    bark_cxx::RuntimeOpts opts{};
+    opts.worker_threads = static_cast<uint32_t>(std::max<jint>(jWorkerThreads, 0));
+    opts.current_thread = jCurrentThread == JNI_TRUE;
+    opts.thread_stack_size = static_cast<uint64_t>(std::max<jlong>(jThreadStackSize, 0));
+    opts.max_blocking_threads = static_cast<uint32_t>(std::max<jint>(jMaxBlockingThreads, 0));
+    opts.blocking_keep_alive_ms = static_cast<uint64_t>(std::max<jlong>(jBlockingKeepAliveMs, 0));
+    bark_cxx::configure_runtime(opts);
+  } catch (const std::exception& e) {
+    HandleException(env, e);
+  } catch (...) {
+    HandleUnknownException(env);
+  }
+}
+
 JNIEXPORT jboolean JNICALL Java_com_margelo_nitro_nitroark_NitroArkNative_isWalletLoaded(JNIEnv* env,
                                                                                          jobject /*thiz*/) {
   try {
@@ -396,4 +596,153 @@ JNIEXPORT void JNICALL Java_com_margelo_nitro_nitroark_NitroArkNative_sync(JNIEn
   }
 }
 
+JNIEXPORT void JNICALL Java_com_margelo_nitro_nitroark_NitroArkNative_maintenance(JNIEnv* env, jobject /*thiz*/) {
+  try {
+    bark_cxx::maintenance();
+  } catch (const std::exception& e) {
+    HandleException(env, e);
+  } catch (...) {
+    HandleUnknownException(env);
+  }
+}
+
+JNIEXPORT void JNICALL Java_com_margelo_nitro_nitroark_NitroArkNative_maintenanceWithOnchain(JNIEnv* env,
+                                                                                             jobject /*thiz*/) {
+  try {
+    bark_cxx::maintenance_with_onchain(bark_cxx::CallLimits{});
+  } catch (const std::exception& e) {
+    HandleException(env, e);
+  } catch (...) {
+    HandleUnknownException(env);
+  }
+}
+
+JNIEXPORT void JNICALL Java_com_margelo_nitro_nitroark_NitroArkNative_maintenanceRefresh(JNIEnv* env,
+                                                                                         jobject /*thiz*/) {
+  try {
+    bark_cxx::maintenance_refresh();
+  } catch (const std::exception& e) {
+    HandleException(env, e);
+  } catch (...) {
+    HandleUnknownException(env);
+  }
+}
+
+JNIEXPORT void JNICALL Java_com_margelo_nitro_nitroark_NitroArkNative_onchainSync(JNIEnv* env, jobject /*thiz*/) {
+  try {
+    bark_cxx::onchain_sync();
+  } catch (const std::exception& e) {
+    HandleException(env, e);
+  } catch (...) {
+    HandleUnknownException(env);
+  }
+}
+
+JNIEXPORT void JNICALL Java_com_margelo_nitro_nitroark_NitroArkNative_tryClaimAllLightningReceives(
+    JNIEnv* env, jobject /*thiz*/, jboolean jWait) {
+  try {
+    bark_cxx::try_claim_all_lightning_receives(jWait == JNI_TRUE);
+  } catch (const std::exception& e) {
+    HandleException(env, e);
+  } catch (...) {
+    HandleUnknownException(env);
+  }
+}
+
+JNIEXPORT jobject JNICALL Java_com_margelo_nitro_nitroark_NitroArkNative_offchainBalance(
+    JNIEnv* env, jobject /*thiz*/) {
+  try {
+    return MakeOffchainBalance(env, bark_cxx::offchain_balance());
+  } catch (const std::exception& e) {
+    HandleException(env, e);
+    return nullptr;
+  } catch (...) {
+    HandleUnknownException(env);
+    return nullptr;
+  }
+}
+
+JNIEXPORT jobject JNICALL Java_com_margelo_nitro_nitroark_NitroArkNative_onchainBalance(JNIEnv* env, jobject /*thiz*/) {
+  try {
+    return MakeOnchainBalance(env, bark_cxx::onchain_balance());
+  } catch (const std::exception& e) {
+    HandleException(env, e);
+    return nullptr;
+  } catch (...) {
+    HandleUnknownException(env);
+    return nullptr;
+  }
+}
+
+JNIEXPORT jobject JNICALL Java_com_margelo_nitro_nitroark_NitroArkNative_vtxos(JNIEnv* env, jobject /*thiz*/) {
+  try {
+    rust::Vec<bark_cxx::BarkVtxo> vtxos = bark_cxx::vtxos();
+    return MakeVtxoList(env, vtxos);
+  } catch (const std::exception& e) {
+    HandleException(env, e);
+    return nullptr;
+  } catch (...) {
+    HandleUnknownException(env);
+    return nullptr;
+  }
+}
+
+JNIEXPORT jobject JNICALL Java_com_margelo_nitro_nitroark_NitroArkNative_getExpiringVtxos(
+    JNIEnv* env, jobject /*thiz*/, jint jThreshold) {
+  try {
+    rust::Vec<bark_cxx::BarkVtxo> vtxos = bark_cxx::get_expiring_vtxos(static_cast<uint32_t>(jThreshold));
+    return MakeVtxoList(env, vtxos);
+  } catch (const std::exception& e) {
+    HandleException(env, e);
+    return nullptr;
+  } catch (...) {
+    HandleUnknownException(env);
+    return nullptr;
+  }
+}
+
+JNIEXPORT jobject JNICALL Java_com_margelo_nitro_nitroark_NitroArkNative_history(JNIEnv* env, jobject /*thiz*/) {
+  try {
+    rust::Vec<bark_cxx::BarkMovement> movements = bark_cxx::history();
+    return MakeList(env, movements, MakeMovement);
+  } catch (const std::exception& e) {
+    HandleException(env, e);
+    return nullptr;
+  } catch (...) {
+    HandleUnknownException(env);
+    return nullptr;
+  }
+}
+
+JNIEXPORT jstring JNICALL Java_com_margelo_nitro_nitroark_NitroArkNative_offboardAll(
+    JNIEnv* env, jobject /*thiz*/, jstring jDestinationAddress) {
+  try {
+    const std::string destination = JStringToString(env, jDestinationAddress);
+    rust::String txid = bark_cxx::offboard_all(destination, bark_cxx::CallLimits{});
+    return NewJString(env, txid);
+  } catch (const std::exception& e) {
+    HandleException(env, e);
+    return nullptr;
+  } catch (...) {
+    HandleUnknownException(env);
+    return nullptr;
+  }
+}
+
+JNIEXPORT jstring JNICALL Java_com_margelo_nitro_nitroark_NitroArkNative_offboardSpecific(
+    JNIEnv* env, jobject /*thiz*/, jobject jVtxoIds, jstring jDestinationAddress) {
+  try {
+    rust::Vec<rust::String> vtxo_ids = ToRustStringVec(env, jVtxoIds);
+    const std::string destination = JStringToString(env, jDestinationAddress);
+    rust::String txid = bark_cxx::offboard_specific(std::move(vtxo_ids), destination);
+    return NewJString(env, txid);
+  } catch (const std::exception& e) {
+    HandleException(env, e);
+    return nullptr;
+  } catch (...) {
+    HandleUnknownException(env);
+    return nullptr;
+  }
+}
+
 } // extern "C"
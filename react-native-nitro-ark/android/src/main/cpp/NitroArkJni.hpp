@@ -0,0 +1,12 @@
+#pragma once
+
+#include <jni.h>
+
+namespace nitroark::jni {
+
+// Resolves and caches the Java classes and method IDs used by the JNI facade.
+// Must be called once from JNI_OnLoad; returns false with a pending Java
+// exception if a class or method could not be found.
+bool InitializeJniCache(JNIEnv* env);
+
+} // namespace nitroark::jni
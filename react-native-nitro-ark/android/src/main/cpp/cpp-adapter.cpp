@@ -1,6 +1,14 @@
 #include <jni.h>
+#include "NitroArkJni.hpp"
 #include "NitroArkOnLoad.hpp"
 
 JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM* vm, void*) {
+  JNIEnv* env = nullptr;
+  if (vm->GetEnv(reinterpret_cast<void**>(&env), JNI_VERSION_1_6) != JNI_OK) {
+    return JNI_ERR;
+  }
+  if (!nitroark::jni::InitializeJniCache(env)) {
+    return JNI_ERR;
+  }
   return margelo::nitro::nitroark::initialize(vm);
 }
@@ -1,5 +1,7 @@
 package com.margelo.nitro.nitroark
 
+// Built from native code only, consumer-rules.pro keeps these for R8
+
 data class Bolt11InvoiceResult(
     val bolt11Invoice: String,
     val paymentSecret: String,
@@ -11,11 +13,52 @@ data class KeyPairResultAndroid(
     val secretKey: String,
 )
 
-data class RoundStatusResult(
+data class OffchainBalanceResult(
+    val spendable: Long,
+    val pendingLightningSend: Long,
+    val pendingInRound: Long,
+    val pendingExit: Long,
+    val pendingBoard: Long,
+)
+
+data class OnchainBalanceResult(
+    val immature: Long,
+    val trustedPending: Long,
+    val untrustedPending: Long,
+    val confirmed: Long,
+)
+
+data class BarkVtxoResult(
+    val amount: Long,
+    val expiryHeight: Int,
+    val serverPubkey: String,
+    val exitDelta: Int,
+    val anchorPoint: String,
+    val point: String,
+    val state: String,
+)
+
+data class MovementDestinationResult(
+    val destination: String,
+    val paymentMethod: String,
+    val amountSat: Long,
+)
+
+data class BarkMovementResult(
+    val id: Int,
     val status: String,
-    val fundingTxid: String?,
-    val unsignedFundingTxids: List<String>,
-    val error: String?,
-    val isFinal: Boolean,
-    val isSuccess: Boolean,
+    val subsystemName: String,
+    val subsystemKind: String,
+    val metadataJson: String,
+    val intendedBalanceSat: Long,
+    val effectiveBalanceSat: Long,
+    val offchainFeeSat: Long,
+    val sentTo: List<MovementDestinationResult>,
+    val receivedOn: List<MovementDestinationResult>,
+    val inputVtxos: List<String>,
+    val outputVtxos: List<String>,
+    val exitedVtxos: List<String>,
+    val createdAt: String,
+    val updatedAt: String,
+    val completedAt: String?,
 )
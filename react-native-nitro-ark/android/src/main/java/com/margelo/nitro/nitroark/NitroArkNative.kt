@@ -59,6 +59,18 @@ object NitroArkNative {
         config?.roundTxRequiredConfirmations)
   }
 
+  /**
+   * Size the native runtime before the first wallet call. Headless workers can use a single
+   * runtime thread instead of one worker per core. Zero keeps the default.
+   */
+  external fun configureRuntime(
+      workerThreads: Int = 0,
+      currentThread: Boolean = false,
+      threadStackSize: Long = 0,
+      maxBlockingThreads: Int = 0,
+      blockingKeepAliveMs: Long = 0
+  )
+
   external fun isWalletLoaded(): Boolean
   external fun closeWallet()
 
@@ -83,18 +95,39 @@ object NitroArkNative {
       roundTxRequiredConfirmations: Int?,
   )
 
-  // Additional helpers
+  // Maintenance and sync
   external fun maintenance()
+  external fun maintenanceDelegated()
+  external fun maintenanceWithOnchain()
+  external fun maintenanceWithOnchainDelegated()
   external fun maintenanceRefresh()
+  external fun sync()
+  external fun onchainSync()
+
+  // Balances and wallet state
+  external fun offchainBalance(): OffchainBalanceResult
+  external fun onchainBalance(): OnchainBalanceResult
+  external fun vtxos(): List<BarkVtxoResult>
+  external fun getExpiringVtxos(threshold: Int): List<BarkVtxoResult>
+  external fun history(): List<BarkMovementResult>
+
+  // Lightning
   external fun tryClaimLightningReceive(
       paymentHash: String,
       wait: Boolean,
       token: String?
   )
-  external fun offboardAll(destinationAddress: String): RoundStatusResult
+  external fun tryClaimAllLightningReceives(wait: Boolean)
+  external fun bolt11Invoice(amountMsat: Long): Bolt11InvoiceResult
+
+  /**
+   * Offboard funds to an onchain address. Returns the offboard transaction id.
+   */
+  external fun offboardAll(destinationAddress: String): String
+  external fun offboardSpecific(vtxoIds: List<String>, destinationAddress: String): String
+
+  // Keys and signing
   external fun peakKeyPair(index: Int): KeyPairResultAndroid
   external fun verifyMessage(message: String, signature: String, publicKey: String): Boolean
-  external fun bolt11Invoice(amountMsat: Long): Bolt11InvoiceResult
   external fun signMessage(message: String, index: Int): String
-  external fun sync()
 }
@@ -3,10 +3,16 @@
 #include "HybridNitroArkSpec.hpp"
 #include "generated/ark_cxx.h"
 #include "generated/cxx.h"
+#include <atomic>
+#include <chrono>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <sys/wait.h>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 namespace margelo::nitro::nitroark {
@@ -32,6 +38,241 @@ inline std::vector<BarkVtxo> convertRustVtxosToVector(const rust::Vec<bark_cxx::
   return vtxos;
 }
 
+inline OffchainBalanceResult convertRustOffchainBalance(const bark_cxx::OffchainBalance& rust_balance) {
+  OffchainBalanceResult balance;
+  balance.spendable = static_cast<double>(rust_balance.spendable);
+  balance.pending_lightning_send = static_cast<double>(rust_balance.pending_lightning_send);
+  balance.pending_in_round = static_cast<double>(rust_balance.pending_in_round);
+  balance.pending_exit = static_cast<double>(rust_balance.pending_exit);
+  balance.pending_board = static_cast<double>(rust_balance.pending_board);
+  return balance;
+}
+
+inline OnchainBalanceResult convertRustOnchainBalance(const bark_cxx::OnChainBalance& rust_balance) {
+  OnchainBalanceResult balance;
+  balance.immature = static_cast<double>(rust_balance.immature);
+  balance.trusted_pending = static_cast<double>(rust_balance.trusted_pending);
+  balance.untrusted_pending = static_cast<double>(rust_balance.untrusted_pending);
+  balance.confirmed = static_cast<double>(rust_balance.confirmed);
+  return balance;
+}
+
+inline std::vector<BarkOnchainUtxo> convertRustOnchainUtxos(const rust::Vec<bark_cxx::OnchainUtxo>& rust_utxos) {
+  std::vector<BarkOnchainUtxo> utxos;
+  utxos.reserve(rust_utxos.size());
+
+  for (const auto& utxo_rs : rust_utxos) {
+    BarkOnchainUtxo utxo;
+    utxo.outpoint = std::string(utxo_rs.outpoint.data(), utxo_rs.outpoint.length());
+    utxo.amount_sat = static_cast<double>(utxo_rs.amount_sat);
+    utxo.confirmation_height = static_cast<double>(utxo_rs.confirmation_height);
+    utxo.kind = std::string(utxo_rs.kind.data(), utxo_rs.kind.length());
+    utxos.push_back(std::move(utxo));
+  }
+
+  return utxos;
+}
+
+inline BarkArkInfo convertRustArkInfo(const bark_cxx::CxxArkInfo& rust_info) {
+  BarkArkInfo info;
+  info.network = std::string(rust_info.network.data(), rust_info.network.length());
+  info.server_pubkey = std::string(rust_info.server_pubkey.data(), rust_info.server_pubkey.length());
+  info.round_interval = static_cast<double>(rust_info.round_interval);
+  info.nb_round_nonces = static_cast<double>(rust_info.nb_round_nonces);
+  info.vtxo_exit_delta = static_cast<double>(rust_info.vtxo_exit_delta);
+  info.vtxo_expiry_delta = static_cast<double>(rust_info.vtxo_expiry_delta);
+  info.htlc_send_expiry_delta = static_cast<double>(rust_info.htlc_send_expiry_delta);
+  info.max_vtxo_amount = static_cast<double>(rust_info.max_vtxo_amount);
+  info.required_board_confirmations = static_cast<double>(rust_info.required_board_confirmations);
+  return info;
+}
+
+inline LightningReceive convertRustLightningReceive(const bark_cxx::LightningReceive& receive_rs) {
+  LightningReceive receive;
+  receive.payment_hash = std::string(receive_rs.payment_hash.data(), receive_rs.payment_hash.length());
+  receive.payment_preimage = std::string(receive_rs.payment_preimage.data(), receive_rs.payment_preimage.length());
+  receive.invoice = std::string(receive_rs.invoice.data(), receive_rs.invoice.length());
+
+  if (receive_rs.preimage_revealed_at != nullptr) {
+    receive.preimage_revealed_at = static_cast<double>(*receive_rs.preimage_revealed_at);
+  } else {
+    receive.preimage_revealed_at = std::nullopt;
+  }
+
+  if (receive_rs.finished_at != nullptr) {
+    receive.finished_at = static_cast<double>(*receive_rs.finished_at);
+  } else {
+    receive.finished_at = std::nullopt;
+  }
+
+  return receive;
+}
+
+inline BarkMovement convertRustMovement(const bark_cxx::BarkMovement& movement_rs) {
+  BarkMovement movement;
+  movement.id = static_cast<double>(movement_rs.id);
+  movement.status = std::string(movement_rs.status.data(), movement_rs.status.length());
+  movement.metadata_json = std::string(movement_rs.metadata_json.data(), movement_rs.metadata_json.length());
+  movement.intended_balance_sat = static_cast<double>(movement_rs.intended_balance_sat);
+  movement.effective_balance_sat = static_cast<double>(movement_rs.effective_balance_sat);
+  movement.offchain_fee_sat = static_cast<double>(movement_rs.offchain_fee_sat);
+  movement.created_at = std::string(movement_rs.created_at.data(), movement_rs.created_at.length());
+  movement.updated_at = std::string(movement_rs.updated_at.data(), movement_rs.updated_at.length());
+  if (movement_rs.completed_at.length() == 0) {
+    movement.completed_at = std::nullopt;
+  } else {
+    movement.completed_at = std::string(movement_rs.completed_at.data(), movement_rs.completed_at.length());
+  }
+
+  movement.subsystem.name = std::string(movement_rs.subsystem_name.data(), movement_rs.subsystem_name.length());
+  movement.subsystem.kind = std::string(movement_rs.subsystem_kind.data(), movement_rs.subsystem_kind.length());
+
+  movement.sent_to.reserve(movement_rs.sent_to.size());
+  for (const auto& dest_rs : movement_rs.sent_to) {
+    BarkMovementDestination destination;
+    destination.destination = std::string(dest_rs.destination.data(), dest_rs.destination.length());
+    destination.payment_method = std::string(dest_rs.payment_method.data(), dest_rs.payment_method.length());
+    destination.amount_sat = static_cast<double>(dest_rs.amount_sat);
+    movement.sent_to.push_back(std::move(destination));
+  }
+
+  movement.received_on.reserve(movement_rs.received_on.size());
+  for (const auto& dest_rs : movement_rs.received_on) {
+    BarkMovementDestination destination;
+    destination.destination = std::string(dest_rs.destination.data(), dest_rs.destination.length());
+    destination.payment_method = std::string(dest_rs.payment_method.data(), dest_rs.payment_method.length());
+    destination.amount_sat = static_cast<double>(dest_rs.amount_sat);
+    movement.received_on.push_back(std::move(destination));
+  }
+
+  movement.input_vtxos.reserve(movement_rs.input_vtxos.size());
+  for (const auto& vtxo_id : movement_rs.input_vtxos) {
+    movement.input_vtxos.emplace_back(std::string(vtxo_id.data(), vtxo_id.length()));
+  }
+
+  movement.output_vtxos.reserve(movement_rs.output_vtxos.size());
+  for (const auto& vtxo_id : movement_rs.output_vtxos) {
+    movement.output_vtxos.emplace_back(std::string(vtxo_id.data(), vtxo_id.length()));
+  }
+
+  movement.exited_vtxos.reserve(movement_rs.exited_vtxos.size());
+  for (const auto& vtxo_id : movement_rs.exited_vtxos) {
+    movement.exited_vtxos.emplace_back(std::string(vtxo_id.data(), vtxo_id.length()));
+  }
+
+  return movement;
+}
+
+inline std::vector<std::string> convertRustStrings(const rust::Vec<rust::String>& rust_strings) {
+  std::vector<std::string> strings;
+  strings.reserve(rust_strings.size());
+  for (const auto& str : rust_strings) {
+    strings.emplace_back(str.data(), str.length());
+  }
+  return strings;
+}
+
+inline std::vector<KeyPairResult> convertRustKeyPairs(const rust::Vec<bark_cxx::KeyPairResult>& keypairs_rs) {
+  std::vector<KeyPairResult> keypairs;
+  keypairs.reserve(keypairs_rs.size());
+  for (const auto& keypair_rs : keypairs_rs) {
+    KeyPairResult keypair;
+    keypair.public_key = std::string(keypair_rs.public_key.data(), keypair_rs.public_key.length());
+    keypair.secret_key = std::string(keypair_rs.secret_key.data(), keypair_rs.secret_key.length());
+    keypairs.push_back(std::move(keypair));
+  }
+  return keypairs;
+}
+
+inline std::vector<NewAddressResult> convertRustAddresses(const rust::Vec<bark_cxx::NewAddressResult>& addresses_rs) {
+  std::vector<NewAddressResult> addresses;
+  addresses.reserve(addresses_rs.size());
+  for (const auto& address_rs : addresses_rs) {
+    NewAddressResult address;
+    address.user_pubkey = std::string(address_rs.user_pubkey.data(), address_rs.user_pubkey.length());
+    address.ark_id = std::string(address_rs.ark_id.data(), address_rs.ark_id.length());
+    address.address = std::string(address_rs.address.data(), address_rs.address.length());
+    addresses.push_back(std::move(address));
+  }
+  return addresses;
+}
+
+inline LightningSendResult convertRustLightningSend(const bark_cxx::LightningSend& send_rs) {
+  LightningSendResult result;
+  result.invoice = std::string(send_rs.invoice.data(), send_rs.invoice.length());
+  result.payment_hash = std::string(send_rs.payment_hash.data(), send_rs.payment_hash.length());
+  result.amount = static_cast<double>(send_rs.amount);
+  result.htlc_vtxos = convertRustVtxosToVector(send_rs.htlc_vtxos);
+  result.movement_id = static_cast<double>(send_rs.movement_id);
+  std::string preimage_str(send_rs.preimage.data(), send_rs.preimage.length());
+  result.preimage = preimage_str.empty()
+                        ? std::nullopt
+                        : std::make_optional(std::variant<nitro::NullType, std::string>(preimage_str));
+  return result;
+}
+
+inline BarkLatencyHistogram convertRustLatencyHistogram(const bark_cxx::LatencyHistogram& histogram_rs) {
+  BarkLatencyHistogram histogram;
+  histogram.count = static_cast<double>(histogram_rs.count);
+  histogram.sum_us = static_cast<double>(histogram_rs.sum_us);
+  histogram.max_us = static_cast<double>(histogram_rs.max_us);
+  histogram.buckets.reserve(histogram_rs.buckets.size());
+  for (auto count : histogram_rs.buckets) {
+    histogram.buckets.push_back(static_cast<double>(count));
+  }
+  return histogram;
+}
+
+inline bark_cxx::HistoryQuery convertHistoryQuery(const BarkHistoryQuery& query) {
+  bark_cxx::HistoryQuery query_rs;
+  query_rs.cursor = static_cast<uint32_t>(query.cursor.value_or(0));
+  query_rs.limit = static_cast<uint32_t>(query.limit.value_or(0));
+  query_rs.status = query.status.value_or("");
+  query_rs.subsystem_kind = query.subsystem_kind.value_or("");
+  query_rs.created_after = static_cast<uint64_t>(query.created_after.value_or(0));
+  query_rs.created_before = static_cast<uint64_t>(query.created_before.value_or(0));
+  query_rs.include_metadata = query.include_metadata.value_or(false);
+  return query_rs;
+}
+
+inline bark_cxx::CallLimits convertCallOpts(const std::optional<BarkCallOpts>& opts) {
+  bark_cxx::CallLimits limits;
+  if (opts.has_value()) {
+    limits.cancel_token = static_cast<uint64_t>(opts->cancel_token.value_or(0));
+    limits.timeout_ms = static_cast<uint64_t>(opts->timeout_ms.value_or(0));
+  }
+  return limits;
+}
+
+inline BarkHistoryExportProgress convertRustHistoryExportProgress(const bark_cxx::HistoryExportProgress& progress_rs) {
+  BarkHistoryExportProgress progress;
+  progress.written = static_cast<double>(progress_rs.written);
+  progress.done = progress_rs.done;
+  return progress;
+}
+
+// Like Promise<T>::async, but while metrics are enabled reports how long the
+// call was queued and its total native time, so the Rust side can attribute
+// queue wait and conversion time to the bridge function the call ran.
+template <typename T, typename F> std::shared_ptr<Promise<T>> bridgeAsync(F&& run) {
+  if (!bark_cxx::metrics_enabled()) {
+    return Promise<T>::async(std::forward<F>(run));
+  }
+  auto queued = std::chrono::steady_clock::now();
+  return Promise<T>::async([queued, run = std::forward<F>(run)]() mutable {
+    bark_cxx::begin_bridge_call();
+    struct Report {
+      std::chrono::steady_clock::time_point queued;
+      std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+      ~Report() {
+        auto us = [](auto d) { return std::chrono::duration_cast<std::chrono::microseconds>(d).count(); };
+        bark_cxx::record_bridge_timing(us(started - queued), us(std::chrono::steady_clock::now() - started));
+      }
+    } report{queued};
+    return run();
+  });
+}
+
 class NitroArk : public HybridNitroArkSpec {
 
 private:
@@ -51,20 +292,86 @@ private:
       config_opts.htlc_recv_claim_delta = static_cast<uint32_t>(config->htlc_recv_claim_delta);
       config_opts.vtxo_exit_margin = static_cast<uint32_t>(config->vtxo_exit_margin);
       config_opts.round_tx_required_confirmations = static_cast<uint32_t>(config->round_tx_required_confirmations);
+      if (config->storage.has_value()) {
+        const BarkStorageOpts& storage = config->storage.value();
+        config_opts.storage.journal_mode = storage.journal_mode.value_or("");
+        config_opts.storage.synchronous = storage.synchronous.value_or("");
+        config_opts.storage.mmap_size = static_cast<uint64_t>(storage.mmap_size.value_or(0));
+        config_opts.storage.cache_size_kib = static_cast<uint32_t>(storage.cache_size_kib.value_or(0));
+        config_opts.storage.page_size = static_cast<uint32_t>(storage.page_size.value_or(0));
+      }
     }
     return config_opts;
   }
 
+  static bark_cxx::OnchainUtxoFilter createOnchainUtxoFilter(const std::optional<BarkOnchainUtxoFilter>& filter) {
+    bark_cxx::OnchainUtxoFilter filter_rs;
+    if (filter.has_value()) {
+      filter_rs.min_amount_sat = static_cast<uint64_t>(filter->min_amount_sat.value_or(0));
+      filter_rs.confirmed_only = filter->confirmed_only.value_or(false);
+    }
+    return filter_rs;
+  }
+
 public:
   NitroArk() : HybridObject(TAG) {
     // Initialize the Rust logger once when a NitroArk object is created.
     bark_cxx::init_logger();
   }
 
+  ~NitroArk() override {
+    unsubscribeWalletEvents();
+    stopLightningWaits();
+  }
+
   // --- Management ---
 
+  void configureRuntime(const BarkRuntimeOpts& opts) override {
+    bark_cxx::RuntimeOpts opts_rs;
+    opts_rs.worker_threads = static_cast<uint32_t>(opts.worker_threads.value_or(0));
+    opts_rs.current_thread = opts.current_thread.value_or(false);
+    opts_rs.thread_stack_size = static_cast<uint64_t>(opts.thread_stack_size.value_or(0));
+    opts_rs.max_blocking_threads = static_cast<uint32_t>(opts.max_blocking_threads.value_or(0));
+    opts_rs.blocking_keep_alive_ms = static_cast<uint64_t>(opts.blocking_keep_alive_ms.value_or(0));
+    try {
+      bark_cxx::configure_runtime(opts_rs);
+    } catch (const rust::Error& e) {
+      throw std::runtime_error(e.what());
+    }
+  }
+
+  void configureLogging(const BarkLogOpts& opts) override {
+    bark_cxx::LogOpts opts_rs;
+    opts_rs.filter = opts.filter.value_or("");
+    opts_rs.ring_buffer_lines = static_cast<uint32_t>(opts.ring_buffer_lines.value_or(0));
+    opts_rs.ring_buffer_level = opts.ring_buffer_level.value_or("");
+    try {
+      bark_cxx::configure_logging(opts_rs);
+    } catch (const rust::Error& e) {
+      throw std::runtime_error(e.what());
+    }
+  }
+
+  void setLogFilter(const std::string& filter) override {
+    try {
+      bark_cxx::set_log_filter(filter);
+    } catch (const rust::Error& e) {
+      throw std::runtime_error(e.what());
+    }
+  }
+
+  std::vector<std::string> dumpLogs() override { return convertRustStrings(bark_cxx::dump_logs()); }
+
+  void clearLogs() override { bark_cxx::clear_logs(); }
+
+  double createCancelToken() override { return static_cast<double>(bark_cxx::create_cancel_token()); }
+
+  bool cancelCall(double token) override { return bark_cxx::cancel_call(static_cast<uint64_t>(token)); }
+
+  void releaseCancelToken(double token) override { bark_cxx::release_cancel_token(static_cast<uint64_t>(token)); }
+
   std::shared_ptr<Promise<std::string>> createMnemonic() override {
-    return Promise<std::string>::async([]() {
+    return bridgeAsync<std::string>([]() {
       try {
         rust::String mnemonic_rs = bark_cxx::create_mnemonic();
         return std::string(mnemonic_rs.data(), mnemonic_rs.length());
@@ -75,7 +382,7 @@ public:
   }
 
   std::shared_ptr<Promise<void>> createWallet(const std::string& datadir, const BarkCreateOpts& opts) override {
-    return Promise<void>::async([datadir, opts]() {
+    return bridgeAsync<void>([datadir, opts]() {
       try {
         bark_cxx::CreateOpts create_opts;
         create_opts.regtest = opts.regtest.value_or(false);
@@ -101,7 +408,7 @@ public:
   }
 
   std::shared_ptr<Promise<void>> loadWallet(const std::string& datadir, const BarkCreateOpts& opts) override {
-    return Promise<void>::async([datadir, opts]() {
+    return bridgeAsync<void>([datadir, opts]() {
       try {
         bark_cxx::CreateOpts create_opts;
         create_opts.regtest = opts.regtest.value_or(false);
@@ -127,7 +434,7 @@ public:
   }
 
   std::shared_ptr<Promise<void>> closeWallet() override {
-    return Promise<void>::async([]() {
+    return bridgeAsync<void>([]() {
       try {
         bark_cxx::close_wallet();
       } catch (const rust::Error& e) {
@@ -136,8 +443,32 @@ public:
     });
   }
 
+  std::shared_ptr<Promise<void>> closeWalletAt(const std::string& datadir) override {
+    return bridgeAsync<void>([datadir]() {
+      try {
+        bark_cxx::close_wallet_at(datadir);
+      } catch (const rust::Error& e) {
+        throw std::runtime_error(e.what());
+      }
+    });
+  }
+
+  std::shared_ptr<Promise<void>> selectWallet(const std::string& datadir) override {
+    return bridgeAsync<void>([datadir]() {
+      try {
+        bark_cxx::select_wallet(datadir);
+      } catch (const rust::Error& e) {
+        throw std::runtime_error(e.what());
+      }
+    });
+  }
+
+  std::shared_ptr<Promise<std::vector<std::string>>> openWallets() override {
+    return bridgeAsync<std::vector<std::string>>([]() { return convertRustStrings(bark_cxx::open_wallets()); });
+  }
+
   std::shared_ptr<Promise<void>> refreshServer() override {
-    return Promise<void>::async([]() {
+    return bridgeAsync<void>([]() {
       try {
         bark_cxx::refresh_server();
       } catch (const rust::Error& e) {
@@ -147,11 +478,90 @@ public:
   }
 
   std::shared_ptr<Promise<bool>> isWalletLoaded() override {
-    return Promise<bool>::async([]() { return bark_cxx::is_wallet_loaded(); });
+    return bridgeAsync<bool>([]() { return bark_cxx::is_wallet_loaded(); });
+  }
+
+  BarkWalletOpenTimings getWalletOpenTimings() override {
+    bark_cxx::WalletOpenTimings timings_rs = bark_cxx::wallet_open_timings();
+    BarkWalletOpenTimings timings;
+    timings.recorded = timings_rs.recorded;
+    timings.db_open_ms = static_cast<double>(timings_rs.db_open_ms);
+    timings.read_properties_ms = static_cast<double>(timings_rs.read_properties_ms);
+    timings.seed_ms = static_cast<double>(timings_rs.seed_ms);
+    timings.seed_cached = timings_rs.seed_cached;
+    timings.onchain_load_ms = static_cast<double>(timings_rs.onchain_load_ms);
+    timings.wallet_open_ms = static_cast<double>(timings_rs.wallet_open_ms);
+    timings.total_ms = static_cast<double>(timings_rs.total_ms);
+    return timings;
+  }
+
+  void forgetCachedSeed() override {
+    bark_cxx::forget_cached_seed();
+  }
+
+  void setMetricsEnabled(bool enabled) override {
+    bark_cxx::set_metrics_enabled(enabled);
+  }
+
+  std::vector<BarkCallMetrics> getMetrics() override {
+    rust::Vec<bark_cxx::CallMetrics> metrics_rs = bark_cxx::call_metrics();
+    std::vector<BarkCallMetrics> metrics;
+    metrics.reserve(metrics_rs.size());
+    for (const auto& call_rs : metrics_rs) {
+      BarkCallMetrics call;
+      call.name = std::string(call_rs.name.data(), call_rs.name.length());
+      call.queue_wait = convertRustLatencyHistogram(call_rs.queue_wait);
+      call.lock_wait = convertRustLatencyHistogram(call_rs.lock_wait);
+      call.execution = convertRustLatencyHistogram(call_rs.execution);
+      call.conversion = convertRustLatencyHistogram(call_rs.conversion);
+      metrics.push_back(std::move(call));
+    }
+    return metrics;
+  }
+
+  void resetMetrics() override {
+    bark_cxx::reset_metrics();
+  }
+
+  BarkAllocStats getAllocStats() override {
+    bark_cxx::AllocStats stats_rs = bark_cxx::alloc_stats();
+    BarkAllocStats stats;
+    stats.enabled = stats_rs.enabled;
+    stats.subsystems.reserve(stats_rs.subsystems.size());
+    for (const auto& subsystem_rs : stats_rs.subsystems) {
+      BarkSubsystemAllocStats subsystem;
+      subsystem.name = std::string(subsystem_rs.name.data(), subsystem_rs.name.length());
+      subsystem.current_bytes = static_cast<double>(subsystem_rs.current_bytes);
+      subsystem.peak_bytes = static_cast<double>(subsystem_rs.peak_bytes);
+      subsystem.allocations = static_cast<double>(subsystem_rs.allocations);
+      stats.subsystems.push_back(std::move(subsystem));
+    }
+    stats.calls.reserve(stats_rs.calls.size());
+    for (const auto& call_rs : stats_rs.calls) {
+      BarkCallAllocStats call;
+      call.name = std::string(call_rs.name.data(), call_rs.name.length());
+      call.calls = static_cast<double>(call_rs.calls);
+      call.allocations = static_cast<double>(call_rs.allocations);
+      call.bytes = static_cast<double>(call_rs.bytes);
+      stats.calls.push_back(std::move(call));
+    }
+    return stats;
+  }
+
+  void resetAllocStats() override {
+    bark_cxx::reset_alloc_stats();
+  }
+
+  void setReadCoalesceWindow(double windowMs) override {
+    bark_cxx::set_read_coalesce_window(static_cast<uint64_t>(windowMs));
+  }
+
+  void setArkInfoTtl(double ttlSecs) override {
+    bark_cxx::set_ark_info_ttl(static_cast<uint64_t>(ttlSecs));
   }
 
   std::shared_ptr<Promise<void>> syncPendingBoards() override {
-    return Promise<void>::async([]() {
+    return bridgeAsync<void>([]() {
       try {
         bark_cxx::sync_pending_boards();
       } catch (const rust::Error& e) {
@@ -161,7 +571,7 @@ public:
   }
 
   std::shared_ptr<Promise<void>> maintenance() override {
-    return Promise<void>::async([]() {
+    return bridgeAsync<void>([]() {
       try {
         bark_cxx::maintenance();
       } catch (const rust::Error& e) {
@@ -170,10 +580,10 @@ public:
     });
   }
 
-  std::shared_ptr<Promise<void>> maintenanceWithOnchain() override {
-    return Promise<void>::async([]() {
+  std::shared_ptr<Promise<void>> maintenanceWithOnchain(const std::optional<BarkCallOpts>& opts) override {
+    return bridgeAsync<void>([limits = convertCallOpts(opts)]() {
       try {
-        bark_cxx::maintenance_with_onchain();
+        bark_cxx::maintenance_with_onchain(limits);
       } catch (const rust::Error& e) {
         throw std::runtime_error(e.what());
       }
@@ -181,7 +591,7 @@ public:
   }
 
   std::shared_ptr<Promise<void>> maintenanceDelegated() override {
-    return Promise<void>::async([]() {
+    return bridgeAsync<void>([]() {
       try {
         bark_cxx::maintenance_delegated();
       } catch (const rust::Error& e) {
@@ -191,7 +601,7 @@ public:
   }
 
   std::shared_ptr<Promise<void>> maintenanceWithOnchainDelegated() override {
-    return Promise<void>::async([]() {
+    return bridgeAsync<void>([]() {
       try {
         bark_cxx::maintenance_with_onchain_delegated();
       } catch (const rust::Error& e) {
@@ -201,7 +611,7 @@ public:
   }
 
   std::shared_ptr<Promise<void>> maintenanceRefresh() override {
-    return Promise<void>::async([]() {
+    return bridgeAsync<void>([]() {
       try {
         bark_cxx::maintenance_refresh();
       } catch (const rust::Error& e) {
@@ -210,8 +620,100 @@ public:
     });
   }
 
+  std::shared_ptr<Promise<BarkMaintenanceReport>>
+  maintenanceScheduled(const std::optional<std::vector<std::string>>& forceStages) override {
+    return bridgeAsync<BarkMaintenanceReport>([forceStages]() {
+      try {
+        rust::Vec<rust::String> force_rs;
+        for (const auto& stage : forceStages.value_or(std::vector<std::string>{})) {
+          force_rs.push_back(rust::String(stage));
+        }
+        bark_cxx::MaintenanceReport report_rs = bark_cxx::maintenance_scheduled(std::move(force_rs));
+        BarkMaintenanceReport report;
+        report.ran = convertRustStrings(report_rs.ran);
+        report.skipped = convertRustStrings(report_rs.skipped);
+        report.failed = convertRustStrings(report_rs.failed);
+        report.errors = convertRustStrings(report_rs.errors);
+        report.coalesced = report_rs.coalesced;
+        report.duration_ms = static_cast<double>(report_rs.duration_ms);
+        return report;
+      } catch (const rust::Error& e) {
+        throw std::runtime_error(e.what());
+      }
+    });
+  }
+
+  std::shared_ptr<Promise<BarkRefreshPlan>> planRefresh(const std::optional<BarkRefreshPlanOpts>& opts) override {
+    return bridgeAsync<BarkRefreshPlan>([opts]() {
+      try {
+        BarkRefreshPlanOpts plan_opts = opts.value_or(BarkRefreshPlanOpts{});
+        bark_cxx::RefreshPlanOpts opts_rs;
+        opts_rs.horizon_blocks = static_cast<uint32_t>(plan_opts.horizonBlocks.value_or(0));
+        opts_rs.fold_dust = plan_opts.foldDust.value_or(true);
+        opts_rs.dust_limit_sat = static_cast<uint64_t>(plan_opts.dustLimitSat.value_or(0));
+        bark_cxx::RefreshPlan plan_rs = bark_cxx::plan_refresh(opts_rs);
+
+        BarkRefreshPlan plan;
+        plan.tip = static_cast<double>(plan_rs.tip);
+        plan.round_blocks = static_cast<double>(plan_rs.round_blocks);
+        if (plan_rs.has_refresh_by) {
+          plan.refresh_by = static_cast<double>(plan_rs.refresh_by);
+        }
+        plan.due_now = plan_rs.due_now;
+        plan.vtxos.reserve(plan_rs.vtxos.size());
+        for (const auto& vtxo_rs : plan_rs.vtxos) {
+          BarkPlannedVtxo vtxo;
+          vtxo.id = std::string(vtxo_rs.id.data(), vtxo_rs.id.length());
+          vtxo.amount_sat = static_cast<double>(vtxo_rs.amount_sat);
+          vtxo.expiry_height = static_cast<double>(vtxo_rs.expiry_height);
+          vtxo.reason = std::string(vtxo_rs.reason.data(), vtxo_rs.reason.length());
+          plan.vtxos.push_back(std::move(vtxo));
+        }
+        plan.total_sat = static_cast<double>(plan_rs.total_sat);
+        if (plan_rs.has_next_refresh_by) {
+          plan.next_refresh_by = static_cast<double>(plan_rs.next_refresh_by);
+        }
+        return plan;
+      } catch (const rust::Error& e) {
+        throw std::runtime_error(e.what());
+      }
+    });
+  }
+
+  std::shared_ptr<Promise<std::optional<BarkRoundStatus>>>
+  executeRefreshPlan(const std::vector<std::string>& vtxoIds) override {
+    return bridgeAsync<std::optional<BarkRoundStatus>>([vtxoIds]() -> std::optional<BarkRoundStatus> {
+      try {
+        rust::Vec<rust::String> ids_rs;
+        ids_rs.reserve(vtxoIds.size());
+        for (const auto& id : vtxoIds) {
+          ids_rs.push_back(rust::String(id));
+        }
+        bark_cxx::RoundStatus status_rs = bark_cxx::execute_refresh_plan(std::move(ids_rs));
+        if (status_rs.status.empty()) {
+          return std::nullopt;
+        }
+
+        BarkRoundStatus status;
+        status.status = std::string(status_rs.status.data(), status_rs.status.length());
+        if (!status_rs.funding_txid.empty()) {
+          status.funding_txid = std::string(status_rs.funding_txid.data(), status_rs.funding_txid.length());
+        }
+        status.unsigned_funding_txids = convertRustStrings(status_rs.unsigned_funding_txids);
+        if (!status_rs.error.empty()) {
+          status.error = std::string(status_rs.error.data(), status_rs.error.length());
+        }
+        status.is_final = status_rs.is_final;
+        status.is_success = status_rs.is_success;
+        return status;
+      } catch (const rust::Error& e) {
+        throw std::runtime_error(e.what());
+      }
+    });
+  }
+
   std::shared_ptr<Promise<void>> sync() override {
-    return Promise<void>::async([]() {
+    return bridgeAsync<void>([]() {
       try {
         bark_cxx::sync();
       } catch (const rust::Error& e) {
@@ -220,10 +722,10 @@ public:
     });
   }
 
-  std::shared_ptr<Promise<void>> syncExits() override {
-    return Promise<void>::async([]() {
+  std::shared_ptr<Promise<void>> syncExits(const std::optional<BarkCallOpts>& opts) override {
+    return bridgeAsync<void>([limits = convertCallOpts(opts)]() {
       try {
-        bark_cxx::sync_exits();
+        bark_cxx::sync_exits(limits);
       } catch (const rust::Error& e) {
         throw std::runtime_error(e.what());
       }
@@ -231,7 +733,7 @@ public:
   }
 
   std::shared_ptr<Promise<void>> syncPendingRounds() override {
-    return Promise<void>::async([]() {
+    return bridgeAsync<void>([]() {
       try {
         bark_cxx::sync_pending_rounds();
       } catch (const rust::Error& e) {
@@ -240,23 +742,53 @@ public:
     });
   }
 
+  // --- Events ---
+
+  void subscribeWalletEvents(const std::function<void(const std::vector<BarkWalletEvent>&)>& onEvents) override {
+    unsubscribeWalletEvents();
+    bark_cxx::set_wallet_events_enabled(true);
+    events_running_ = true;
+    events_thread_ = std::thread([this, onEvents]() {
+      while (events_running_) {
+        // Waits for the first event, then gathers the rest of the frame
+        rust::Vec<bark_cxx::WalletEvent> events_rs =
+            bark_cxx::wait_for_wallet_events(kEventPollTimeoutMs, kEventBatchWindowMs);
+        if (events_rs.empty() || !events_running_) {
+          continue;
+        }
+
+        std::vector<BarkWalletEvent> events;
+        events.reserve(events_rs.size());
+        for (const auto& event_rs : events_rs) {
+          BarkWalletEvent event;
+          event.kind = std::string(event_rs.kind.data(), event_rs.kind.length());
+          event.id = std::string(event_rs.id.data(), event_rs.id.length());
+          event.status = std::string(event_rs.status.data(), event_rs.status.length());
+          event.detail = std::string(event_rs.detail.data(), event_rs.detail.length());
+          events.push_back(std::move(event));
+        }
+        onEvents(events);
+      }
+    });
+  }
+
+  void unsubscribeWalletEvents() override {
+    if (!events_thread_.joinable()) {
+      return;
+    }
+    events_running_ = false;
+    // Disabling wakes the poller out of its wait
+    bark_cxx::set_wallet_events_enabled(false);
+    events_thread_.join();
+  }
+
   // --- Wallet Info ---
 
   std::shared_ptr<Promise<BarkArkInfo>> getArkInfo() override {
-    return Promise<BarkArkInfo>::async([]() {
+    return bridgeAsync<BarkArkInfo>([]() {
       try {
         bark_cxx::CxxArkInfo rust_info = bark_cxx::get_ark_info();
-        BarkArkInfo info;
-        info.network = std::string(rust_info.network.data(), rust_info.network.length());
-        info.server_pubkey = std::string(rust_info.server_pubkey.data(), rust_info.server_pubkey.length());
-        info.round_interval = static_cast<double>(rust_info.round_interval);
-        info.nb_round_nonces = static_cast<double>(rust_info.nb_round_nonces);
-        info.vtxo_exit_delta = static_cast<double>(rust_info.vtxo_exit_delta);
-        info.vtxo_expiry_delta = static_cast<double>(rust_info.vtxo_expiry_delta);
-        info.htlc_send_expiry_delta = static_cast<double>(rust_info.htlc_send_expiry_delta);
-        info.max_vtxo_amount = static_cast<double>(rust_info.max_vtxo_amount);
-        info.required_board_confirmations = static_cast<double>(rust_info.required_board_confirmations);
-        return info;
+        return convertRustArkInfo(rust_info);
       } catch (const rust::Error& e) {
         throw std::runtime_error(e.what());
       }
@@ -264,17 +796,10 @@ public:
   }
 
   std::shared_ptr<Promise<OffchainBalanceResult>> offchainBalance() override {
-    return Promise<OffchainBalanceResult>::async([]() {
+    return bridgeAsync<OffchainBalanceResult>([]() {
       try {
         bark_cxx::OffchainBalance rust_balance = bark_cxx::offchain_balance();
-        OffchainBalanceResult balance;
-        balance.spendable = static_cast<double>(rust_balance.spendable);
-        balance.pending_lightning_send = static_cast<double>(rust_balance.pending_lightning_send);
-        balance.pending_in_round = static_cast<double>(rust_balance.pending_in_round);
-        balance.pending_exit = static_cast<double>(rust_balance.pending_exit);
-        balance.pending_board = static_cast<double>(rust_balance.pending_board);
-
-        return balance;
+        return convertRustOffchainBalance(rust_balance);
       } catch (const rust::Error& e) {
         throw std::runtime_error(e.what());
       }
@@ -282,7 +807,7 @@ public:
   }
 
   std::shared_ptr<Promise<KeyPairResult>> deriveStoreNextKeypair() override {
-    return Promise<KeyPairResult>::async([]() {
+    return bridgeAsync<KeyPairResult>([]() {
       try {
         bark_cxx::KeyPairResult keypair_rs = bark_cxx::derive_store_next_keypair();
         KeyPairResult keypair;
@@ -297,7 +822,7 @@ public:
   }
 
   std::shared_ptr<Promise<KeyPairResult>> peakKeyPair(double index) override {
-    return Promise<KeyPairResult>::async([index]() {
+    return bridgeAsync<KeyPairResult>([index]() {
       try {
         uint32_t index_val = static_cast<uint32_t>(index);
         bark_cxx::KeyPairResult keypair_rs = bark_cxx::peak_keypair(index_val);
@@ -311,8 +836,20 @@ public:
     });
   }
 
+  std::shared_ptr<Promise<std::vector<KeyPairResult>>> peakKeyPairs(double start, double count) override {
+    return bridgeAsync<std::vector<KeyPairResult>>([start, count]() {
+      try {
+        rust::Vec<bark_cxx::KeyPairResult> keypairs_rs =
+            bark_cxx::peak_keypairs(static_cast<uint32_t>(start), static_cast<uint32_t>(count));
+        return convertRustKeyPairs(keypairs_rs);
+      } catch (const rust::Error& e) {
+        throw std::runtime_error(e.what());
+      }
+    });
+  }
+
   std::shared_ptr<Promise<NewAddressResult>> newAddress() override {
-    return Promise<NewAddressResult>::async([]() {
+    return bridgeAsync<NewAddressResult>([]() {
       try {
         bark_cxx::NewAddressResult address_rs = bark_cxx::new_address();
         NewAddressResult address;
@@ -328,7 +865,7 @@ public:
   }
 
   std::shared_ptr<Promise<NewAddressResult>> peakAddress(double index) override {
-    return Promise<NewAddressResult>::async([index]() {
+    return bridgeAsync<NewAddressResult>([index]() {
       try {
         bark_cxx::NewAddressResult address_rs = bark_cxx::peak_address(static_cast<uint32_t>(index));
         NewAddressResult address;
@@ -342,8 +879,20 @@ public:
     });
   }
 
+  std::shared_ptr<Promise<std::vector<NewAddressResult>>> peakAddresses(double start, double count) override {
+    return bridgeAsync<std::vector<NewAddressResult>>([start, count]() {
+      try {
+        rust::Vec<bark_cxx::NewAddressResult> addresses_rs =
+            bark_cxx::peak_addresses(static_cast<uint32_t>(start), static_cast<uint32_t>(count));
+        return convertRustAddresses(addresses_rs);
+      } catch (const rust::Error& e) {
+        throw std::runtime_error(e.what());
+      }
+    });
+  }
+
   std::shared_ptr<Promise<std::string>> signMessage(const std::string& message, double index) override {
-    return Promise<std::string>::async([message, index]() {
+    return bridgeAsync<std::string>([message, index]() {
       try {
         uint32_t index_val = static_cast<uint32_t>(index);
         rust::String signature_rs = bark_cxx::sign_message(message, index_val);
@@ -357,7 +906,7 @@ public:
   std::shared_ptr<Promise<std::string>> signMesssageWithMnemonic(const std::string& message,
                                                                  const std::string& mnemonic,
                                                                  const std::string& network, double index) override {
-    return Promise<std::string>::async([message, mnemonic, network, index]() {
+    return bridgeAsync<std::string>([message, mnemonic, network, index]() {
       try {
         uint32_t index_val = static_cast<uint32_t>(index);
         rust::String signature_rs = bark_cxx::sign_messsage_with_mnemonic(message, mnemonic, network, index_val);
@@ -370,7 +919,7 @@ public:
 
   std::shared_ptr<Promise<KeyPairResult>> deriveKeypairFromMnemonic(const std::string& mnemonic,
                                                                     const std::string& network, double index) override {
-    return Promise<KeyPairResult>::async([mnemonic, network, index]() {
+    return bridgeAsync<KeyPairResult>([mnemonic, network, index]() {
       try {
         uint32_t index_val = static_cast<uint32_t>(index);
         bark_cxx::KeyPairResult keypair_rs = bark_cxx::derive_keypair_from_mnemonic(mnemonic, network, index_val);
@@ -384,9 +933,23 @@ public:
     });
   }
 
+  std::shared_ptr<Promise<std::vector<KeyPairResult>>> deriveKeypairsFromMnemonic(const std::string& mnemonic,
+                                                                                 const std::string& network,
+                                                                                 double start, double count) override {
+    return bridgeAsync<std::vector<KeyPairResult>>([mnemonic, network, start, count]() {
+      try {
+        rust::Vec<bark_cxx::KeyPairResult> keypairs_rs = bark_cxx::derive_keypairs_from_mnemonic(
+            mnemonic, network, static_cast<uint32_t>(start), static_cast<uint32_t>(count));
+        return convertRustKeyPairs(keypairs_rs);
+      } catch (const rust::Error& e) {
+        throw std::runtime_error(e.what());
+      }
+    });
+  }
+
   std::shared_ptr<Promise<bool>> verifyMessage(const std::string& message, const std::string& signature,
                                                const std::string& publicKey) override {
-    return Promise<bool>::async([message, signature, publicKey]() {
+    return bridgeAsync<bool>([message, signature, publicKey]() {
       try {
         return bark_cxx::verify_message(message, signature, publicKey);
       } catch (const rust::Error& e) {
@@ -396,7 +959,7 @@ public:
   }
 
   std::shared_ptr<Promise<std::vector<BarkMovement>>> history() override {
-    return Promise<std::vector<BarkMovement>>::async([]() {
+    return bridgeAsync<std::vector<BarkMovement>>([]() {
       try {
         rust::Vec<bark_cxx::BarkMovement> movements_rs = bark_cxx::history();
 
@@ -404,69 +967,69 @@ public:
         movements.reserve(movements_rs.size());
 
         for (const auto& movement_rs : movements_rs) {
-          BarkMovement movement;
-          movement.id = static_cast<double>(movement_rs.id);
-          movement.status = std::string(movement_rs.status.data(), movement_rs.status.length());
-          movement.metadata_json = std::string(movement_rs.metadata_json.data(), movement_rs.metadata_json.length());
-          movement.intended_balance_sat = static_cast<double>(movement_rs.intended_balance_sat);
-          movement.effective_balance_sat = static_cast<double>(movement_rs.effective_balance_sat);
-          movement.offchain_fee_sat = static_cast<double>(movement_rs.offchain_fee_sat);
-          movement.created_at = std::string(movement_rs.created_at.data(), movement_rs.created_at.length());
-          movement.updated_at = std::string(movement_rs.updated_at.data(), movement_rs.updated_at.length());
-          if (movement_rs.completed_at.length() == 0) {
-            movement.completed_at = std::nullopt;
-          } else {
-            movement.completed_at = std::string(movement_rs.completed_at.data(), movement_rs.completed_at.length());
-          }
-
-          movement.subsystem.name = std::string(movement_rs.subsystem_name.data(), movement_rs.subsystem_name.length());
-          movement.subsystem.kind = std::string(movement_rs.subsystem_kind.data(), movement_rs.subsystem_kind.length());
-
-          movement.sent_to.reserve(movement_rs.sent_to.size());
-          for (const auto& dest_rs : movement_rs.sent_to) {
-            BarkMovementDestination destination;
-            destination.destination = std::string(dest_rs.destination.data(), dest_rs.destination.length());
-            destination.payment_method = std::string(dest_rs.payment_method.data(), dest_rs.payment_method.length());
-            destination.amount_sat = static_cast<double>(dest_rs.amount_sat);
-            movement.sent_to.push_back(std::move(destination));
-          }
-
-          movement.received_on.reserve(movement_rs.received_on.size());
-          for (const auto& dest_rs : movement_rs.received_on) {
-            BarkMovementDestination destination;
-            destination.destination = std::string(dest_rs.destination.data(), dest_rs.destination.length());
-            destination.payment_method = std::string(dest_rs.payment_method.data(), dest_rs.payment_method.length());
-            destination.amount_sat = static_cast<double>(dest_rs.amount_sat);
-            movement.received_on.push_back(std::move(destination));
-          }
-
-          movement.input_vtxos.reserve(movement_rs.input_vtxos.size());
-          for (const auto& vtxo_id : movement_rs.input_vtxos) {
-            movement.input_vtxos.emplace_back(std::string(vtxo_id.data(), vtxo_id.length()));
-          }
+          movements.push_back(convertRustMovement(movement_rs));
+        }
 
-          movement.output_vtxos.reserve(movement_rs.output_vtxos.size());
-          for (const auto& vtxo_id : movement_rs.output_vtxos) {
-            movement.output_vtxos.emplace_back(std::string(vtxo_id.data(), vtxo_id.length()));
-          }
+        return movements;
+      } catch (const rust::Error& e) {
+        throw std::runtime_error(e.what());
+      }
+    });
+  }
 
-          movement.exited_vtxos.reserve(movement_rs.exited_vtxos.size());
-          for (const auto& vtxo_id : movement_rs.exited_vtxos) {
-            movement.exited_vtxos.emplace_back(std::string(vtxo_id.data(), vtxo_id.length()));
-          }
+  std::shared_ptr<Promise<BarkHistoryPage>> historyPage(const BarkHistoryQuery& query) override {
+    return bridgeAsync<BarkHistoryPage>([query]() {
+      try {
+        bark_cxx::HistoryPage page_rs = bark_cxx::history_page(convertHistoryQuery(query));
 
-          movements.push_back(std::move(movement));
+        BarkHistoryPage page;
+        page.movements.reserve(page_rs.movements.size());
+        for (const auto& movement_rs : page_rs.movements) {
+          page.movements.push_back(convertRustMovement(movement_rs));
         }
+        page.has_more = page_rs.has_more;
+        if (page_rs.has_more) {
+          page.next_cursor = static_cast<double>(page_rs.next_cursor);
+        }
+        return page;
+      } catch (const rust::Error& e) {
+        throw std::runtime_error(e.what());
+      }
+    });
+  }
 
-        return movements;
+  std::shared_ptr<Promise<BarkHistoryExportProgress>>
+  exportHistory(const std::string& path, const BarkHistoryExportOpts& opts,
+                const std::function<void(const BarkHistoryExportProgress&)>& onProgress,
+                const std::optional<BarkCallOpts>& callOpts) override {
+    return bridgeAsync<BarkHistoryExportProgress>([path, opts, onProgress, limits = convertCallOpts(callOpts)]() {
+      uint64_t export_id = 0;
+      try {
+        bark_cxx::HistoryExportOpts opts_rs;
+        opts_rs.format = opts.format;
+        opts_rs.query = convertHistoryQuery(opts.query.value_or(BarkHistoryQuery()));
+        opts_rs.chunk_size = static_cast<uint32_t>(opts.chunk_size.value_or(0));
+
+        bark_cxx::HistoryExportProgress progress_rs = bark_cxx::start_history_export(path, std::move(opts_rs), limits);
+        export_id = progress_rs.id;
+        // Each call reads and writes one page, progress is reported in between
+        while (!progress_rs.done) {
+          progress_rs = bark_cxx::advance_history_export(export_id);
+          onProgress(convertRustHistoryExportProgress(progress_rs));
+        }
+        return convertRustHistoryExportProgress(progress_rs);
       } catch (const rust::Error& e) {
         throw std::runtime_error(e.what());
+      } catch (...) {
+        // Removes the partial file if the progress callback threw
+        bark_cxx::cancel_history_export(export_id);
+        throw;
       }
     });
   }
 
   std::shared_ptr<Promise<std::vector<BarkVtxo>>> vtxos() override {
-    return Promise<std::vector<BarkVtxo>>::async([]() {
+    return bridgeAsync<std::vector<BarkVtxo>>([]() {
       try {
         rust::Vec<bark_cxx::BarkVtxo> rust_vtxos = bark_cxx::vtxos();
         return convertRustVtxosToVector(rust_vtxos);
@@ -476,8 +1039,20 @@ public:
     });
   }
 
+  std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> vtxosColumnar() override {
+    return bridgeAsync<std::shared_ptr<ArrayBuffer>>([]() {
+      try {
+        // Hand the Rust buffer to JS as is, it is freed with the ArrayBuffer
+        auto* columns = new rust::Vec<uint8_t>(bark_cxx::vtxos_columnar());
+        return ArrayBuffer::wrap(columns->data(), columns->size(), [columns]() { delete columns; });
+      } catch (const rust::Error& e) {
+        throw std::runtime_error(e.what());
+      }
+    });
+  }
+
   std::shared_ptr<Promise<std::vector<BarkVtxo>>> getExpiringVtxos(double threshold) override {
-    return Promise<std::vector<BarkVtxo>>::async([threshold]() {
+    return bridgeAsync<std::vector<BarkVtxo>>([threshold]() {
       try {
         rust::Vec<bark_cxx::BarkVtxo> rust_vtxos = bark_cxx::get_expiring_vtxos(static_cast<uint32_t>(threshold));
         return convertRustVtxosToVector(rust_vtxos);
@@ -487,8 +1062,52 @@ public:
     });
   }
 
+  // Runs on the JS thread: only copies what the Rust side already has cached.
+  WalletSnapshot getCachedWalletSnapshot() override {
+    bark_cxx::WalletSnapshot snapshot_rs = bark_cxx::cached_wallet_snapshot();
+    WalletSnapshot snapshot;
+    if (snapshot_rs.has_offchain_balance) {
+      snapshot.offchain_balance = convertRustOffchainBalance(snapshot_rs.offchain_balance);
+    }
+    if (snapshot_rs.has_onchain_balance) {
+      snapshot.onchain_balance = convertRustOnchainBalance(snapshot_rs.onchain_balance);
+    }
+    if (snapshot_rs.has_vtxos) {
+      snapshot.vtxos = convertRustVtxosToVector(snapshot_rs.vtxos);
+    }
+    snapshot.has_first_expiring_vtxo_blockheight = snapshot_rs.has_first_expiring_vtxo_blockheight;
+    if (snapshot_rs.first_expiring_vtxo_blockheight != nullptr) {
+      snapshot.first_expiring_vtxo_blockheight = static_cast<double>(*snapshot_rs.first_expiring_vtxo_blockheight);
+      delete snapshot_rs.first_expiring_vtxo_blockheight; // Free the heap-allocated memory from Rust
+    }
+    return snapshot;
+  }
+
+  std::shared_ptr<Promise<DashboardSnapshot>> dashboardSnapshot() override {
+    return bridgeAsync<DashboardSnapshot>([]() {
+      try {
+        bark_cxx::DashboardSnapshot dashboard_rs = bark_cxx::dashboard_snapshot();
+        DashboardSnapshot dashboard;
+        dashboard.offchain_balance = convertRustOffchainBalance(dashboard_rs.offchain_balance);
+        dashboard.onchain_balance = convertRustOnchainBalance(dashboard_rs.onchain_balance);
+        if (dashboard_rs.has_ark_info) {
+          dashboard.ark_info = convertRustArkInfo(dashboard_rs.ark_info);
+        }
+        if (dashboard_rs.next_required_refresh_blockheight != nullptr) {
+          dashboard.next_required_refresh_blockheight =
+              static_cast<double>(*dashboard_rs.next_required_refresh_blockheight);
+          delete dashboard_rs.next_required_refresh_blockheight; // Free the heap-allocated memory from Rust
+        }
+        dashboard.vtxos = convertRustVtxosToVector(dashboard_rs.vtxos);
+        return dashboard;
+      } catch (const rust::Error& e) {
+        throw std::runtime_error(e.what());
+      }
+    });
+  }
+
   std::shared_ptr<Promise<std::optional<double>>> getFirstExpiringVtxoBlockheight() override {
-    return Promise<std::optional<double>>::async([]() {
+    return bridgeAsync<std::optional<double>>([]() {
       try {
         const uint32_t* result_ptr = bark_cxx::get_first_expiring_vtxo_blockheight();
         if (result_ptr == nullptr) {
@@ -504,7 +1123,7 @@ public:
   }
 
   std::shared_ptr<Promise<std::optional<double>>> getNextRequiredRefreshBlockheight() override {
-    return Promise<std::optional<double>>::async([]() {
+    return bridgeAsync<std::optional<double>>([]() {
       try {
         const uint32_t* result_ptr = bark_cxx::get_next_required_refresh_blockheight();
         if (result_ptr == nullptr) {
@@ -522,15 +1141,10 @@ public:
   // --- Onchain Operations ---
 
   std::shared_ptr<Promise<OnchainBalanceResult>> onchainBalance() override {
-    return Promise<OnchainBalanceResult>::async([]() {
+    return bridgeAsync<OnchainBalanceResult>([]() {
       try {
         bark_cxx::OnChainBalance rust_balance = bark_cxx::onchain_balance();
-        OnchainBalanceResult balance;
-        balance.immature = static_cast<double>(rust_balance.immature);
-        balance.trusted_pending = static_cast<double>(rust_balance.trusted_pending);
-        balance.untrusted_pending = static_cast<double>(rust_balance.untrusted_pending);
-        balance.confirmed = static_cast<double>(rust_balance.confirmed);
-        return balance;
+        return convertRustOnchainBalance(rust_balance);
       } catch (const rust::Error& e) {
         throw std::runtime_error(e.what());
       }
@@ -538,7 +1152,7 @@ public:
   }
 
   std::shared_ptr<Promise<void>> onchainSync() override {
-    return Promise<void>::async([]() {
+    return bridgeAsync<void>([]() {
       try {
         bark_cxx::onchain_sync();
       } catch (const rust::Error& e) {
@@ -547,8 +1161,24 @@ public:
     });
   }
 
+  std::shared_ptr<Promise<BarkOnchainSyncReport>> onchainSyncIncremental(std::optional<bool> force) override {
+    return bridgeAsync<BarkOnchainSyncReport>([force]() {
+      try {
+        bark_cxx::OnchainSyncReport report_rs = bark_cxx::onchain_sync_incremental(force.value_or(false));
+        BarkOnchainSyncReport report;
+        report.skipped = report_rs.skipped;
+        report.from_height = static_cast<double>(report_rs.from_height);
+        report.tip_height = static_cast<double>(report_rs.tip_height);
+        report.duration_ms = static_cast<double>(report_rs.duration_ms);
+        return report;
+      } catch (const rust::Error& e) {
+        throw std::runtime_error(e.what());
+      }
+    });
+  }
+
   std::shared_ptr<Promise<std::string>> onchainListUnspent() override {
-    return Promise<std::string>::async([]() {
+    return bridgeAsync<std::string>([]() {
       try {
         rust::String json_rs = bark_cxx::onchain_list_unspent();
         return std::string(json_rs.data(), json_rs.length());
@@ -559,7 +1189,7 @@ public:
   }
 
   std::shared_ptr<Promise<std::string>> onchainUtxos() override {
-    return Promise<std::string>::async([]() {
+    return bridgeAsync<std::string>([]() {
       try {
         rust::String json_rs = bark_cxx::onchain_utxos();
         return std::string(json_rs.data(), json_rs.length());
@@ -569,8 +1199,30 @@ public:
     });
   }
 
+  std::shared_ptr<Promise<std::vector<BarkOnchainUtxo>>>
+  onchainUnspentOutputs(const std::optional<BarkOnchainUtxoFilter>& filter) override {
+    return bridgeAsync<std::vector<BarkOnchainUtxo>>([filter]() {
+      try {
+        return convertRustOnchainUtxos(bark_cxx::onchain_unspent_outputs(createOnchainUtxoFilter(filter)));
+      } catch (const rust::Error& e) {
+        throw std::runtime_error(e.what());
+      }
+    });
+  }
+
+  std::shared_ptr<Promise<std::vector<BarkOnchainUtxo>>>
+  onchainUtxoList(const std::optional<BarkOnchainUtxoFilter>& filter) override {
+    return bridgeAsync<std::vector<BarkOnchainUtxo>>([filter]() {
+      try {
+        return convertRustOnchainUtxos(bark_cxx::onchain_utxo_list(createOnchainUtxoFilter(filter)));
+      } catch (const rust::Error& e) {
+        throw std::runtime_error(e.what());
+      }
+    });
+  }
+
   std::shared_ptr<Promise<std::string>> onchainAddress() override {
-    return Promise<std::string>::async([]() {
+    return bridgeAsync<std::string>([]() {
       try {
         rust::String address_rs = bark_cxx::onchain_address();
         return std::string(address_rs.data(), address_rs.length());
@@ -582,7 +1234,7 @@ public:
 
   std::shared_ptr<Promise<OnchainPaymentResult>> onchainSend(const std::string& destination, double amountSat,
                                                              std::optional<double> feeRate) override {
-    return Promise<OnchainPaymentResult>::async([destination, amountSat, feeRate]() {
+    return bridgeAsync<OnchainPaymentResult>([destination, amountSat, feeRate]() {
       try {
         uint64_t feeRate_val;
         bark_cxx::OnchainPaymentResult rust_result;
@@ -608,7 +1260,7 @@ public:
 
   std::shared_ptr<Promise<std::string>> onchainDrain(const std::string& destination,
                                                      std::optional<double> feeRate) override {
-    return Promise<std::string>::async([destination, feeRate]() {
+    return bridgeAsync<std::string>([destination, feeRate]() {
       try {
         uint64_t feeRate_val;
         rust::String txid_rs;
@@ -627,7 +1279,7 @@ public:
 
   std::shared_ptr<Promise<std::string>> onchainSendMany(const std::vector<BarkSendManyOutput>& outputs,
                                                         std::optional<double> feeRate) override {
-    return Promise<std::string>::async([outputs, feeRate]() {
+    return bridgeAsync<std::string>([outputs, feeRate]() {
       try {
         rust::Vec<bark_cxx::SendManyOutput> cxx_outputs;
         for (const auto& output : outputs) {
@@ -652,7 +1304,7 @@ public:
 
   std::shared_ptr<Promise<LightningSendResult>> payLightningInvoice(const std::string& destination,
                                                                     std::optional<double> amountSat) override {
-    return Promise<LightningSendResult>::async([destination, amountSat]() {
+    return bridgeAsync<LightningSendResult>([destination, amountSat]() {
       try {
         bark_cxx::LightningSend rust_result;
         if (amountSat.has_value()) {
@@ -661,19 +1313,40 @@ public:
         } else {
           rust_result = bark_cxx::pay_lightning_invoice(destination, nullptr);
         }
+        return convertRustLightningSend(rust_result);
+      } catch (const rust::Error& e) {
+        throw std::runtime_error(e.what());
+      }
+    });
+  }
 
-        LightningSendResult result;
-        result.invoice = std::string(rust_result.invoice.data(), rust_result.invoice.length());
-        result.payment_hash = std::string(rust_result.payment_hash.data(), rust_result.payment_hash.length());
-        result.amount = static_cast<double>(rust_result.amount);
-        result.htlc_vtxos = convertRustVtxosToVector(rust_result.htlc_vtxos);
-        result.movement_id = static_cast<double>(rust_result.movement_id);
-        std::string preimage_str(rust_result.preimage.data(), rust_result.preimage.length());
-        result.preimage = preimage_str.empty()
-                              ? std::nullopt
-                              : std::make_optional(std::variant<nitro::NullType, std::string>(preimage_str));
-
-        return result;
+  std::shared_ptr<Promise<std::vector<LightningBatchResult>>>
+  payLightningInvoices(const std::vector<BarkLightningInvoicePayment>& payments) override {
+    return bridgeAsync<std::vector<LightningBatchResult>>([payments]() {
+      try {
+        rust::Vec<bark_cxx::LightningInvoicePayment> cxx_payments;
+        cxx_payments.reserve(payments.size());
+        for (const auto& payment : payments) {
+          // An amount of 0 pays the amount of the invoice
+          cxx_payments.push_back(
+              {rust::String(payment.invoice), static_cast<uint64_t>(payment.amountSat.value_or(0))});
+        }
+        rust::Vec<bark_cxx::LightningBatchResult> results_rs =
+            bark_cxx::pay_lightning_invoices(std::move(cxx_payments));
+
+        std::vector<LightningBatchResult> results;
+        results.reserve(results_rs.size());
+        for (const auto& result_rs : results_rs) {
+          LightningBatchResult result;
+          result.invoice = std::string(result_rs.invoice.data(), result_rs.invoice.length());
+          if (result_rs.error.empty()) {
+            result.payment = convertRustLightningSend(result_rs.payment);
+          } else {
+            result.error = std::string(result_rs.error.data(), result_rs.error.length());
+          }
+          results.push_back(std::move(result));
+        }
+        return results;
       } catch (const rust::Error& e) {
         throw std::runtime_error(e.what());
       }
@@ -682,7 +1355,7 @@ public:
 
   std::shared_ptr<Promise<LightningSendResult>> payLightningOffer(const std::string& offer,
                                                                   std::optional<double> amountSat) override {
-    return Promise<LightningSendResult>::async([offer, amountSat]() {
+    return bridgeAsync<LightningSendResult>([offer, amountSat]() {
       try {
         bark_cxx::LightningSend rust_result;
         if (amountSat.has_value()) {
@@ -712,7 +1385,7 @@ public:
 
   std::shared_ptr<Promise<LightningSendResult>> payLightningAddress(const std::string& addr, double amountSat,
                                                                     const std::string& comment) override {
-    return Promise<LightningSendResult>::async([addr, amountSat, comment]() {
+    return bridgeAsync<LightningSendResult>([addr, amountSat, comment]() {
       try {
         bark_cxx::LightningSend rust_result =
             bark_cxx::pay_lightning_address(addr, static_cast<uint64_t>(amountSat), comment);
@@ -736,7 +1409,7 @@ public:
   }
 
   std::shared_ptr<Promise<Bolt11Invoice>> bolt11Invoice(double amountMsat) override {
-    return Promise<Bolt11Invoice>::async([amountMsat]() {
+    return bridgeAsync<Bolt11Invoice>([amountMsat]() {
       try {
         bark_cxx::Bolt11Invoice invoice_rs = bark_cxx::bolt11_invoice(static_cast<uint64_t>(amountMsat));
         return Bolt11Invoice(std::string(invoice_rs.bolt11_invoice.data(), invoice_rs.bolt11_invoice.length()),
@@ -751,34 +1424,40 @@ public:
   std::shared_ptr<Promise<LightningReceive>>
   tryClaimLightningReceive(const std::string& paymentHash, bool wait,
                            const std::optional<std::string>& token) override {
-    return Promise<LightningReceive>::async([paymentHash, wait, token]() -> LightningReceive {
+    if (wait) {
+      // Runs as a task on the Rust runtime instead of blocking a worker thread
+      auto promise = Promise<LightningReceive>::create();
+      startLightningWait(
+          promise,
+          [&]() {
+            if (token.has_value()) {
+              rust::String token_rs(token.value());
+              return bark_cxx::start_try_claim_lightning_receive(paymentHash, &token_rs);
+            }
+            return bark_cxx::start_try_claim_lightning_receive(paymentHash, nullptr);
+          },
+          [promise](const bark_cxx::LightningWaitResult& result) {
+            std::unique_ptr<const bark_cxx::LightningReceive> receive(result.receive);
+            if (receive == nullptr) {
+              promise->reject(std::runtime_error(std::string(result.error.data(), result.error.length())));
+              return;
+            }
+            promise->resolve(convertRustLightningReceive(*receive));
+          });
+      return promise;
+    }
+
+    return bridgeAsync<LightningReceive>([paymentHash, token]() -> LightningReceive {
       try {
         bark_cxx::LightningReceive result;
         if (token.has_value()) {
           rust::String token_rs(token.value());
-          result = bark_cxx::try_claim_lightning_receive(paymentHash, wait, &token_rs);
-        } else {
-          result = bark_cxx::try_claim_lightning_receive(paymentHash, wait, nullptr);
-        }
-
-        LightningReceive lr;
-        lr.payment_hash = std::string(result.payment_hash.data(), result.payment_hash.length());
-        lr.payment_preimage = std::string(result.payment_preimage.data(), result.payment_preimage.length());
-        lr.invoice = std::string(result.invoice.data(), result.invoice.length());
-
-        if (result.preimage_revealed_at != nullptr) {
-          lr.preimage_revealed_at = static_cast<double>(*result.preimage_revealed_at);
+          result = bark_cxx::try_claim_lightning_receive(paymentHash, false, &token_rs);
         } else {
-          lr.preimage_revealed_at = std::nullopt;
+          result = bark_cxx::try_claim_lightning_receive(paymentHash, false, nullptr);
         }
 
-        if (result.finished_at != nullptr) {
-          lr.finished_at = static_cast<double>(*result.finished_at);
-        } else {
-          lr.finished_at = std::nullopt;
-        }
-
-        return lr;
+        return convertRustLightningReceive(result);
       } catch (const rust::Error& e) {
         throw std::runtime_error(e.what());
       }
@@ -786,7 +1465,7 @@ public:
   }
 
   std::shared_ptr<Promise<void>> tryClaimAllLightningReceives(bool wait) override {
-    return Promise<void>::async([wait]() {
+    return bridgeAsync<void>([wait]() {
       try {
         bark_cxx::try_claim_all_lightning_receives(wait);
       } catch (const rust::Error& e) {
@@ -797,7 +1476,7 @@ public:
 
   std::shared_ptr<Promise<std::optional<LightningReceive>>>
   lightningReceiveStatus(const std::string& paymentHash) override {
-    return Promise<std::optional<LightningReceive>>::async([paymentHash]() {
+    return bridgeAsync<std::optional<LightningReceive>>([paymentHash]() {
       try {
         const bark_cxx::LightningReceive* status_ptr = bark_cxx::lightning_receive_status(paymentHash);
 
@@ -806,25 +1485,7 @@ public:
         }
 
         std::unique_ptr<const bark_cxx::LightningReceive> status(status_ptr);
-
-        LightningReceive result;
-        result.payment_hash = std::string(status->payment_hash.data(), status->payment_hash.length());
-        result.payment_preimage = std::string(status->payment_preimage.data(), status->payment_preimage.length());
-        result.invoice = std::string(status->invoice.data(), status->invoice.length());
-
-        if (status->preimage_revealed_at != nullptr) {
-          result.preimage_revealed_at = static_cast<double>(*status->preimage_revealed_at);
-        } else {
-          result.preimage_revealed_at = std::nullopt;
-        }
-
-        if (status->finished_at != nullptr) {
-          result.finished_at = static_cast<double>(*status->finished_at);
-        } else {
-          result.finished_at = std::nullopt;
-        }
-
-        return std::optional<LightningReceive>(result);
+        return std::optional<LightningReceive>(convertRustLightningReceive(*status));
       } catch (const rust::Error& e) {
         throw std::runtime_error(e.what());
       }
@@ -833,9 +1494,25 @@ public:
 
   std::shared_ptr<Promise<std::variant<nitro::NullType, std::string>>>
   checkLightningPayment(const std::string& paymentHash, bool wait) override {
-    return Promise<std::variant<nitro::NullType, std::string>>::async([paymentHash, wait]() {
+    if (wait) {
+      // Runs as a task on the Rust runtime instead of blocking a worker thread
+      auto promise = Promise<std::variant<nitro::NullType, std::string>>::create();
+      startLightningWait(
+          promise, [&]() { return bark_cxx::start_check_lightning_payment(paymentHash); },
+          [promise](const bark_cxx::LightningWaitResult& result) {
+            if (result.error.length() != 0) {
+              promise->reject(std::runtime_error(std::string(result.error.data(), result.error.length())));
+              return;
+            }
+            promise->resolve(
+                std::variant<nitro::NullType, std::string>(std::string(result.preimage.data(), result.preimage.length())));
+          });
+      return promise;
+    }
+
+    return bridgeAsync<std::variant<nitro::NullType, std::string>>([paymentHash]() {
       try {
-        rust::String result = bark_cxx::check_lightning_payment(paymentHash, wait);
+        rust::String result = bark_cxx::check_lightning_payment(paymentHash, false);
         std::string preimage_str(result.data(), result.length());
         if (preimage_str.empty()) {
           return std::variant<nitro::NullType, std::string>(nitro::NullType());
@@ -847,9 +1524,13 @@ public:
     });
   }
 
+  double cancelLightningWait(const std::string& paymentHash) override {
+    return static_cast<double>(bark_cxx::cancel_lightning_wait(paymentHash));
+  }
+
   // --- Ark Operations ---
   std::shared_ptr<Promise<BoardResult>> boardAmount(double amountSat) override {
-    return Promise<BoardResult>::async([amountSat]() {
+    return bridgeAsync<BoardResult>([amountSat]() {
       try {
         bark_cxx::BoardResult result_rs = bark_cxx::board_amount(static_cast<uint64_t>(amountSat));
         BoardResult result;
@@ -866,10 +1547,10 @@ public:
     });
   }
 
-  std::shared_ptr<Promise<BoardResult>> boardAll() override {
-    return Promise<BoardResult>::async([]() {
+  std::shared_ptr<Promise<BoardResult>> boardAll(const std::optional<BarkCallOpts>& opts) override {
+    return bridgeAsync<BoardResult>([limits = convertCallOpts(opts)]() {
       try {
-        bark_cxx::BoardResult result_rs = bark_cxx::board_all();
+        bark_cxx::BoardResult result_rs = bark_cxx::board_all(limits);
         BoardResult result;
         result.funding_txid = std::string(result_rs.funding_txid.data(), result_rs.funding_txid.length());
         std::vector<std::string> vtxos_vec;
@@ -884,8 +1565,37 @@ public:
     });
   }
 
+  std::shared_ptr<Promise<BarkParsedDestination>> parseDestination(const std::string& destination,
+                                                                   bool resolve) override {
+    return bridgeAsync<BarkParsedDestination>([destination, resolve]() {
+      try {
+        bark_cxx::ParsedDestination rust_parsed = bark_cxx::parse_destination(destination, resolve);
+        BarkParsedDestination parsed;
+        parsed.kind = std::string(rust_parsed.kind.data(), rust_parsed.kind.length());
+        if (rust_parsed.amount_msat > 0) {
+          parsed.amount_msat = static_cast<double>(rust_parsed.amount_msat);
+        }
+        if (rust_parsed.expires_at > 0) {
+          parsed.expires_at = static_cast<double>(rust_parsed.expires_at);
+        }
+        parsed.expired = rust_parsed.expired;
+        // A resolved lightning address always accepts some amount
+        if (rust_parsed.lnurl_max_sendable_msat > 0) {
+          parsed.lnurl_min_sendable_msat = static_cast<double>(rust_parsed.lnurl_min_sendable_msat);
+          parsed.lnurl_max_sendable_msat = static_cast<double>(rust_parsed.lnurl_max_sendable_msat);
+          parsed.lnurl_comment_allowed = static_cast<double>(rust_parsed.lnurl_comment_allowed);
+          parsed.lnurl_description =
+              std::string(rust_parsed.lnurl_description.data(), rust_parsed.lnurl_description.length());
+        }
+        return parsed;
+      } catch (const rust::Error& e) {
+        throw std::runtime_error(e.what());
+      }
+    });
+  }
+
   std::shared_ptr<Promise<void>> validateArkoorAddress(const std::string& address) override {
-    return Promise<void>::async([address]() {
+    return bridgeAsync<void>([address]() {
       try {
         bark_cxx::validate_arkoor_address(address);
       } catch (const rust::Error& e) {
@@ -896,7 +1606,7 @@ public:
 
   std::shared_ptr<Promise<ArkoorPaymentResult>> sendArkoorPayment(const std::string& destination,
                                                                   double amountSat) override {
-    return Promise<ArkoorPaymentResult>::async([destination, amountSat]() {
+    return bridgeAsync<ArkoorPaymentResult>([destination, amountSat]() {
       try {
         bark_cxx::ArkoorPaymentResult rust_result =
             bark_cxx::send_arkoor_payment(destination, static_cast<uint64_t>(amountSat));
@@ -915,8 +1625,38 @@ public:
     });
   }
 
+  std::shared_ptr<Promise<std::vector<ArkoorBatchResult>>>
+  sendArkoorMany(const std::vector<BarkSendManyOutput>& outputs) override {
+    return bridgeAsync<std::vector<ArkoorBatchResult>>([outputs]() {
+      try {
+        rust::Vec<bark_cxx::SendManyOutput> cxx_outputs;
+        cxx_outputs.reserve(outputs.size());
+        for (const auto& output : outputs) {
+          cxx_outputs.push_back({rust::String(output.destination), static_cast<uint64_t>(output.amountSat)});
+        }
+        rust::Vec<bark_cxx::ArkoorBatchResult> results_rs = bark_cxx::send_arkoor_many(std::move(cxx_outputs));
+
+        std::vector<ArkoorBatchResult> results;
+        results.reserve(results_rs.size());
+        for (const auto& result_rs : results_rs) {
+          ArkoorBatchResult result;
+          result.destination = std::string(result_rs.destination.data(), result_rs.destination.length());
+          result.amount_sat = static_cast<double>(result_rs.amount_sat);
+          result.vtxos = convertRustVtxosToVector(result_rs.vtxos);
+          if (!result_rs.error.empty()) {
+            result.error = std::string(result_rs.error.data(), result_rs.error.length());
+          }
+          results.push_back(std::move(result));
+        }
+        return results;
+      } catch (const rust::Error& e) {
+        throw std::runtime_error(e.what());
+      }
+    });
+  }
+
   std::shared_ptr<Promise<std::string>> sendOnchain(const std::string& destination, double amountSat) override {
-    return Promise<std::string>::async([destination, amountSat]() {
+    return bridgeAsync<std::string>([destination, amountSat]() {
       try {
         rust::String result = bark_cxx::send_onchain(destination, static_cast<uint64_t>(amountSat));
         return std::string(result);
@@ -930,7 +1670,7 @@ public:
 
   std::shared_ptr<Promise<std::string>> offboardSpecific(const std::vector<std::string>& vtxoIds,
                                                          const std::string& destinationAddress) override {
-    return Promise<std::string>::async([vtxoIds, destinationAddress]() {
+    return bridgeAsync<std::string>([vtxoIds, destinationAddress]() {
       try {
         rust::Vec<rust::String> rust_vtxo_ids;
         for (const auto& id : vtxoIds) {
@@ -944,10 +1684,11 @@ public:
     });
   }
 
-  std::shared_ptr<Promise<std::string>> offboardAll(const std::string& destinationAddress) override {
-    return Promise<std::string>::async([destinationAddress]() {
+  std::shared_ptr<Promise<std::string>> offboardAll(const std::string& destinationAddress,
+                                                    const std::optional<BarkCallOpts>& opts) override {
+    return bridgeAsync<std::string>([destinationAddress, limits = convertCallOpts(opts)]() {
       try {
-        rust::String result = bark_cxx::offboard_all(destinationAddress);
+        rust::String result = bark_cxx::offboard_all(destinationAddress, limits);
         return std::string(result);
       } catch (const rust::Error& e) {
         throw std::runtime_error(e.what());
@@ -956,8 +1697,77 @@ public:
   }
 
 private:
+  using LightningWaitHandler = std::function<void(const bark_cxx::LightningWaitResult&)>;
+
+  // Starts a wait on the Rust runtime and registers `onDone` for its result.
+  // The registry lock is held across the start so the dispatcher can never
+  // see a completion before its handler.
+  template <typename T, typename Start>
+  void startLightningWait(const std::shared_ptr<Promise<T>>& promise, Start&& start, LightningWaitHandler onDone) {
+    std::lock_guard<std::mutex> lock(lightning_waits_mutex_);
+    uint64_t request_id;
+    try {
+      request_id = start();
+    } catch (const rust::Error& e) {
+      promise->reject(std::runtime_error(e.what()));
+      return;
+    }
+    lightning_waits_.emplace(request_id, std::move(onDone));
+
+    if (!lightning_running_) {
+      lightning_running_ = true;
+      lightning_thread_ = std::thread([this]() { dispatchLightningWaits(); });
+    }
+  }
+
+  // A single thread settles every pending wait, however many are open
+  void dispatchLightningWaits() {
+    while (lightning_running_) {
+      rust::Vec<bark_cxx::LightningWaitResult> results_rs =
+          bark_cxx::wait_for_lightning_completions(kLightningPollTimeoutMs);
+      for (const auto& result_rs : results_rs) {
+        LightningWaitHandler onDone;
+        {
+          std::lock_guard<std::mutex> lock(lightning_waits_mutex_);
+          auto it = lightning_waits_.find(result_rs.request_id);
+          if (it != lightning_waits_.end()) {
+            onDone = std::move(it->second);
+            lightning_waits_.erase(it);
+          }
+        }
+        if (onDone) {
+          onDone(result_rs);
+        } else {
+          delete result_rs.receive; // Free the heap-allocated memory from Rust
+        }
+      }
+    }
+  }
+
+  void stopLightningWaits() {
+    if (!lightning_thread_.joinable()) {
+      return;
+    }
+    lightning_running_ = false;
+    lightning_thread_.join();
+  }
+
   // Tag for logging/debugging within Nitro
   static constexpr auto TAG = "NitroArk";
+
+  // Event delivery: one frame of coalescing, and a poll timeout that bounds
+  // how long unsubscribing can take
+  static constexpr uint32_t kEventBatchWindowMs = 16;
+  static constexpr uint32_t kEventPollTimeoutMs = 1000;
+  std::thread events_thread_;
+  std::atomic<bool> events_running_{false};
+
+  // Lightning waits: the poll timeout bounds how long teardown can take
+  static constexpr uint32_t kLightningPollTimeoutMs = 1000;
+  std::mutex lightning_waits_mutex_;
+  std::unordered_map<uint64_t, LightningWaitHandler> lightning_waits_;
+  std::thread lightning_thread_;
+  std::atomic<bool> lightning_running_{false};
 };
 
 } // namespace margelo::nitro::nitroark
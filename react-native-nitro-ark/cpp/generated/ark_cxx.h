@@ -808,8 +808,13 @@ namespace bark_cxx {
   struct Bolt11Invoice;
   struct LightningSend;
   struct ArkoorPaymentResult;
+  struct ParsedDestination;
+  struct ArkoorBatchResult;
+  struct LightningInvoicePayment;
+  struct LightningBatchResult;
   struct OnchainPaymentResult;
   struct CxxArkInfo;
+  struct StorageOpts;
   struct ConfigOpts;
   struct CreateOpts;
   struct SendManyOutput;
@@ -821,6 +826,30 @@ namespace bark_cxx {
   struct BarkMovementDestination;
   struct BarkMovement;
   struct RoundStatus;
+  struct WalletSnapshot;
+  struct DashboardSnapshot;
+  struct OnchainUtxo;
+  struct OnchainUtxoFilter;
+  struct HistoryQuery;
+  struct HistoryPage;
+  struct HistoryExportOpts;
+  struct HistoryExportProgress;
+  struct WalletEvent;
+  struct OnchainSyncReport;
+  struct MaintenanceReport;
+  struct RefreshPlanOpts;
+  struct PlannedVtxo;
+  struct RefreshPlan;
+  struct WalletOpenTimings;
+  struct LatencyHistogram;
+  struct CallMetrics;
+  struct SubsystemAllocStats;
+  struct CallAllocStats;
+  struct AllocStats;
+  struct CallLimits;
+  struct LogOpts;
+  struct RuntimeOpts;
+  struct LightningWaitResult;
 }
 
 namespace bark_cxx {
@@ -896,6 +925,64 @@ struct ArkoorPaymentResult final {
 };
 #endif // CXXBRIDGE1_STRUCT_bark_cxx$ArkoorPaymentResult
 
+#ifndef CXXBRIDGE1_STRUCT_bark_cxx$ParsedDestination
+#define CXXBRIDGE1_STRUCT_bark_cxx$ParsedDestination
+// A destination recognised by `parse_destination`. Zero amounts and
+// times are unset. The `lnurl_` fields are only set for a resolved
+// lightning address.
+struct ParsedDestination final {
+  // ark, bolt11, bolt12_offer, lightning_address or onchain
+  ::rust::String kind;
+  ::std::uint64_t amount_msat CXX_DEFAULT_VALUE(0);
+  ::std::uint64_t expires_at CXX_DEFAULT_VALUE(0);
+  bool expired CXX_DEFAULT_VALUE(false);
+  ::std::uint64_t lnurl_min_sendable_msat CXX_DEFAULT_VALUE(0);
+  ::std::uint64_t lnurl_max_sendable_msat CXX_DEFAULT_VALUE(0);
+  ::std::uint32_t lnurl_comment_allowed CXX_DEFAULT_VALUE(0);
+  ::rust::String lnurl_description;
+
+  using IsRelocatable = ::std::true_type;
+};
+#endif // CXXBRIDGE1_STRUCT_bark_cxx$ParsedDestination
+
+#ifndef CXXBRIDGE1_STRUCT_bark_cxx$ArkoorBatchResult
+#define CXXBRIDGE1_STRUCT_bark_cxx$ArkoorBatchResult
+// Outcome of one output of `send_arkoor_many`, `error` is empty on success
+struct ArkoorBatchResult final {
+  ::rust::String destination;
+  ::std::uint64_t amount_sat CXX_DEFAULT_VALUE(0);
+  ::rust::Vec<::bark_cxx::BarkVtxo> vtxos;
+  ::rust::String error;
+
+  using IsRelocatable = ::std::true_type;
+};
+#endif // CXXBRIDGE1_STRUCT_bark_cxx$ArkoorBatchResult
+
+#ifndef CXXBRIDGE1_STRUCT_bark_cxx$LightningInvoicePayment
+#define CXXBRIDGE1_STRUCT_bark_cxx$LightningInvoicePayment
+// One invoice of `pay_lightning_invoices`, an amount of 0 pays the
+// amount of the invoice
+struct LightningInvoicePayment final {
+  ::rust::String invoice;
+  ::std::uint64_t amount_sat CXX_DEFAULT_VALUE(0);
+
+  using IsRelocatable = ::std::true_type;
+};
+#endif // CXXBRIDGE1_STRUCT_bark_cxx$LightningInvoicePayment
+
+#ifndef CXXBRIDGE1_STRUCT_bark_cxx$LightningBatchResult
+#define CXXBRIDGE1_STRUCT_bark_cxx$LightningBatchResult
+// Outcome of one invoice of `pay_lightning_invoices`, `payment` is only
+// set when `error` is empty
+struct LightningBatchResult final {
+  ::rust::String invoice;
+  ::bark_cxx::LightningSend payment;
+  ::rust::String error;
+
+  using IsRelocatable = ::std::true_type;
+};
+#endif // CXXBRIDGE1_STRUCT_bark_cxx$LightningBatchResult
+
 #ifndef CXXBRIDGE1_STRUCT_bark_cxx$OnchainPaymentResult
 #define CXXBRIDGE1_STRUCT_bark_cxx$OnchainPaymentResult
 struct OnchainPaymentResult final {
@@ -924,6 +1011,24 @@ struct CxxArkInfo final {
 };
 #endif // CXXBRIDGE1_STRUCT_bark_cxx$CxxArkInfo
 
+#ifndef CXXBRIDGE1_STRUCT_bark_cxx$StorageOpts
+#define CXXBRIDGE1_STRUCT_bark_cxx$StorageOpts
+// SQLite settings of the wallet database. Empty strings and zero sizes
+// keep the default.
+struct StorageOpts final {
+  // "wal" (default), "delete" or "truncate"
+  ::rust::String journal_mode;
+  // "off", "normal", "full" (default) or "extra"
+  ::rust::String synchronous;
+  ::std::uint64_t mmap_size CXX_DEFAULT_VALUE(0);
+  ::std::uint32_t cache_size_kib CXX_DEFAULT_VALUE(0);
+  // Only applied when the wallet is created
+  ::std::uint32_t page_size CXX_DEFAULT_VALUE(0);
+
+  using IsRelocatable = ::std::true_type;
+};
+#endif // CXXBRIDGE1_STRUCT_bark_cxx$StorageOpts
+
 #ifndef CXXBRIDGE1_STRUCT_bark_cxx$ConfigOpts
 #define CXXBRIDGE1_STRUCT_bark_cxx$ConfigOpts
 struct ConfigOpts final {
@@ -938,6 +1043,7 @@ struct ConfigOpts final {
   ::std::uint16_t htlc_recv_claim_delta CXX_DEFAULT_VALUE(0);
   ::std::uint16_t vtxo_exit_margin CXX_DEFAULT_VALUE(0);
   ::std::uint32_t round_tx_required_confirmations CXX_DEFAULT_VALUE(0);
+  ::bark_cxx::StorageOpts storage;
 
   using IsRelocatable = ::std::true_type;
 };
@@ -1085,14 +1191,431 @@ struct RoundStatus final {
 };
 #endif // CXXBRIDGE1_STRUCT_bark_cxx$RoundStatus
 
+#ifndef CXXBRIDGE1_STRUCT_bark_cxx$WalletSnapshot
+#define CXXBRIDGE1_STRUCT_bark_cxx$WalletSnapshot
+// Whatever is currently held by the in-memory wallet snapshot. Each
+// `has_*` flag tells whether the matching field is populated.
+struct WalletSnapshot final {
+  bool has_offchain_balance CXX_DEFAULT_VALUE(false);
+  ::bark_cxx::OffchainBalance offchain_balance;
+  bool has_onchain_balance CXX_DEFAULT_VALUE(false);
+  ::bark_cxx::OnChainBalance onchain_balance;
+  bool has_vtxos CXX_DEFAULT_VALUE(false);
+  ::rust::Vec<::bark_cxx::BarkVtxo> vtxos;
+  // Set once the height is cached, it is still null without vtxos.
+  bool has_first_expiring_vtxo_blockheight CXX_DEFAULT_VALUE(false);
+  ::std::uint32_t const *first_expiring_vtxo_blockheight CXX_DEFAULT_VALUE(nullptr);
+
+  using IsRelocatable = ::std::true_type;
+};
+#endif // CXXBRIDGE1_STRUCT_bark_cxx$WalletSnapshot
+
+#ifndef CXXBRIDGE1_STRUCT_bark_cxx$DashboardSnapshot
+#define CXXBRIDGE1_STRUCT_bark_cxx$DashboardSnapshot
+// Balances, server info and vtxos for the wallet overview, read in one
+// bridge call. `has_ark_info` is false until the server info is known.
+struct DashboardSnapshot final {
+  ::bark_cxx::OffchainBalance offchain_balance;
+  ::bark_cxx::OnChainBalance onchain_balance;
+  bool has_ark_info CXX_DEFAULT_VALUE(false);
+  ::bark_cxx::CxxArkInfo ark_info;
+  ::std::uint32_t const *next_required_refresh_blockheight CXX_DEFAULT_VALUE(nullptr);
+  ::rust::Vec<::bark_cxx::BarkVtxo> vtxos;
+
+  using IsRelocatable = ::std::true_type;
+};
+#endif // CXXBRIDGE1_STRUCT_bark_cxx$DashboardSnapshot
+
+#ifndef CXXBRIDGE1_STRUCT_bark_cxx$OnchainUtxo
+#define CXXBRIDGE1_STRUCT_bark_cxx$OnchainUtxo
+struct OnchainUtxo final {
+  // "txid:vout"
+  ::rust::String outpoint;
+  ::std::uint64_t amount_sat CXX_DEFAULT_VALUE(0);
+  // 0 while unconfirmed
+  ::std::uint32_t confirmation_height CXX_DEFAULT_VALUE(0);
+  // external or internal for wallet outputs, local or exit for utxos
+  ::rust::String kind;
+
+  using IsRelocatable = ::std::true_type;
+};
+#endif // CXXBRIDGE1_STRUCT_bark_cxx$OnchainUtxo
+
+#ifndef CXXBRIDGE1_STRUCT_bark_cxx$OnchainUtxoFilter
+#define CXXBRIDGE1_STRUCT_bark_cxx$OnchainUtxoFilter
+struct OnchainUtxoFilter final {
+  // Outputs below this amount are skipped, 0 keeps all
+  ::std::uint64_t min_amount_sat CXX_DEFAULT_VALUE(0);
+  bool confirmed_only CXX_DEFAULT_VALUE(false);
+
+  using IsRelocatable = ::std::true_type;
+};
+#endif // CXXBRIDGE1_STRUCT_bark_cxx$OnchainUtxoFilter
+
+#ifndef CXXBRIDGE1_STRUCT_bark_cxx$HistoryQuery
+#define CXXBRIDGE1_STRUCT_bark_cxx$HistoryQuery
+struct HistoryQuery final {
+  // Id of the last movement of the previous page, 0 starts at the newest.
+  ::std::uint32_t cursor CXX_DEFAULT_VALUE(0);
+  // 0 uses the default page size.
+  ::std::uint32_t limit CXX_DEFAULT_VALUE(0);
+  // Empty matches any status.
+  ::rust::String status;
+  // Empty matches any subsystem kind.
+  ::rust::String subsystem_kind;
+  // Unix seconds, inclusive. 0 leaves the bound open.
+  ::std::uint64_t created_after CXX_DEFAULT_VALUE(0);
+  // Unix seconds, exclusive. 0 leaves the bound open.
+  ::std::uint64_t created_before CXX_DEFAULT_VALUE(0);
+  bool include_metadata CXX_DEFAULT_VALUE(false);
+
+  using IsRelocatable = ::std::true_type;
+};
+#endif // CXXBRIDGE1_STRUCT_bark_cxx$HistoryQuery
+
+#ifndef CXXBRIDGE1_STRUCT_bark_cxx$HistoryPage
+#define CXXBRIDGE1_STRUCT_bark_cxx$HistoryPage
+struct HistoryPage final {
+  ::rust::Vec<::bark_cxx::BarkMovement> movements;
+  // Cursor for the next page, only meaningful when `has_more` is set.
+  ::std::uint32_t next_cursor CXX_DEFAULT_VALUE(0);
+  bool has_more CXX_DEFAULT_VALUE(false);
+
+  using IsRelocatable = ::std::true_type;
+};
+#endif // CXXBRIDGE1_STRUCT_bark_cxx$HistoryPage
+
+#ifndef CXXBRIDGE1_STRUCT_bark_cxx$HistoryExportOpts
+#define CXXBRIDGE1_STRUCT_bark_cxx$HistoryExportOpts
+struct HistoryExportOpts final {
+  // csv or jsonl
+  ::rust::String format;
+  // Movements to export, newest first. A limit of 0 exports all.
+  ::bark_cxx::HistoryQuery query;
+  // Rows written per advance call, 0 uses the default.
+  ::std::uint32_t chunk_size CXX_DEFAULT_VALUE(0);
+
+  using IsRelocatable = ::std::true_type;
+};
+#endif // CXXBRIDGE1_STRUCT_bark_cxx$HistoryExportOpts
+
+#ifndef CXXBRIDGE1_STRUCT_bark_cxx$HistoryExportProgress
+#define CXXBRIDGE1_STRUCT_bark_cxx$HistoryExportProgress
+struct HistoryExportProgress final {
+  ::std::uint64_t id CXX_DEFAULT_VALUE(0);
+  ::std::uint64_t written CXX_DEFAULT_VALUE(0);
+  // Set once the file is complete at its final path
+  bool done CXX_DEFAULT_VALUE(false);
+
+  using IsRelocatable = ::std::true_type;
+};
+#endif // CXXBRIDGE1_STRUCT_bark_cxx$HistoryExportProgress
+
+#ifndef CXXBRIDGE1_STRUCT_bark_cxx$WalletEvent
+#define CXXBRIDGE1_STRUCT_bark_cxx$WalletEvent
+struct WalletEvent final {
+  // movement_created, movement_updated, vtxo_state_changed,
+  // round_status, lightning_receive_settled or onchain_sync
+  ::rust::String kind;
+  // Movement id, vtxo id, round funding txid, payment hash or "onchain"
+  ::rust::String id;
+  // New movement status, vtxo state, round status or sync stage
+  ::rust::String status;
+  // Previous status for movements and vtxos, the error for rounds,
+  // "checkpoint:tip" heights for onchain syncs
+  ::rust::String detail;
+
+  using IsRelocatable = ::std::true_type;
+};
+#endif // CXXBRIDGE1_STRUCT_bark_cxx$WalletEvent
+
+#ifndef CXXBRIDGE1_STRUCT_bark_cxx$OnchainSyncReport
+#define CXXBRIDGE1_STRUCT_bark_cxx$OnchainSyncReport
+struct OnchainSyncReport final {
+  // True if nothing changed since the last sync and it was skipped
+  bool skipped CXX_DEFAULT_VALUE(false);
+  // Chain tip of the previous sync, 0 if there was none
+  ::std::uint32_t from_height CXX_DEFAULT_VALUE(0);
+  ::std::uint32_t tip_height CXX_DEFAULT_VALUE(0);
+  ::std::uint64_t duration_ms CXX_DEFAULT_VALUE(0);
+
+  using IsRelocatable = ::std::true_type;
+};
+#endif // CXXBRIDGE1_STRUCT_bark_cxx$OnchainSyncReport
+
+#ifndef CXXBRIDGE1_STRUCT_bark_cxx$MaintenanceReport
+#define CXXBRIDGE1_STRUCT_bark_cxx$MaintenanceReport
+struct MaintenanceReport final {
+  // Names of the stages that ran, including failed ones
+  ::rust::Vec<::rust::String> ran;
+  // Names of the stages that had nothing to do
+  ::rust::Vec<::rust::String> skipped;
+  ::rust::Vec<::rust::String> failed;
+  // One entry per failed stage, prefixed with the stage name
+  ::rust::Vec<::rust::String> errors;
+  // True if the request joined a pass another caller started
+  bool coalesced CXX_DEFAULT_VALUE(false);
+  ::std::uint64_t duration_ms CXX_DEFAULT_VALUE(0);
+
+  using IsRelocatable = ::std::true_type;
+};
+#endif // CXXBRIDGE1_STRUCT_bark_cxx$MaintenanceReport
+
+#ifndef CXXBRIDGE1_STRUCT_bark_cxx$RefreshPlanOpts
+#define CXXBRIDGE1_STRUCT_bark_cxx$RefreshPlanOpts
+struct RefreshPlanOpts final {
+  // Blocks past the first due VTXO within which others join its
+  // round, 0 for the planner default
+  ::std::uint32_t horizon_blocks CXX_DEFAULT_VALUE(0);
+  bool fold_dust CXX_DEFAULT_VALUE(false);
+  // 0 for the planner default
+  ::std::uint64_t dust_limit_sat CXX_DEFAULT_VALUE(0);
+
+  using IsRelocatable = ::std::true_type;
+};
+#endif // CXXBRIDGE1_STRUCT_bark_cxx$RefreshPlanOpts
+
+#ifndef CXXBRIDGE1_STRUCT_bark_cxx$PlannedVtxo
+#define CXXBRIDGE1_STRUCT_bark_cxx$PlannedVtxo
+struct PlannedVtxo final {
+  ::rust::String id;
+  ::std::uint64_t amount_sat CXX_DEFAULT_VALUE(0);
+  ::std::uint32_t expiry_height CXX_DEFAULT_VALUE(0);
+  // "due", "horizon" or "dust"
+  ::rust::String reason;
+
+  using IsRelocatable = ::std::true_type;
+};
+#endif // CXXBRIDGE1_STRUCT_bark_cxx$PlannedVtxo
+
+#ifndef CXXBRIDGE1_STRUCT_bark_cxx$RefreshPlan
+#define CXXBRIDGE1_STRUCT_bark_cxx$RefreshPlan
+// The next refresh round for the wallet's spendable VTXOs. `has_*`
+// flags tell whether the matching height is set.
+struct RefreshPlan final {
+  ::std::uint32_t tip CXX_DEFAULT_VALUE(0);
+  ::std::uint32_t round_blocks CXX_DEFAULT_VALUE(0);
+  bool has_refresh_by CXX_DEFAULT_VALUE(false);
+  ::std::uint32_t refresh_by CXX_DEFAULT_VALUE(0);
+  bool due_now CXX_DEFAULT_VALUE(false);
+  ::rust::Vec<::bark_cxx::PlannedVtxo> vtxos;
+  ::std::uint64_t total_sat CXX_DEFAULT_VALUE(0);
+  bool has_next_refresh_by CXX_DEFAULT_VALUE(false);
+  ::std::uint32_t next_refresh_by CXX_DEFAULT_VALUE(0);
+
+  using IsRelocatable = ::std::true_type;
+};
+#endif // CXXBRIDGE1_STRUCT_bark_cxx$RefreshPlan
+
+#ifndef CXXBRIDGE1_STRUCT_bark_cxx$WalletOpenTimings
+#define CXXBRIDGE1_STRUCT_bark_cxx$WalletOpenTimings
+struct WalletOpenTimings final {
+  // False until a wallet was opened in this process
+  bool recorded CXX_DEFAULT_VALUE(false);
+  ::std::uint64_t db_open_ms CXX_DEFAULT_VALUE(0);
+  ::std::uint64_t read_properties_ms CXX_DEFAULT_VALUE(0);
+  ::std::uint64_t seed_ms CXX_DEFAULT_VALUE(0);
+  // True if the seed was reused from an earlier open
+  bool seed_cached CXX_DEFAULT_VALUE(false);
+  ::std::uint64_t onchain_load_ms CXX_DEFAULT_VALUE(0);
+  // Opening the bark wallet, including the server handshake
+  ::std::uint64_t wallet_open_ms CXX_DEFAULT_VALUE(0);
+  ::std::uint64_t total_ms CXX_DEFAULT_VALUE(0);
+
+  using IsRelocatable = ::std::true_type;
+};
+#endif // CXXBRIDGE1_STRUCT_bark_cxx$WalletOpenTimings
+
+#ifndef CXXBRIDGE1_STRUCT_bark_cxx$LatencyHistogram
+#define CXXBRIDGE1_STRUCT_bark_cxx$LatencyHistogram
+struct LatencyHistogram final {
+  ::std::uint64_t count CXX_DEFAULT_VALUE(0);
+  ::std::uint64_t sum_us CXX_DEFAULT_VALUE(0);
+  ::std::uint64_t max_us CXX_DEFAULT_VALUE(0);
+  // Bucket `i` counts samples below 2^i microseconds, the last one
+  // everything above
+  ::rust::Vec<::std::uint64_t> buckets;
+
+  using IsRelocatable = ::std::true_type;
+};
+#endif // CXXBRIDGE1_STRUCT_bark_cxx$LatencyHistogram
+
+#ifndef CXXBRIDGE1_STRUCT_bark_cxx$CallMetrics
+#define CXXBRIDGE1_STRUCT_bark_cxx$CallMetrics
+struct CallMetrics final {
+  // Name of the bridge function
+  ::rust::String name;
+  // Time between the call and a native thread picking it up
+  ::bark_cxx::LatencyHistogram queue_wait;
+  // Time waiting for the wallet manager and the mutation lock
+  ::bark_cxx::LatencyHistogram lock_wait;
+  ::bark_cxx::LatencyHistogram execution;
+  // Native time outside Rust, mostly converting arguments and results
+  ::bark_cxx::LatencyHistogram conversion;
+
+  using IsRelocatable = ::std::true_type;
+};
+#endif // CXXBRIDGE1_STRUCT_bark_cxx$CallMetrics
+
+#ifndef CXXBRIDGE1_STRUCT_bark_cxx$SubsystemAllocStats
+#define CXXBRIDGE1_STRUCT_bark_cxx$SubsystemAllocStats
+// Memory charged to one subsystem. `allocations` counts those since
+// the last reset and is 0 for sqlite, which only reports bytes.
+struct SubsystemAllocStats final {
+  // bridge, wallet, runtime or sqlite
+  ::rust::String name;
+  ::std::uint64_t current_bytes CXX_DEFAULT_VALUE(0);
+  // Highest `current_bytes` since the last reset
+  ::std::uint64_t peak_bytes CXX_DEFAULT_VALUE(0);
+  ::std::uint64_t allocations CXX_DEFAULT_VALUE(0);
+
+  using IsRelocatable = ::std::true_type;
+};
+#endif // CXXBRIDGE1_STRUCT_bark_cxx$SubsystemAllocStats
+
+#ifndef CXXBRIDGE1_STRUCT_bark_cxx$CallAllocStats
+#define CXXBRIDGE1_STRUCT_bark_cxx$CallAllocStats
+// Allocations made by one bridge function's future since the last reset
+struct CallAllocStats final {
+  ::rust::String name;
+  ::std::uint64_t calls CXX_DEFAULT_VALUE(0);
+  ::std::uint64_t allocations CXX_DEFAULT_VALUE(0);
+  ::std::uint64_t bytes CXX_DEFAULT_VALUE(0);
+
+  using IsRelocatable = ::std::true_type;
+};
+#endif // CXXBRIDGE1_STRUCT_bark_cxx$CallAllocStats
+
+#ifndef CXXBRIDGE1_STRUCT_bark_cxx$AllocStats
+#define CXXBRIDGE1_STRUCT_bark_cxx$AllocStats
+struct AllocStats final {
+  // Whether the library was built with the `alloc-profiling` feature.
+  // Without it only the sqlite subsystem is reported.
+  bool enabled CXX_DEFAULT_VALUE(false);
+  ::rust::Vec<::bark_cxx::SubsystemAllocStats> subsystems;
+  ::rust::Vec<::bark_cxx::CallAllocStats> calls;
+
+  using IsRelocatable = ::std::true_type;
+};
+#endif // CXXBRIDGE1_STRUCT_bark_cxx$AllocStats
+
+#ifndef CXXBRIDGE1_STRUCT_bark_cxx$CallLimits
+#define CXXBRIDGE1_STRUCT_bark_cxx$CallLimits
+// Limits for a long call, 0 leaves either out. A cancelled
+// `cancel_token` or an elapsed `timeout_ms` stops the call, unless it
+// already started moving funds.
+struct CallLimits final {
+  ::std::uint64_t cancel_token CXX_DEFAULT_VALUE(0);
+  ::std::uint64_t timeout_ms CXX_DEFAULT_VALUE(0);
+
+  using IsRelocatable = ::std::true_type;
+};
+#endif // CXXBRIDGE1_STRUCT_bark_cxx$CallLimits
+
+#ifndef CXXBRIDGE1_STRUCT_bark_cxx$LogOpts
+#define CXXBRIDGE1_STRUCT_bark_cxx$LogOpts
+struct LogOpts final {
+  // env_logger style directives like "info,bark=warn". Modules
+  // without a directive use the default level when no bare level is
+  // given.
+  ::rust::String filter;
+  // Lines kept in memory for dump_logs, 0 disables the buffer
+  ::std::uint32_t ring_buffer_lines CXX_DEFAULT_VALUE(0);
+  // Most verbose level kept in the buffer, empty for debug
+  ::rust::String ring_buffer_level;
+
+  using IsRelocatable = ::std::true_type;
+};
+#endif // CXXBRIDGE1_STRUCT_bark_cxx$LogOpts
+
+#ifndef CXXBRIDGE1_STRUCT_bark_cxx$RuntimeOpts
+#define CXXBRIDGE1_STRUCT_bark_cxx$RuntimeOpts
+struct RuntimeOpts final {
+  // Worker threads, 0 for one per core
+  ::std::uint32_t worker_threads CXX_DEFAULT_VALUE(0);
+  // Run all tasks on a single runtime thread
+  bool current_thread CXX_DEFAULT_VALUE(false);
+  // Stack size of runtime threads in bytes, 0 for the default
+  ::std::uint64_t thread_stack_size CXX_DEFAULT_VALUE(0);
+  // Upper bound on threads for blocking work, 0 for the default
+  ::std::uint32_t max_blocking_threads CXX_DEFAULT_VALUE(0);
+  // Idle time before a blocking thread exits, 0 for the default
+  ::std::uint64_t blocking_keep_alive_ms CXX_DEFAULT_VALUE(0);
+
+  using IsRelocatable = ::std::true_type;
+};
+#endif // CXXBRIDGE1_STRUCT_bark_cxx$RuntimeOpts
+
+#ifndef CXXBRIDGE1_STRUCT_bark_cxx$LightningWaitResult
+#define CXXBRIDGE1_STRUCT_bark_cxx$LightningWaitResult
+struct LightningWaitResult final {
+  // Id returned when the wait was started
+  ::std::uint64_t request_id CXX_DEFAULT_VALUE(0);
+  // Empty if the wait succeeded
+  ::rust::String error;
+  // Preimage of a settled outgoing payment
+  ::rust::String preimage;
+  // Claimed incoming payment, null for outgoing payments and errors
+  ::bark_cxx::LightningReceive const *receive CXX_DEFAULT_VALUE(nullptr);
+
+  using IsRelocatable = ::std::true_type;
+};
+#endif // CXXBRIDGE1_STRUCT_bark_cxx$LightningWaitResult
+
 void init_logger() noexcept;
 
+void configure_logging(::bark_cxx::LogOpts opts);
+
+void set_log_filter(::rust::Str filter);
+
+::rust::Vec<::rust::String> dump_logs() noexcept;
+
+void clear_logs() noexcept;
+
+void configure_runtime(::bark_cxx::RuntimeOpts opts);
+
+::std::uint64_t create_cancel_token() noexcept;
+
+bool cancel_call(::std::uint64_t token) noexcept;
+
+void release_cancel_token(::std::uint64_t token) noexcept;
+
 ::rust::String create_mnemonic();
 
 bool is_wallet_loaded() noexcept;
 
+::bark_cxx::WalletOpenTimings wallet_open_timings() noexcept;
+
+void forget_cached_seed() noexcept;
+
+void set_metrics_enabled(bool enabled) noexcept;
+
+bool metrics_enabled() noexcept;
+
+::rust::Vec<::bark_cxx::CallMetrics> call_metrics() noexcept;
+
+void reset_metrics() noexcept;
+
+::bark_cxx::AllocStats alloc_stats() noexcept;
+
+void reset_alloc_stats() noexcept;
+
+void set_read_coalesce_window(::std::uint64_t window_ms) noexcept;
+
+void set_ark_info_ttl(::std::uint64_t ttl_secs) noexcept;
+
+void begin_bridge_call() noexcept;
+
+void record_bridge_timing(::std::uint64_t queue_wait_us, ::std::uint64_t total_us) noexcept;
+
 void close_wallet();
 
+void close_wallet_at(::rust::Str datadir);
+
+void select_wallet(::rust::Str datadir);
+
+::rust::Vec<::rust::String> open_wallets() noexcept;
+
 ::bark_cxx::CxxArkInfo get_ark_info();
 
 ::bark_cxx::OffchainBalance offchain_balance();
@@ -1101,24 +1624,44 @@ void close_wallet();
 
 ::bark_cxx::KeyPairResult peak_keypair(::std::uint32_t index);
 
+::rust::Vec<::bark_cxx::KeyPairResult> peak_keypairs(::std::uint32_t start, ::std::uint32_t count);
+
 ::bark_cxx::NewAddressResult new_address();
 
 ::bark_cxx::NewAddressResult peak_address(::std::uint32_t index);
 
+::rust::Vec<::bark_cxx::NewAddressResult> peak_addresses(::std::uint32_t start, ::std::uint32_t count);
+
 ::rust::String sign_message(::rust::Str message, ::std::uint32_t index);
 
 ::rust::String sign_messsage_with_mnemonic(::rust::Str message, ::rust::Str mnemonic, ::rust::Str network, ::std::uint32_t index);
 
 ::bark_cxx::KeyPairResult derive_keypair_from_mnemonic(::rust::Str mnemonic, ::rust::Str network, ::std::uint32_t index);
 
+::rust::Vec<::bark_cxx::KeyPairResult> derive_keypairs_from_mnemonic(::rust::Str mnemonic, ::rust::Str network, ::std::uint32_t start, ::std::uint32_t count);
+
 bool verify_message(::rust::Str message, ::rust::Str signature, ::rust::Str public_key);
 
 ::rust::Vec<::bark_cxx::BarkMovement> history();
 
+::bark_cxx::HistoryPage history_page(::bark_cxx::HistoryQuery query);
+
+::bark_cxx::HistoryExportProgress start_history_export(::rust::Str path, ::bark_cxx::HistoryExportOpts opts, ::bark_cxx::CallLimits limits);
+
+::bark_cxx::HistoryExportProgress advance_history_export(::std::uint64_t id);
+
+bool cancel_history_export(::std::uint64_t id) noexcept;
+
 ::rust::Vec<::bark_cxx::BarkVtxo> vtxos();
 
+::rust::Vec<::std::uint8_t> vtxos_columnar();
+
 ::rust::Vec<::bark_cxx::BarkVtxo> get_expiring_vtxos(::std::uint32_t threshold);
 
+::bark_cxx::WalletSnapshot cached_wallet_snapshot() noexcept;
+
+::bark_cxx::DashboardSnapshot dashboard_snapshot();
+
 ::std::uint32_t const *get_first_expiring_vtxo_blockheight();
 
 ::std::uint32_t const *get_next_required_refresh_blockheight();
@@ -1135,12 +1678,18 @@ void maintenance();
 
 void maintenance_delegated();
 
-void maintenance_with_onchain();
+void maintenance_with_onchain(::bark_cxx::CallLimits limits);
 
 void maintenance_with_onchain_delegated();
 
 void maintenance_refresh();
 
+::bark_cxx::MaintenanceReport maintenance_scheduled(::rust::Vec<::rust::String> force_stages);
+
+::bark_cxx::RefreshPlan plan_refresh(::bark_cxx::RefreshPlanOpts opts);
+
+::bark_cxx::RoundStatus execute_refresh_plan(::rust::Vec<::rust::String> vtxo_ids);
+
 void refresh_server();
 
 void sync();
@@ -1151,14 +1700,20 @@ void load_wallet(::rust::Str datadir, ::bark_cxx::CreateOpts config);
 
 ::bark_cxx::BoardResult board_amount(::std::uint64_t amount_sat);
 
-::bark_cxx::BoardResult board_all();
+::bark_cxx::BoardResult board_all(::bark_cxx::CallLimits limits);
+
+::bark_cxx::ParsedDestination parse_destination(::rust::Str destination, bool resolve);
 
 void validate_arkoor_address(::rust::Str address);
 
 ::bark_cxx::ArkoorPaymentResult send_arkoor_payment(::rust::Str destination, ::std::uint64_t amount_sat);
 
+::rust::Vec<::bark_cxx::ArkoorBatchResult> send_arkoor_many(::rust::Vec<::bark_cxx::SendManyOutput> outputs);
+
 ::bark_cxx::LightningSend pay_lightning_invoice(::rust::Str destination, ::std::uint64_t const *amount_sat);
 
+::rust::Vec<::bark_cxx::LightningBatchResult> pay_lightning_invoices(::rust::Vec<::bark_cxx::LightningInvoicePayment> payments);
+
 ::bark_cxx::LightningSend pay_lightning_offer(::rust::Str offer, ::std::uint64_t const *amount_sat);
 
 ::bark_cxx::LightningSend pay_lightning_address(::rust::Str addr, ::std::uint64_t amount_sat, ::rust::Str comment);
@@ -1167,24 +1722,42 @@ void validate_arkoor_address(::rust::Str address);
 
 ::rust::String offboard_specific(::rust::Vec<::rust::String> vtxo_ids, ::rust::Str destination_address);
 
-::rust::String offboard_all(::rust::Str destination_address);
+::rust::String offboard_all(::rust::Str destination_address, ::bark_cxx::CallLimits limits);
 
 ::bark_cxx::LightningReceive try_claim_lightning_receive(::rust::String payment_hash, bool wait, ::rust::String const *token);
 
 void try_claim_all_lightning_receives(bool wait);
 
-void sync_exits();
+::std::uint64_t start_check_lightning_payment(::rust::String payment_hash);
+
+::std::uint64_t start_try_claim_lightning_receive(::rust::String payment_hash, ::rust::String const *token);
+
+::std::uint32_t cancel_lightning_wait(::rust::Str payment_hash) noexcept;
+
+::rust::Vec<::bark_cxx::LightningWaitResult> wait_for_lightning_completions(::std::uint32_t timeout_ms) noexcept;
+
+void sync_exits(::bark_cxx::CallLimits limits);
 
 void sync_pending_rounds();
 
+void set_wallet_events_enabled(bool enabled) noexcept;
+
+::rust::Vec<::bark_cxx::WalletEvent> wait_for_wallet_events(::std::uint32_t timeout_ms, ::std::uint32_t batch_window_ms) noexcept;
+
 ::bark_cxx::OnChainBalance onchain_balance();
 
 void onchain_sync();
 
+::bark_cxx::OnchainSyncReport onchain_sync_incremental(bool force);
+
 ::rust::String onchain_list_unspent();
 
 ::rust::String onchain_utxos();
 
+::rust::Vec<::bark_cxx::OnchainUtxo> onchain_unspent_outputs(::bark_cxx::OnchainUtxoFilter filter);
+
+::rust::Vec<::bark_cxx::OnchainUtxo> onchain_utxo_list(::bark_cxx::OnchainUtxoFilter filter);
+
 ::rust::String onchain_address();
 
 ::bark_cxx::OnchainPaymentResult onchain_send(::rust::Str destination, ::std::uint64_t amount_sat, ::std::uint64_t const *fee_rate);
@@ -5,7 +5,6 @@ import com.facebook.react.module.annotations.ReactModule
 import com.margelo.nitro.nitroark.Bolt11InvoiceResult
 import com.margelo.nitro.nitroark.KeyPairResultAndroid
 import com.margelo.nitro.nitroark.NitroArkNative
-import com.margelo.nitro.nitroark.RoundStatusResult
 import android.util.Log
 
 @ReactModule(name = NitroArkDemoModule.NAME)
@@ -107,8 +106,8 @@ class NitroArkDemoModule(reactContext: ReactApplicationContext) :
   @ReactMethod
   fun offboardAll(destinationAddress: String, promise: Promise) {
     try {
-      val result = NitroArkNative.offboardAll(destinationAddress)
-      promise.resolve(roundStatusToMap(result))
+      val txid = NitroArkNative.offboardAll(destinationAddress)
+      promise.resolve(txid)
     } catch (e: Exception) {
       promise.reject("ERR_OFFBOARD_ALL_JNI", e)
     }
@@ -184,18 +183,6 @@ private fun ReadableMap.getBooleanOrDefault(key: String, defaultValue: Boolean):
 private fun ReadableMap.getMapOrNull(key: String): ReadableMap? =
     if (hasKey(key) && !isNull(key)) getMap(key) else null
 
-private fun roundStatusToMap(result: RoundStatusResult): WritableMap =
-    Arguments.createMap().apply {
-      putString("status", result.status)
-      if (result.fundingTxid != null) putString("funding_txid", result.fundingTxid) else putNull("funding_txid")
-      val array = Arguments.createArray()
-      result.unsignedFundingTxids.forEach { array.pushString(it) }
-      putArray("unsigned_funding_txids", array)
-      if (result.error != null) putString("error", result.error) else putNull("error")
-      putBoolean("is_final", result.isFinal)
-      putBoolean("is_success", result.isSuccess)
-    }
-
 private fun keyPairToMap(result: KeyPairResultAndroid): WritableMap =
     Arguments.createMap().apply {
       putString("public_key", result.publicKey)
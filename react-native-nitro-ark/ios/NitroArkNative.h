@@ -0,0 +1,159 @@
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Error domain for failures reported by the bark wallet.
+FOUNDATION_EXPORT NSErrorDomain const NitroArkNativeErrorDomain;
+
+/// Optional config overrides for `loadWallet`, mirroring the Android
+/// `NitroArkNative.AndroidBarkConfig`.
+@interface NitroArkNativeConfig : NSObject
+@property(nonatomic, copy, nullable) NSString* ark;
+@property(nonatomic, copy, nullable) NSString* esplora;
+@property(nonatomic, copy, nullable) NSString* bitcoind;
+@property(nonatomic, copy, nullable) NSString* bitcoindCookie;
+@property(nonatomic, copy, nullable) NSString* bitcoindUser;
+@property(nonatomic, copy, nullable) NSString* bitcoindPass;
+@property(nonatomic, strong, nullable) NSNumber* vtxoRefreshExpiryThreshold;
+@property(nonatomic, strong, nullable) NSNumber* fallbackFeeRate;
+@property(nonatomic, strong, nullable) NSNumber* htlcRecvClaimDelta;
+@property(nonatomic, strong, nullable) NSNumber* vtxoExitMargin;
+@property(nonatomic, strong, nullable) NSNumber* roundTxRequiredConfirmations;
+@end
+
+@interface NitroArkOffchainBalance : NSObject
+@property(nonatomic, readonly) uint64_t spendable;
+@property(nonatomic, readonly) uint64_t pendingLightningSend;
+@property(nonatomic, readonly) uint64_t pendingInRound;
+@property(nonatomic, readonly) uint64_t pendingExit;
+@property(nonatomic, readonly) uint64_t pendingBoard;
+@end
+
+@interface NitroArkOnchainBalance : NSObject
+@property(nonatomic, readonly) uint64_t immature;
+@property(nonatomic, readonly) uint64_t trustedPending;
+@property(nonatomic, readonly) uint64_t untrustedPending;
+@property(nonatomic, readonly) uint64_t confirmed;
+@end
+
+@interface NitroArkVtxo : NSObject
+@property(nonatomic, readonly) uint64_t amount;
+@property(nonatomic, readonly) uint32_t expiryHeight;
+@property(nonatomic, readonly, copy) NSString* serverPubkey;
+@property(nonatomic, readonly) uint16_t exitDelta;
+@property(nonatomic, readonly, copy) NSString* anchorPoint;
+@property(nonatomic, readonly, copy) NSString* point;
+@property(nonatomic, readonly, copy) NSString* state;
+@end
+
+@interface NitroArkMovementDestination : NSObject
+@property(nonatomic, readonly, copy) NSString* destination;
+@property(nonatomic, readonly, copy) NSString* paymentMethod;
+@property(nonatomic, readonly) uint64_t amountSat;
+@end
+
+@interface NitroArkMovement : NSObject
+@property(nonatomic, readonly) uint32_t movementId;
+@property(nonatomic, readonly, copy) NSString* status;
+@property(nonatomic, readonly, copy) NSString* subsystemName;
+@property(nonatomic, readonly, copy) NSString* subsystemKind;
+@property(nonatomic, readonly, copy) NSString* metadataJson;
+@property(nonatomic, readonly) int64_t intendedBalanceSat;
+@property(nonatomic, readonly) int64_t effectiveBalanceSat;
+@property(nonatomic, readonly) uint64_t offchainFeeSat;
+@property(nonatomic, readonly, copy) NSArray<NitroArkMovementDestination*>* sentTo;
+@property(nonatomic, readonly, copy) NSArray<NitroArkMovementDestination*>* receivedOn;
+@property(nonatomic, readonly, copy) NSArray<NSString*>* inputVtxos;
+@property(nonatomic, readonly, copy) NSArray<NSString*>* outputVtxos;
+@property(nonatomic, readonly, copy) NSArray<NSString*>* exitedVtxos;
+@property(nonatomic, readonly, copy) NSString* createdAt;
+@property(nonatomic, readonly, copy) NSString* updatedAt;
+@property(nonatomic, readonly, copy, nullable) NSString* completedAt;
+@end
+
+@interface NitroArkKeyPair : NSObject
+@property(nonatomic, readonly, copy) NSString* publicKey;
+@property(nonatomic, readonly, copy) NSString* secretKey;
+@end
+
+@interface NitroArkBolt11Invoice : NSObject
+@property(nonatomic, readonly, copy) NSString* bolt11Invoice;
+@property(nonatomic, readonly, copy) NSString* paymentSecret;
+@property(nonatomic, readonly, copy) NSString* paymentHash;
+@end
+
+/// Direct entry points into the bark wallet for code that runs without a JS
+/// runtime, such as BGAppRefreshTask handlers and notification service
+/// extensions. Mirrors the Android `NitroArkNative` facade.
+///
+/// Every call blocks until the wallet operation finished, so call these off
+/// the main thread. Failures are reported through `error`, which Swift
+/// surfaces as a thrown error.
+@interface NitroArkNative : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Size the native runtime before the first wallet call. Extensions can use a
+/// single runtime thread instead of one worker per core. Zero keeps the
+/// default.
++ (BOOL)configureRuntimeWithWorkerThreads:(uint32_t)workerThreads
+                            currentThread:(BOOL)currentThread
+                          threadStackSize:(uint64_t)threadStackSize
+                       maxBlockingThreads:(uint32_t)maxBlockingThreads
+                      blockingKeepAliveMs:(uint64_t)blockingKeepAliveMs
+                                    error:(NSError**)error;
+
++ (BOOL)isWalletLoaded;
++ (BOOL)closeWallet:(NSError**)error;
+
+/// Load an existing wallet using optional chain/config overrides.
++ (BOOL)loadWalletWithDatadir:(NSString*)datadir
+                     mnemonic:(NSString*)mnemonic
+                      regtest:(BOOL)regtest
+                       signet:(BOOL)signet
+                      bitcoin:(BOOL)bitcoin
+               birthdayHeight:(nullable NSNumber*)birthdayHeight
+                       config:(nullable NitroArkNativeConfig*)config
+                        error:(NSError**)error;
+
+// Maintenance and sync
++ (BOOL)maintenance:(NSError**)error;
++ (BOOL)maintenanceDelegated:(NSError**)error;
++ (BOOL)maintenanceWithOnchain:(NSError**)error;
++ (BOOL)maintenanceWithOnchainDelegated:(NSError**)error;
++ (BOOL)maintenanceRefresh:(NSError**)error;
++ (BOOL)sync:(NSError**)error;
++ (BOOL)onchainSync:(NSError**)error;
+
+// Balances and wallet state
++ (nullable NitroArkOffchainBalance*)offchainBalance:(NSError**)error;
++ (nullable NitroArkOnchainBalance*)onchainBalance:(NSError**)error;
++ (nullable NSArray<NitroArkVtxo*>*)vtxos:(NSError**)error;
++ (nullable NSArray<NitroArkVtxo*>*)getExpiringVtxos:(uint32_t)threshold error:(NSError**)error;
++ (nullable NSArray<NitroArkMovement*>*)history:(NSError**)error;
+
+// Lightning
++ (BOOL)tryClaimLightningReceive:(NSString*)paymentHash
+                            wait:(BOOL)wait
+                           token:(nullable NSString*)token
+                           error:(NSError**)error;
++ (BOOL)tryClaimAllLightningReceives:(BOOL)wait error:(NSError**)error;
++ (nullable NitroArkBolt11Invoice*)bolt11Invoice:(uint64_t)amountMsat error:(NSError**)error;
+
+/// Offboard funds to an onchain address. Returns the offboard transaction id.
++ (nullable NSString*)offboardAll:(NSString*)destinationAddress error:(NSError**)error;
++ (nullable NSString*)offboardSpecific:(NSArray<NSString*>*)vtxoIds
+                    destinationAddress:(NSString*)destinationAddress
+                                 error:(NSError**)error;
+
+// Keys and signing
++ (nullable NitroArkKeyPair*)peakKeyPair:(uint32_t)index error:(NSError**)error;
++ (BOOL)verifyMessage:(NSString*)message
+            signature:(NSString*)signature
+            publicKey:(NSString*)publicKey
+                error:(NSError**)error __attribute__((swift_error(nonnull_error)));
++ (nullable NSString*)signMessage:(NSString*)message index:(uint32_t)index error:(NSError**)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,398 @@
+#import "NitroArkNative.h"
+
+#include <exception>
+#include <string>
+#include <utility>
+
+#include "../cpp/generated/ark_cxx.h"
+
+NSErrorDomain const NitroArkNativeErrorDomain = @"NitroArkNativeErrorDomain";
+
+namespace {
+
+NSString* ToNSString(const rust::String& value) {
+  return [[NSString alloc] initWithBytes:value.data() length:value.length() encoding:NSUTF8StringEncoding];
+}
+
+// Returns nil for an empty string, which the bridge uses for absent values.
+NSString* ToOptionalNSString(const rust::String& value) {
+  return value.length() == 0 ? nil : ToNSString(value);
+}
+
+std::string ToStdString(NSString* value) {
+  return value == nil ? std::string() : std::string(value.UTF8String);
+}
+
+NSArray<NSString*>* ToStringArray(const rust::Vec<rust::String>& values) {
+  NSMutableArray<NSString*>* result = [NSMutableArray arrayWithCapacity:values.size()];
+  for (const auto& value : values) {
+    [result addObject:ToNSString(value)];
+  }
+  return result;
+}
+
+void SetError(NSError** error, const char* message) {
+  if (error != nullptr) {
+    *error = [NSError errorWithDomain:NitroArkNativeErrorDomain
+                                 code:1
+                             userInfo:@{NSLocalizedDescriptionKey : @(message)}];
+  }
+}
+
+// Runs a bridge call, translating a thrown rust::Error into `error`.
+template <typename F> BOOL RunVoid(NSError** error, F&& body) {
+  try {
+    body();
+    return YES;
+  } catch (const std::exception& e) {
+    SetError(error, e.what());
+  } catch (...) {
+    SetError(error, "Unknown exception in NitroArk native call.");
+  }
+  return NO;
+}
+
+template <typename F> id RunObject(NSError** error, F&& body) {
+  try {
+    return body();
+  } catch (const std::exception& e) {
+    SetError(error, e.what());
+  } catch (...) {
+    SetError(error, "Unknown exception in NitroArk native call.");
+  }
+  return nil;
+}
+
+} // namespace
+
+@implementation NitroArkNativeConfig
+@end
+
+@interface NitroArkOffchainBalance ()
+- (instancetype)initWithBalance:(const bark_cxx::OffchainBalance&)balance;
+@end
+
+@implementation NitroArkOffchainBalance
+- (instancetype)initWithBalance:(const bark_cxx::OffchainBalance&)balance {
+  if ((self = [super init])) {
+    _spendable = balance.spendable;
+    _pendingLightningSend = balance.pending_lightning_send;
+    _pendingInRound = balance.pending_in_round;
+    _pendingExit = balance.pending_exit;
+    _pendingBoard = balance.pending_board;
+  }
+  return self;
+}
+@end
+
+@interface NitroArkOnchainBalance ()
+- (instancetype)initWithBalance:(const bark_cxx::OnChainBalance&)balance;
+@end
+
+@implementation NitroArkOnchainBalance
+- (instancetype)initWithBalance:(const bark_cxx::OnChainBalance&)balance {
+  if ((self = [super init])) {
+    _immature = balance.immature;
+    _trustedPending = balance.trusted_pending;
+    _untrustedPending = balance.untrusted_pending;
+    _confirmed = balance.confirmed;
+  }
+  return self;
+}
+@end
+
+@interface NitroArkVtxo ()
+- (instancetype)initWithVtxo:(const bark_cxx::BarkVtxo&)vtxo;
+@end
+
+@implementation NitroArkVtxo
+- (instancetype)initWithVtxo:(const bark_cxx::BarkVtxo&)vtxo {
+  if ((self = [super init])) {
+    _amount = vtxo.amount;
+    _expiryHeight = vtxo.expiry_height;
+    _serverPubkey = ToNSString(vtxo.server_pubkey);
+    _exitDelta = vtxo.exit_delta;
+    _anchorPoint = ToNSString(vtxo.anchor_point);
+    _point = ToNSString(vtxo.point);
+    _state = ToNSString(vtxo.state);
+  }
+  return self;
+}
+@end
+
+@interface NitroArkMovementDestination ()
+- (instancetype)initWithDestination:(const bark_cxx::BarkMovementDestination&)destination;
+@end
+
+@implementation NitroArkMovementDestination
+- (instancetype)initWithDestination:(const bark_cxx::BarkMovementDestination&)destination {
+  if ((self = [super init])) {
+    _destination = ToNSString(destination.destination);
+    _paymentMethod = ToNSString(destination.payment_method);
+    _amountSat = destination.amount_sat;
+  }
+  return self;
+}
+@end
+
+namespace {
+
+NSArray<NitroArkVtxo*>* ToVtxoArray(const rust::Vec<bark_cxx::BarkVtxo>& vtxos) {
+  NSMutableArray<NitroArkVtxo*>* result = [NSMutableArray arrayWithCapacity:vtxos.size()];
+  for (const auto& vtxo : vtxos) {
+    [result addObject:[[NitroArkVtxo alloc] initWithVtxo:vtxo]];
+  }
+  return result;
+}
+
+NSArray<NitroArkMovementDestination*>*
+ToDestinationArray(const rust::Vec<bark_cxx::BarkMovementDestination>& destinations) {
+  NSMutableArray<NitroArkMovementDestination*>* result = [NSMutableArray arrayWithCapacity:destinations.size()];
+  for (const auto& destination : destinations) {
+    [result addObject:[[NitroArkMovementDestination alloc] initWithDestination:destination]];
+  }
+  return result;
+}
+
+} // namespace
+
+@interface NitroArkMovement ()
+- (instancetype)initWithMovement:(const bark_cxx::BarkMovement&)movement;
+@end
+
+@implementation NitroArkMovement
+- (instancetype)initWithMovement:(const bark_cxx::BarkMovement&)movement {
+  if ((self = [super init])) {
+    _movementId = movement.id;
+    _status = ToNSString(movement.status);
+    _subsystemName = ToNSString(movement.subsystem_name);
+    _subsystemKind = ToNSString(movement.subsystem_kind);
+    _metadataJson = ToNSString(movement.metadata_json);
+    _intendedBalanceSat = movement.intended_balance_sat;
+    _effectiveBalanceSat = movement.effective_balance_sat;
+    _offchainFeeSat = movement.offchain_fee_sat;
+    _sentTo = ToDestinationArray(movement.sent_to);
+    _receivedOn = ToDestinationArray(movement.received_on);
+    _inputVtxos = ToStringArray(movement.input_vtxos);
+    _outputVtxos = ToStringArray(movement.output_vtxos);
+    _exitedVtxos = ToStringArray(movement.exited_vtxos);
+    _createdAt = ToNSString(movement.created_at);
+    _updatedAt = ToNSString(movement.updated_at);
+    _completedAt = ToOptionalNSString(movement.completed_at);
+  }
+  return self;
+}
+@end
+
+@interface NitroArkKeyPair ()
+- (instancetype)initWithKeyPair:(const bark_cxx::KeyPairResult&)keypair;
+@end
+
+@implementation NitroArkKeyPair
+- (instancetype)initWithKeyPair:(const bark_cxx::KeyPairResult&)keypair {
+  if ((self = [super init])) {
+    _publicKey = ToNSString(keypair.public_key);
+    _secretKey = ToNSString(keypair.secret_key);
+  }
+  return self;
+}
+@end
+
+@interface NitroArkBolt11Invoice ()
+- (instancetype)initWithInvoice:(const bark_cxx::Bolt11Invoice&)invoice;
+@end
+
+@implementation NitroArkBolt11Invoice
+- (instancetype)initWithInvoice:(const bark_cxx::Bolt11Invoice&)invoice {
+  if ((self = [super init])) {
+    _bolt11Invoice = ToNSString(invoice.bolt11_invoice);
+    _paymentSecret = ToNSString(invoice.payment_secret);
+    _paymentHash = ToNSString(invoice.payment_hash);
+  }
+  return self;
+}
+@end
+
+@implementation NitroArkNative
+
++ (BOOL)configureRuntimeWithWorkerThreads:(uint32_t)workerThreads
+                            currentThread:(BOOL)currentThread
+                          threadStackSize:(uint64_t)threadStackSize
+                       maxBlockingThreads:(uint32_t)maxBlockingThreads
+                      blockingKeepAliveMs:(uint64_t)blockingKeepAliveMs
+                                    error:(NSError**)error {
+  return RunVoid(error, [&] {
+    bark_cxx::RuntimeOpts opts{};
+    opts.worker_threads = workerThreads;
+    opts.current_thread = currentThread;
+    opts.thread_stack_size = threadStackSize;
+    opts.max_blocking_threads = maxBlockingThreads;
+    opts.blocking_keep_alive_ms = blockingKeepAliveMs;
+    bark_cxx::configure_runtime(opts);
+  });
+}
+
++ (BOOL)isWalletLoaded {
+  return bark_cxx::is_wallet_loaded();
+}
+
++ (BOOL)closeWallet:(NSError**)error {
+  return RunVoid(error, [] { bark_cxx::close_wallet(); });
+}
+
++ (BOOL)loadWalletWithDatadir:(NSString*)datadir
+                     mnemonic:(NSString*)mnemonic
+                      regtest:(BOOL)regtest
+                       signet:(BOOL)signet
+                      bitcoin:(BOOL)bitcoin
+               birthdayHeight:(NSNumber*)birthdayHeight
+                       config:(NitroArkNativeConfig*)config
+                        error:(NSError**)error {
+  return RunVoid(error, [&] {
+    bark_cxx::CreateOpts opts{};
+    opts.regtest = regtest;
+    opts.signet = signet;
+    opts.bitcoin = bitcoin;
+    opts.mnemonic = ToStdString(mnemonic);
+
+    uint32_t birthday_height_val = 0;
+    if (birthdayHeight != nil) {
+      birthday_height_val = birthdayHeight.unsignedIntValue;
+      opts.birthday_height = &birthday_height_val;
+    } else {
+      opts.birthday_height = nullptr;
+    }
+
+    bark_cxx::ConfigOpts configOpts{};
+    configOpts.ark = ToStdString(config.ark);
+    configOpts.esplora = ToStdString(config.esplora);
+    configOpts.bitcoind = ToStdString(config.bitcoind);
+    configOpts.bitcoind_cookie = ToStdString(config.bitcoindCookie);
+    configOpts.bitcoind_user = ToStdString(config.bitcoindUser);
+    configOpts.bitcoind_pass = ToStdString(config.bitcoindPass);
+    configOpts.vtxo_refresh_expiry_threshold = config.vtxoRefreshExpiryThreshold.unsignedIntValue;
+    configOpts.fallback_fee_rate = config.fallbackFeeRate.unsignedLongLongValue;
+    configOpts.htlc_recv_claim_delta = config.htlcRecvClaimDelta.unsignedShortValue;
+    configOpts.vtxo_exit_margin = config.vtxoExitMargin.unsignedShortValue;
+    configOpts.round_tx_required_confirmations = config.roundTxRequiredConfirmations.unsignedIntValue;
+    opts.config = configOpts;
+
+    bark_cxx::load_wallet(ToStdString(datadir), opts);
+  });
+}
+
++ (BOOL)maintenance:(NSError**)error {
+  return RunVoid(error, [] { bark_cxx::maintenance(); });
+}
+
++ (BOOL)maintenanceDelegated:(NSError**)error {
+  return RunVoid(error, [] { bark_cxx::maintenance_delegated(); });
+}
+
++ (BOOL)maintenanceWithOnchain:(NSError**)error {
+  return RunVoid(error, [] { bark_cxx::maintenance_with_onchain(bark_cxx::CallLimits{}); });
+}
+
++ (BOOL)maintenanceWithOnchainDelegated:(NSError**)error {
+  return RunVoid(error, [] { bark_cxx::maintenance_with_onchain_delegated(); });
+}
+
++ (BOOL)maintenanceRefresh:(NSError**)error {
+  return RunVoid(error, [] { bark_cxx::maintenance_refresh(); });
+}
+
++ (BOOL)sync:(NSError**)error {
+  return RunVoid(error, [] { bark_cxx::sync(); });
+}
+
++ (BOOL)onchainSync:(NSError**)error {
+  return RunVoid(error, [] { bark_cxx::onchain_sync(); });
+}
+
++ (NitroArkOffchainBalance*)offchainBalance:(NSError**)error {
+  return RunObject(error,
+                   [] { return [[NitroArkOffchainBalance alloc] initWithBalance:bark_cxx::offchain_balance()]; });
+}
+
++ (NitroArkOnchainBalance*)onchainBalance:(NSError**)error {
+  return RunObject(error, [] { return [[NitroArkOnchainBalance alloc] initWithBalance:bark_cxx::onchain_balance()]; });
+}
+
++ (NSArray<NitroArkVtxo*>*)vtxos:(NSError**)error {
+  return RunObject(error, [] { return ToVtxoArray(bark_cxx::vtxos()); });
+}
+
++ (NSArray<NitroArkVtxo*>*)getExpiringVtxos:(uint32_t)threshold error:(NSError**)error {
+  return RunObject(error, [&] { return ToVtxoArray(bark_cxx::get_expiring_vtxos(threshold)); });
+}
+
++ (NSArray<NitroArkMovement*>*)history:(NSError**)error {
+  return RunObject(error, [] {
+    rust::Vec<bark_cxx::BarkMovement> movements = bark_cxx::history();
+    NSMutableArray<NitroArkMovement*>* result = [NSMutableArray arrayWithCapacity:movements.size()];
+    for (const auto& movement : movements) {
+      [result addObject:[[NitroArkMovement alloc] initWithMovement:movement]];
+    }
+    return result;
+  });
+}
+
++ (BOOL)tryClaimLightningReceive:(NSString*)paymentHash
+                            wait:(BOOL)wait
+                           token:(NSString*)token
+                           error:(NSError**)error {
+  return RunVoid(error, [&] {
+    rust::String payment_hash_rs(ToStdString(paymentHash));
+    rust::String token_rs(ToStdString(token));
+    const rust::String* token_ptr = token.length == 0 ? nullptr : &token_rs;
+    bark_cxx::try_claim_lightning_receive(payment_hash_rs, wait, token_ptr);
+  });
+}
+
++ (BOOL)tryClaimAllLightningReceives:(BOOL)wait error:(NSError**)error {
+  return RunVoid(error, [&] { bark_cxx::try_claim_all_lightning_receives(wait); });
+}
+
++ (NitroArkBolt11Invoice*)bolt11Invoice:(uint64_t)amountMsat error:(NSError**)error {
+  return RunObject(error, [&] {
+    return [[NitroArkBolt11Invoice alloc] initWithInvoice:bark_cxx::bolt11_invoice(amountMsat)];
+  });
+}
+
++ (NSString*)offboardAll:(NSString*)destinationAddress error:(NSError**)error {
+  return RunObject(error, [&] { return ToNSString(bark_cxx::offboard_all(ToStdString(destinationAddress), bark_cxx::CallLimits{})); });
+}
+
++ (NSString*)offboardSpecific:(NSArray<NSString*>*)vtxoIds
+           destinationAddress:(NSString*)destinationAddress
+                        error:(NSError**)error {
+  return RunObject(error, [&] {
+    rust::Vec<rust::String> vtxo_ids;
+    vtxo_ids.reserve(vtxoIds.count);
+    for (NSString* vtxoId in vtxoIds) {
+      vtxo_ids.push_back(rust::String(ToStdString(vtxoId)));
+    }
+    return ToNSString(bark_cxx::offboard_specific(std::move(vtxo_ids), ToStdString(destinationAddress)));
+  });
+}
+
++ (NitroArkKeyPair*)peakKeyPair:(uint32_t)index error:(NSError**)error {
+  return RunObject(error, [&] { return [[NitroArkKeyPair alloc] initWithKeyPair:bark_cxx::peak_keypair(index)]; });
+}
+
++ (BOOL)verifyMessage:(NSString*)message
+            signature:(NSString*)signature
+            publicKey:(NSString*)publicKey
+                error:(NSError**)error {
+  BOOL valid = NO;
+  RunVoid(error, [&] {
+    valid = bark_cxx::verify_message(ToStdString(message), ToStdString(signature), ToStdString(publicKey));
+  });
+  return valid;
+}
+
++ (NSString*)signMessage:(NSString*)message index:(uint32_t)index error:(NSError**)error {
+  return RunObject(error, [&] { return ToNSString(bark_cxx::sign_message(ToStdString(message), index)); });
+}
+
+@end
@@ -0,0 +1,99 @@
+///
+/// ArkoorBatchResult.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `BarkVtxo` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkVtxo; }
+
+#include <string>
+#include "BarkVtxo.hpp"
+#include <vector>
+#include <optional>
+
+namespace margelo::nitro::nitroark {
+
+  /**
+   * A struct which can be represented as a JavaScript object (ArkoorBatchResult).
+   */
+  struct ArkoorBatchResult final {
+  public:
+    std::string destination     SWIFT_PRIVATE;
+    double amount_sat     SWIFT_PRIVATE;
+    std::vector<BarkVtxo> vtxos     SWIFT_PRIVATE;
+    std::optional<std::string> error     SWIFT_PRIVATE;
+
+  public:
+    ArkoorBatchResult() = default;
+    explicit ArkoorBatchResult(std::string destination, double amount_sat, std::vector<BarkVtxo> vtxos, std::optional<std::string> error): destination(destination), amount_sat(amount_sat), vtxos(vtxos), error(error) {}
+
+  public:
+    friend bool operator==(const ArkoorBatchResult& lhs, const ArkoorBatchResult& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroark
+
+namespace margelo::nitro {
+
+  // C++ ArkoorBatchResult <> JS ArkoorBatchResult (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroark::ArkoorBatchResult> final {
+    static inline margelo::nitro::nitroark::ArkoorBatchResult fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroark::ArkoorBatchResult(
+        JSIConverter<std::string>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "destination"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "amount_sat"))),
+        JSIConverter<std::vector<margelo::nitro::nitroark::BarkVtxo>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "vtxos"))),
+        JSIConverter<std::optional<std::string>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "error")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroark::ArkoorBatchResult& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "destination"), JSIConverter<std::string>::toJSI(runtime, arg.destination));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "amount_sat"), JSIConverter<double>::toJSI(runtime, arg.amount_sat));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "vtxos"), JSIConverter<std::vector<margelo::nitro::nitroark::BarkVtxo>>::toJSI(runtime, arg.vtxos));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "error"), JSIConverter<std::optional<std::string>>::toJSI(runtime, arg.error));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<std::string>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "destination")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "amount_sat")))) return false;
+      if (!JSIConverter<std::vector<margelo::nitro::nitroark::BarkVtxo>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "vtxos")))) return false;
+      if (!JSIConverter<std::optional<std::string>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "error")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,96 @@
+///
+/// BarkAllocStats.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `BarkSubsystemAllocStats` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkSubsystemAllocStats; }
+// Forward declaration of `BarkCallAllocStats` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkCallAllocStats; }
+
+#include "BarkSubsystemAllocStats.hpp"
+#include <vector>
+#include "BarkCallAllocStats.hpp"
+
+namespace margelo::nitro::nitroark {
+
+  /**
+   * A struct which can be represented as a JavaScript object (BarkAllocStats).
+   */
+  struct BarkAllocStats final {
+  public:
+    bool enabled     SWIFT_PRIVATE;
+    std::vector<BarkSubsystemAllocStats> subsystems     SWIFT_PRIVATE;
+    std::vector<BarkCallAllocStats> calls     SWIFT_PRIVATE;
+
+  public:
+    BarkAllocStats() = default;
+    explicit BarkAllocStats(bool enabled, std::vector<BarkSubsystemAllocStats> subsystems, std::vector<BarkCallAllocStats> calls): enabled(enabled), subsystems(subsystems), calls(calls) {}
+
+  public:
+    friend bool operator==(const BarkAllocStats& lhs, const BarkAllocStats& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroark
+
+namespace margelo::nitro {
+
+  // C++ BarkAllocStats <> JS BarkAllocStats (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroark::BarkAllocStats> final {
+    static inline margelo::nitro::nitroark::BarkAllocStats fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroark::BarkAllocStats(
+        JSIConverter<bool>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "enabled"))),
+        JSIConverter<std::vector<margelo::nitro::nitroark::BarkSubsystemAllocStats>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "subsystems"))),
+        JSIConverter<std::vector<margelo::nitro::nitroark::BarkCallAllocStats>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "calls")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroark::BarkAllocStats& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "enabled"), JSIConverter<bool>::toJSI(runtime, arg.enabled));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "subsystems"), JSIConverter<std::vector<margelo::nitro::nitroark::BarkSubsystemAllocStats>>::toJSI(runtime, arg.subsystems));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "calls"), JSIConverter<std::vector<margelo::nitro::nitroark::BarkCallAllocStats>>::toJSI(runtime, arg.calls));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<bool>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "enabled")))) return false;
+      if (!JSIConverter<std::vector<margelo::nitro::nitroark::BarkSubsystemAllocStats>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "subsystems")))) return false;
+      if (!JSIConverter<std::vector<margelo::nitro::nitroark::BarkCallAllocStats>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "calls")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,95 @@
+///
+/// BarkCallAllocStats.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <string>
+
+namespace margelo::nitro::nitroark {
+
+  /**
+   * A struct which can be represented as a JavaScript object (BarkCallAllocStats).
+   */
+  struct BarkCallAllocStats final {
+  public:
+    std::string name     SWIFT_PRIVATE;
+    double calls     SWIFT_PRIVATE;
+    double allocations     SWIFT_PRIVATE;
+    double bytes     SWIFT_PRIVATE;
+
+  public:
+    BarkCallAllocStats() = default;
+    explicit BarkCallAllocStats(std::string name, double calls, double allocations, double bytes): name(name), calls(calls), allocations(allocations), bytes(bytes) {}
+
+  public:
+    friend bool operator==(const BarkCallAllocStats& lhs, const BarkCallAllocStats& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroark
+
+namespace margelo::nitro {
+
+  // C++ BarkCallAllocStats <> JS BarkCallAllocStats (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroark::BarkCallAllocStats> final {
+    static inline margelo::nitro::nitroark::BarkCallAllocStats fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroark::BarkCallAllocStats(
+        JSIConverter<std::string>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "name"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "calls"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "allocations"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "bytes")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroark::BarkCallAllocStats& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "name"), JSIConverter<std::string>::toJSI(runtime, arg.name));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "calls"), JSIConverter<double>::toJSI(runtime, arg.calls));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "allocations"), JSIConverter<double>::toJSI(runtime, arg.allocations));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "bytes"), JSIConverter<double>::toJSI(runtime, arg.bytes));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<std::string>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "name")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "calls")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "allocations")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "bytes")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,101 @@
+///
+/// BarkCallMetrics.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `BarkLatencyHistogram` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkLatencyHistogram; }
+
+#include <string>
+#include "BarkLatencyHistogram.hpp"
+
+namespace margelo::nitro::nitroark {
+
+  /**
+   * A struct which can be represented as a JavaScript object (BarkCallMetrics).
+   */
+  struct BarkCallMetrics final {
+  public:
+    std::string name     SWIFT_PRIVATE;
+    BarkLatencyHistogram queue_wait     SWIFT_PRIVATE;
+    BarkLatencyHistogram lock_wait     SWIFT_PRIVATE;
+    BarkLatencyHistogram execution     SWIFT_PRIVATE;
+    BarkLatencyHistogram conversion     SWIFT_PRIVATE;
+
+  public:
+    BarkCallMetrics() = default;
+    explicit BarkCallMetrics(std::string name, BarkLatencyHistogram queue_wait, BarkLatencyHistogram lock_wait, BarkLatencyHistogram execution, BarkLatencyHistogram conversion): name(name), queue_wait(queue_wait), lock_wait(lock_wait), execution(execution), conversion(conversion) {}
+
+  public:
+    friend bool operator==(const BarkCallMetrics& lhs, const BarkCallMetrics& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroark
+
+namespace margelo::nitro {
+
+  // C++ BarkCallMetrics <> JS BarkCallMetrics (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroark::BarkCallMetrics> final {
+    static inline margelo::nitro::nitroark::BarkCallMetrics fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroark::BarkCallMetrics(
+        JSIConverter<std::string>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "name"))),
+        JSIConverter<margelo::nitro::nitroark::BarkLatencyHistogram>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "queue_wait"))),
+        JSIConverter<margelo::nitro::nitroark::BarkLatencyHistogram>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "lock_wait"))),
+        JSIConverter<margelo::nitro::nitroark::BarkLatencyHistogram>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "execution"))),
+        JSIConverter<margelo::nitro::nitroark::BarkLatencyHistogram>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "conversion")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroark::BarkCallMetrics& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "name"), JSIConverter<std::string>::toJSI(runtime, arg.name));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "queue_wait"), JSIConverter<margelo::nitro::nitroark::BarkLatencyHistogram>::toJSI(runtime, arg.queue_wait));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "lock_wait"), JSIConverter<margelo::nitro::nitroark::BarkLatencyHistogram>::toJSI(runtime, arg.lock_wait));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "execution"), JSIConverter<margelo::nitro::nitroark::BarkLatencyHistogram>::toJSI(runtime, arg.execution));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "conversion"), JSIConverter<margelo::nitro::nitroark::BarkLatencyHistogram>::toJSI(runtime, arg.conversion));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<std::string>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "name")))) return false;
+      if (!JSIConverter<margelo::nitro::nitroark::BarkLatencyHistogram>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "queue_wait")))) return false;
+      if (!JSIConverter<margelo::nitro::nitroark::BarkLatencyHistogram>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "lock_wait")))) return false;
+      if (!JSIConverter<margelo::nitro::nitroark::BarkLatencyHistogram>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "execution")))) return false;
+      if (!JSIConverter<margelo::nitro::nitroark::BarkLatencyHistogram>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "conversion")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,87 @@
+///
+/// BarkCallOpts.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <optional>
+
+namespace margelo::nitro::nitroark {
+
+  /**
+   * A struct which can be represented as a JavaScript object (BarkCallOpts).
+   */
+  struct BarkCallOpts final {
+  public:
+    std::optional<double> cancel_token     SWIFT_PRIVATE;
+    std::optional<double> timeout_ms     SWIFT_PRIVATE;
+
+  public:
+    BarkCallOpts() = default;
+    explicit BarkCallOpts(std::optional<double> cancel_token, std::optional<double> timeout_ms): cancel_token(cancel_token), timeout_ms(timeout_ms) {}
+
+  public:
+    friend bool operator==(const BarkCallOpts& lhs, const BarkCallOpts& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroark
+
+namespace margelo::nitro {
+
+  // C++ BarkCallOpts <> JS BarkCallOpts (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroark::BarkCallOpts> final {
+    static inline margelo::nitro::nitroark::BarkCallOpts fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroark::BarkCallOpts(
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "cancel_token"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "timeout_ms")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroark::BarkCallOpts& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "cancel_token"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.cancel_token));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "timeout_ms"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.timeout_ms));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "cancel_token")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "timeout_ms")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
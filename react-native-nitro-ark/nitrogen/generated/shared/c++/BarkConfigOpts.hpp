@@ -28,10 +28,12 @@
 #error NitroModules cannot be found! Are you sure you installed NitroModules properly?
 #endif
 
-
+// Forward declaration of `BarkStorageOpts` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkStorageOpts; }
 
 #include <string>
 #include <optional>
+#include "BarkStorageOpts.hpp"
 
 namespace margelo::nitro::nitroark {
 
@@ -51,10 +53,11 @@ namespace margelo::nitro::nitroark {
     double htlc_recv_claim_delta     SWIFT_PRIVATE;
     double vtxo_exit_margin     SWIFT_PRIVATE;
     double round_tx_required_confirmations     SWIFT_PRIVATE;
+    std::optional<BarkStorageOpts> storage     SWIFT_PRIVATE;
 
   public:
     BarkConfigOpts() = default;
-    explicit BarkConfigOpts(std::optional<std::string> ark, std::optional<std::string> esplora, std::optional<std::string> bitcoind, std::optional<std::string> bitcoind_cookie, std::optional<std::string> bitcoind_user, std::optional<std::string> bitcoind_pass, std::optional<double> vtxo_refresh_expiry_threshold, std::optional<double> fallback_fee_rate, double htlc_recv_claim_delta, double vtxo_exit_margin, double round_tx_required_confirmations): ark(ark), esplora(esplora), bitcoind(bitcoind), bitcoind_cookie(bitcoind_cookie), bitcoind_user(bitcoind_user), bitcoind_pass(bitcoind_pass), vtxo_refresh_expiry_threshold(vtxo_refresh_expiry_threshold), fallback_fee_rate(fallback_fee_rate), htlc_recv_claim_delta(htlc_recv_claim_delta), vtxo_exit_margin(vtxo_exit_margin), round_tx_required_confirmations(round_tx_required_confirmations) {}
+    explicit BarkConfigOpts(std::optional<std::string> ark, std::optional<std::string> esplora, std::optional<std::string> bitcoind, std::optional<std::string> bitcoind_cookie, std::optional<std::string> bitcoind_user, std::optional<std::string> bitcoind_pass, std::optional<double> vtxo_refresh_expiry_threshold, std::optional<double> fallback_fee_rate, double htlc_recv_claim_delta, double vtxo_exit_margin, double round_tx_required_confirmations, std::optional<BarkStorageOpts> storage): ark(ark), esplora(esplora), bitcoind(bitcoind), bitcoind_cookie(bitcoind_cookie), bitcoind_user(bitcoind_user), bitcoind_pass(bitcoind_pass), vtxo_refresh_expiry_threshold(vtxo_refresh_expiry_threshold), fallback_fee_rate(fallback_fee_rate), htlc_recv_claim_delta(htlc_recv_claim_delta), vtxo_exit_margin(vtxo_exit_margin), round_tx_required_confirmations(round_tx_required_confirmations), storage(storage) {}
 
   public:
     friend bool operator==(const BarkConfigOpts& lhs, const BarkConfigOpts& rhs) = default;
@@ -80,7 +83,8 @@ namespace margelo::nitro {
         JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "fallback_fee_rate"))),
         JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "htlc_recv_claim_delta"))),
         JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "vtxo_exit_margin"))),
-        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "round_tx_required_confirmations")))
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "round_tx_required_confirmations"))),
+        JSIConverter<std::optional<margelo::nitro::nitroark::BarkStorageOpts>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "storage")))
       );
     }
     static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroark::BarkConfigOpts& arg) {
@@ -96,6 +100,7 @@ namespace margelo::nitro {
       obj.setProperty(runtime, PropNameIDCache::get(runtime, "htlc_recv_claim_delta"), JSIConverter<double>::toJSI(runtime, arg.htlc_recv_claim_delta));
       obj.setProperty(runtime, PropNameIDCache::get(runtime, "vtxo_exit_margin"), JSIConverter<double>::toJSI(runtime, arg.vtxo_exit_margin));
       obj.setProperty(runtime, PropNameIDCache::get(runtime, "round_tx_required_confirmations"), JSIConverter<double>::toJSI(runtime, arg.round_tx_required_confirmations));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "storage"), JSIConverter<std::optional<margelo::nitro::nitroark::BarkStorageOpts>>::toJSI(runtime, arg.storage));
       return obj;
     }
     static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
@@ -117,6 +122,7 @@ namespace margelo::nitro {
       if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "htlc_recv_claim_delta")))) return false;
       if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "vtxo_exit_margin")))) return false;
       if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "round_tx_required_confirmations")))) return false;
+      if (!JSIConverter<std::optional<margelo::nitro::nitroark::BarkStorageOpts>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "storage")))) return false;
       return true;
     }
   };
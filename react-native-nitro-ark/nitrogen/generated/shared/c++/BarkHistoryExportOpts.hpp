@@ -0,0 +1,94 @@
+///
+/// BarkHistoryExportOpts.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `BarkHistoryQuery` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkHistoryQuery; }
+
+#include <string>
+#include "BarkHistoryQuery.hpp"
+#include <optional>
+
+namespace margelo::nitro::nitroark {
+
+  /**
+   * A struct which can be represented as a JavaScript object (BarkHistoryExportOpts).
+   */
+  struct BarkHistoryExportOpts final {
+  public:
+    std::string format     SWIFT_PRIVATE;
+    std::optional<BarkHistoryQuery> query     SWIFT_PRIVATE;
+    std::optional<double> chunk_size     SWIFT_PRIVATE;
+
+  public:
+    BarkHistoryExportOpts() = default;
+    explicit BarkHistoryExportOpts(std::string format, std::optional<BarkHistoryQuery> query, std::optional<double> chunk_size): format(format), query(query), chunk_size(chunk_size) {}
+
+  public:
+    friend bool operator==(const BarkHistoryExportOpts& lhs, const BarkHistoryExportOpts& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroark
+
+namespace margelo::nitro {
+
+  // C++ BarkHistoryExportOpts <> JS BarkHistoryExportOpts (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroark::BarkHistoryExportOpts> final {
+    static inline margelo::nitro::nitroark::BarkHistoryExportOpts fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroark::BarkHistoryExportOpts(
+        JSIConverter<std::string>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "format"))),
+        JSIConverter<std::optional<margelo::nitro::nitroark::BarkHistoryQuery>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "query"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "chunk_size")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroark::BarkHistoryExportOpts& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "format"), JSIConverter<std::string>::toJSI(runtime, arg.format));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "query"), JSIConverter<std::optional<margelo::nitro::nitroark::BarkHistoryQuery>>::toJSI(runtime, arg.query));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "chunk_size"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.chunk_size));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<std::string>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "format")))) return false;
+      if (!JSIConverter<std::optional<margelo::nitro::nitroark::BarkHistoryQuery>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "query")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "chunk_size")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,94 @@
+///
+/// BarkHistoryPage.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `BarkMovement` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkMovement; }
+
+#include "BarkMovement.hpp"
+#include <vector>
+#include <optional>
+
+namespace margelo::nitro::nitroark {
+
+  /**
+   * A struct which can be represented as a JavaScript object (BarkHistoryPage).
+   */
+  struct BarkHistoryPage final {
+  public:
+    std::vector<BarkMovement> movements     SWIFT_PRIVATE;
+    std::optional<double> next_cursor     SWIFT_PRIVATE;
+    bool has_more     SWIFT_PRIVATE;
+
+  public:
+    BarkHistoryPage() = default;
+    explicit BarkHistoryPage(std::vector<BarkMovement> movements, std::optional<double> next_cursor, bool has_more): movements(movements), next_cursor(next_cursor), has_more(has_more) {}
+
+  public:
+    friend bool operator==(const BarkHistoryPage& lhs, const BarkHistoryPage& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroark
+
+namespace margelo::nitro {
+
+  // C++ BarkHistoryPage <> JS BarkHistoryPage (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroark::BarkHistoryPage> final {
+    static inline margelo::nitro::nitroark::BarkHistoryPage fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroark::BarkHistoryPage(
+        JSIConverter<std::vector<margelo::nitro::nitroark::BarkMovement>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "movements"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "next_cursor"))),
+        JSIConverter<bool>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "has_more")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroark::BarkHistoryPage& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "movements"), JSIConverter<std::vector<margelo::nitro::nitroark::BarkMovement>>::toJSI(runtime, arg.movements));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "next_cursor"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.next_cursor));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "has_more"), JSIConverter<bool>::toJSI(runtime, arg.has_more));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<std::vector<margelo::nitro::nitroark::BarkMovement>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "movements")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "next_cursor")))) return false;
+      if (!JSIConverter<bool>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "has_more")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
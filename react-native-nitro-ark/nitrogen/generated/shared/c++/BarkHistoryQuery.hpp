@@ -0,0 +1,108 @@
+///
+/// BarkHistoryQuery.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <optional>
+#include <string>
+
+namespace margelo::nitro::nitroark {
+
+  /**
+   * A struct which can be represented as a JavaScript object (BarkHistoryQuery).
+   */
+  struct BarkHistoryQuery final {
+  public:
+    std::optional<double> cursor     SWIFT_PRIVATE;
+    std::optional<double> limit     SWIFT_PRIVATE;
+    std::optional<std::string> status     SWIFT_PRIVATE;
+    std::optional<std::string> subsystem_kind     SWIFT_PRIVATE;
+    std::optional<double> created_after     SWIFT_PRIVATE;
+    std::optional<double> created_before     SWIFT_PRIVATE;
+    std::optional<bool> include_metadata     SWIFT_PRIVATE;
+
+  public:
+    BarkHistoryQuery() = default;
+    explicit BarkHistoryQuery(std::optional<double> cursor, std::optional<double> limit, std::optional<std::string> status, std::optional<std::string> subsystem_kind, std::optional<double> created_after, std::optional<double> created_before, std::optional<bool> include_metadata): cursor(cursor), limit(limit), status(status), subsystem_kind(subsystem_kind), created_after(created_after), created_before(created_before), include_metadata(include_metadata) {}
+
+  public:
+    friend bool operator==(const BarkHistoryQuery& lhs, const BarkHistoryQuery& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroark
+
+namespace margelo::nitro {
+
+  // C++ BarkHistoryQuery <> JS BarkHistoryQuery (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroark::BarkHistoryQuery> final {
+    static inline margelo::nitro::nitroark::BarkHistoryQuery fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroark::BarkHistoryQuery(
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "cursor"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "limit"))),
+        JSIConverter<std::optional<std::string>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "status"))),
+        JSIConverter<std::optional<std::string>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "subsystem_kind"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "created_after"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "created_before"))),
+        JSIConverter<std::optional<bool>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "include_metadata")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroark::BarkHistoryQuery& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "cursor"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.cursor));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "limit"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.limit));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "status"), JSIConverter<std::optional<std::string>>::toJSI(runtime, arg.status));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "subsystem_kind"), JSIConverter<std::optional<std::string>>::toJSI(runtime, arg.subsystem_kind));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "created_after"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.created_after));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "created_before"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.created_before));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "include_metadata"), JSIConverter<std::optional<bool>>::toJSI(runtime, arg.include_metadata));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "cursor")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "limit")))) return false;
+      if (!JSIConverter<std::optional<std::string>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "status")))) return false;
+      if (!JSIConverter<std::optional<std::string>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "subsystem_kind")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "created_after")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "created_before")))) return false;
+      if (!JSIConverter<std::optional<bool>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "include_metadata")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
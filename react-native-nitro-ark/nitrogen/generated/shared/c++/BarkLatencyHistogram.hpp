@@ -0,0 +1,95 @@
+///
+/// BarkLatencyHistogram.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <vector>
+
+namespace margelo::nitro::nitroark {
+
+  /**
+   * A struct which can be represented as a JavaScript object (BarkLatencyHistogram).
+   */
+  struct BarkLatencyHistogram final {
+  public:
+    double count     SWIFT_PRIVATE;
+    double sum_us     SWIFT_PRIVATE;
+    double max_us     SWIFT_PRIVATE;
+    std::vector<double> buckets     SWIFT_PRIVATE;
+
+  public:
+    BarkLatencyHistogram() = default;
+    explicit BarkLatencyHistogram(double count, double sum_us, double max_us, std::vector<double> buckets): count(count), sum_us(sum_us), max_us(max_us), buckets(buckets) {}
+
+  public:
+    friend bool operator==(const BarkLatencyHistogram& lhs, const BarkLatencyHistogram& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroark
+
+namespace margelo::nitro {
+
+  // C++ BarkLatencyHistogram <> JS BarkLatencyHistogram (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroark::BarkLatencyHistogram> final {
+    static inline margelo::nitro::nitroark::BarkLatencyHistogram fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroark::BarkLatencyHistogram(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "count"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "sum_us"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "max_us"))),
+        JSIConverter<std::vector<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "buckets")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroark::BarkLatencyHistogram& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "count"), JSIConverter<double>::toJSI(runtime, arg.count));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "sum_us"), JSIConverter<double>::toJSI(runtime, arg.sum_us));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "max_us"), JSIConverter<double>::toJSI(runtime, arg.max_us));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "buckets"), JSIConverter<std::vector<double>>::toJSI(runtime, arg.buckets));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "count")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "sum_us")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "max_us")))) return false;
+      if (!JSIConverter<std::vector<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "buckets")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,92 @@
+///
+/// BarkLogOpts.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <optional>
+#include <string>
+
+namespace margelo::nitro::nitroark {
+
+  /**
+   * A struct which can be represented as a JavaScript object (BarkLogOpts).
+   */
+  struct BarkLogOpts final {
+  public:
+    std::optional<std::string> filter     SWIFT_PRIVATE;
+    std::optional<double> ring_buffer_lines     SWIFT_PRIVATE;
+    std::optional<std::string> ring_buffer_level     SWIFT_PRIVATE;
+
+  public:
+    BarkLogOpts() = default;
+    explicit BarkLogOpts(std::optional<std::string> filter, std::optional<double> ring_buffer_lines, std::optional<std::string> ring_buffer_level): filter(filter), ring_buffer_lines(ring_buffer_lines), ring_buffer_level(ring_buffer_level) {}
+
+  public:
+    friend bool operator==(const BarkLogOpts& lhs, const BarkLogOpts& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroark
+
+namespace margelo::nitro {
+
+  // C++ BarkLogOpts <> JS BarkLogOpts (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroark::BarkLogOpts> final {
+    static inline margelo::nitro::nitroark::BarkLogOpts fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroark::BarkLogOpts(
+        JSIConverter<std::optional<std::string>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "filter"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "ring_buffer_lines"))),
+        JSIConverter<std::optional<std::string>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "ring_buffer_level")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroark::BarkLogOpts& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "filter"), JSIConverter<std::optional<std::string>>::toJSI(runtime, arg.filter));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "ring_buffer_lines"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.ring_buffer_lines));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "ring_buffer_level"), JSIConverter<std::optional<std::string>>::toJSI(runtime, arg.ring_buffer_level));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<std::optional<std::string>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "filter")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "ring_buffer_lines")))) return false;
+      if (!JSIConverter<std::optional<std::string>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "ring_buffer_level")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,104 @@
+///
+/// BarkMaintenanceReport.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <string>
+#include <vector>
+
+namespace margelo::nitro::nitroark {
+
+  /**
+   * A struct which can be represented as a JavaScript object (BarkMaintenanceReport).
+   */
+  struct BarkMaintenanceReport final {
+  public:
+    std::vector<std::string> ran     SWIFT_PRIVATE;
+    std::vector<std::string> skipped     SWIFT_PRIVATE;
+    std::vector<std::string> failed     SWIFT_PRIVATE;
+    std::vector<std::string> errors     SWIFT_PRIVATE;
+    bool coalesced     SWIFT_PRIVATE;
+    double duration_ms     SWIFT_PRIVATE;
+
+  public:
+    BarkMaintenanceReport() = default;
+    explicit BarkMaintenanceReport(std::vector<std::string> ran, std::vector<std::string> skipped, std::vector<std::string> failed, std::vector<std::string> errors, bool coalesced, double duration_ms): ran(ran), skipped(skipped), failed(failed), errors(errors), coalesced(coalesced), duration_ms(duration_ms) {}
+
+  public:
+    friend bool operator==(const BarkMaintenanceReport& lhs, const BarkMaintenanceReport& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroark
+
+namespace margelo::nitro {
+
+  // C++ BarkMaintenanceReport <> JS BarkMaintenanceReport (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroark::BarkMaintenanceReport> final {
+    static inline margelo::nitro::nitroark::BarkMaintenanceReport fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroark::BarkMaintenanceReport(
+        JSIConverter<std::vector<std::string>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "ran"))),
+        JSIConverter<std::vector<std::string>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "skipped"))),
+        JSIConverter<std::vector<std::string>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "failed"))),
+        JSIConverter<std::vector<std::string>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "errors"))),
+        JSIConverter<bool>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "coalesced"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "duration_ms")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroark::BarkMaintenanceReport& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "ran"), JSIConverter<std::vector<std::string>>::toJSI(runtime, arg.ran));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "skipped"), JSIConverter<std::vector<std::string>>::toJSI(runtime, arg.skipped));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "failed"), JSIConverter<std::vector<std::string>>::toJSI(runtime, arg.failed));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "errors"), JSIConverter<std::vector<std::string>>::toJSI(runtime, arg.errors));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "coalesced"), JSIConverter<bool>::toJSI(runtime, arg.coalesced));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "duration_ms"), JSIConverter<double>::toJSI(runtime, arg.duration_ms));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<std::vector<std::string>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "ran")))) return false;
+      if (!JSIConverter<std::vector<std::string>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "skipped")))) return false;
+      if (!JSIConverter<std::vector<std::string>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "failed")))) return false;
+      if (!JSIConverter<std::vector<std::string>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "errors")))) return false;
+      if (!JSIConverter<bool>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "coalesced")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "duration_ms")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
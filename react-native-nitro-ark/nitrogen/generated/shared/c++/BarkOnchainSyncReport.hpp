@@ -0,0 +1,95 @@
+///
+/// BarkOnchainSyncReport.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+
+
+namespace margelo::nitro::nitroark {
+
+  /**
+   * A struct which can be represented as a JavaScript object (BarkOnchainSyncReport).
+   */
+  struct BarkOnchainSyncReport final {
+  public:
+    bool skipped     SWIFT_PRIVATE;
+    double from_height     SWIFT_PRIVATE;
+    double tip_height     SWIFT_PRIVATE;
+    double duration_ms     SWIFT_PRIVATE;
+
+  public:
+    BarkOnchainSyncReport() = default;
+    explicit BarkOnchainSyncReport(bool skipped, double from_height, double tip_height, double duration_ms): skipped(skipped), from_height(from_height), tip_height(tip_height), duration_ms(duration_ms) {}
+
+  public:
+    friend bool operator==(const BarkOnchainSyncReport& lhs, const BarkOnchainSyncReport& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroark
+
+namespace margelo::nitro {
+
+  // C++ BarkOnchainSyncReport <> JS BarkOnchainSyncReport (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroark::BarkOnchainSyncReport> final {
+    static inline margelo::nitro::nitroark::BarkOnchainSyncReport fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroark::BarkOnchainSyncReport(
+        JSIConverter<bool>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "skipped"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "from_height"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "tip_height"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "duration_ms")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroark::BarkOnchainSyncReport& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "skipped"), JSIConverter<bool>::toJSI(runtime, arg.skipped));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "from_height"), JSIConverter<double>::toJSI(runtime, arg.from_height));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "tip_height"), JSIConverter<double>::toJSI(runtime, arg.tip_height));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "duration_ms"), JSIConverter<double>::toJSI(runtime, arg.duration_ms));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<bool>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "skipped")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "from_height")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "tip_height")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "duration_ms")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,87 @@
+///
+/// BarkOnchainUtxoFilter.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <optional>
+
+namespace margelo::nitro::nitroark {
+
+  /**
+   * A struct which can be represented as a JavaScript object (BarkOnchainUtxoFilter).
+   */
+  struct BarkOnchainUtxoFilter final {
+  public:
+    std::optional<double> min_amount_sat     SWIFT_PRIVATE;
+    std::optional<bool> confirmed_only     SWIFT_PRIVATE;
+
+  public:
+    BarkOnchainUtxoFilter() = default;
+    explicit BarkOnchainUtxoFilter(std::optional<double> min_amount_sat, std::optional<bool> confirmed_only): min_amount_sat(min_amount_sat), confirmed_only(confirmed_only) {}
+
+  public:
+    friend bool operator==(const BarkOnchainUtxoFilter& lhs, const BarkOnchainUtxoFilter& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroark
+
+namespace margelo::nitro {
+
+  // C++ BarkOnchainUtxoFilter <> JS BarkOnchainUtxoFilter (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroark::BarkOnchainUtxoFilter> final {
+    static inline margelo::nitro::nitroark::BarkOnchainUtxoFilter fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroark::BarkOnchainUtxoFilter(
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "min_amount_sat"))),
+        JSIConverter<std::optional<bool>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "confirmed_only")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroark::BarkOnchainUtxoFilter& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "min_amount_sat"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.min_amount_sat));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "confirmed_only"), JSIConverter<std::optional<bool>>::toJSI(runtime, arg.confirmed_only));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "min_amount_sat")))) return false;
+      if (!JSIConverter<std::optional<bool>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "confirmed_only")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
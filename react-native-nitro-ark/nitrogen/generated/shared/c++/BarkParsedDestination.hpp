@@ -0,0 +1,112 @@
+///
+/// BarkParsedDestination.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <string>
+#include <optional>
+
+namespace margelo::nitro::nitroark {
+
+  /**
+   * A struct which can be represented as a JavaScript object (BarkParsedDestination).
+   */
+  struct BarkParsedDestination final {
+  public:
+    std::string kind     SWIFT_PRIVATE;
+    std::optional<double> amount_msat     SWIFT_PRIVATE;
+    std::optional<double> expires_at     SWIFT_PRIVATE;
+    bool expired     SWIFT_PRIVATE;
+    std::optional<double> lnurl_min_sendable_msat     SWIFT_PRIVATE;
+    std::optional<double> lnurl_max_sendable_msat     SWIFT_PRIVATE;
+    std::optional<double> lnurl_comment_allowed     SWIFT_PRIVATE;
+    std::optional<std::string> lnurl_description     SWIFT_PRIVATE;
+
+  public:
+    BarkParsedDestination() = default;
+    explicit BarkParsedDestination(std::string kind, std::optional<double> amount_msat, std::optional<double> expires_at, bool expired, std::optional<double> lnurl_min_sendable_msat, std::optional<double> lnurl_max_sendable_msat, std::optional<double> lnurl_comment_allowed, std::optional<std::string> lnurl_description): kind(kind), amount_msat(amount_msat), expires_at(expires_at), expired(expired), lnurl_min_sendable_msat(lnurl_min_sendable_msat), lnurl_max_sendable_msat(lnurl_max_sendable_msat), lnurl_comment_allowed(lnurl_comment_allowed), lnurl_description(lnurl_description) {}
+
+  public:
+    friend bool operator==(const BarkParsedDestination& lhs, const BarkParsedDestination& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroark
+
+namespace margelo::nitro {
+
+  // C++ BarkParsedDestination <> JS BarkParsedDestination (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroark::BarkParsedDestination> final {
+    static inline margelo::nitro::nitroark::BarkParsedDestination fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroark::BarkParsedDestination(
+        JSIConverter<std::string>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "kind"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "amount_msat"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "expires_at"))),
+        JSIConverter<bool>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "expired"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "lnurl_min_sendable_msat"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "lnurl_max_sendable_msat"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "lnurl_comment_allowed"))),
+        JSIConverter<std::optional<std::string>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "lnurl_description")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroark::BarkParsedDestination& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "kind"), JSIConverter<std::string>::toJSI(runtime, arg.kind));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "amount_msat"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.amount_msat));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "expires_at"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.expires_at));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "expired"), JSIConverter<bool>::toJSI(runtime, arg.expired));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "lnurl_min_sendable_msat"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.lnurl_min_sendable_msat));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "lnurl_max_sendable_msat"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.lnurl_max_sendable_msat));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "lnurl_comment_allowed"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.lnurl_comment_allowed));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "lnurl_description"), JSIConverter<std::optional<std::string>>::toJSI(runtime, arg.lnurl_description));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<std::string>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "kind")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "amount_msat")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "expires_at")))) return false;
+      if (!JSIConverter<bool>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "expired")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "lnurl_min_sendable_msat")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "lnurl_max_sendable_msat")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "lnurl_comment_allowed")))) return false;
+      if (!JSIConverter<std::optional<std::string>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "lnurl_description")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
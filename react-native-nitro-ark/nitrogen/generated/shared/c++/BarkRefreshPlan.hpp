@@ -0,0 +1,110 @@
+///
+/// BarkRefreshPlan.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `BarkPlannedVtxo` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkPlannedVtxo; }
+
+#include <optional>
+#include "BarkPlannedVtxo.hpp"
+#include <vector>
+
+namespace margelo::nitro::nitroark {
+
+  /**
+   * A struct which can be represented as a JavaScript object (BarkRefreshPlan).
+   */
+  struct BarkRefreshPlan final {
+  public:
+    double tip     SWIFT_PRIVATE;
+    double round_blocks     SWIFT_PRIVATE;
+    std::optional<double> refresh_by     SWIFT_PRIVATE;
+    bool due_now     SWIFT_PRIVATE;
+    std::vector<BarkPlannedVtxo> vtxos     SWIFT_PRIVATE;
+    double total_sat     SWIFT_PRIVATE;
+    std::optional<double> next_refresh_by     SWIFT_PRIVATE;
+
+  public:
+    BarkRefreshPlan() = default;
+    explicit BarkRefreshPlan(double tip, double round_blocks, std::optional<double> refresh_by, bool due_now, std::vector<BarkPlannedVtxo> vtxos, double total_sat, std::optional<double> next_refresh_by): tip(tip), round_blocks(round_blocks), refresh_by(refresh_by), due_now(due_now), vtxos(vtxos), total_sat(total_sat), next_refresh_by(next_refresh_by) {}
+
+  public:
+    friend bool operator==(const BarkRefreshPlan& lhs, const BarkRefreshPlan& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroark
+
+namespace margelo::nitro {
+
+  // C++ BarkRefreshPlan <> JS BarkRefreshPlan (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroark::BarkRefreshPlan> final {
+    static inline margelo::nitro::nitroark::BarkRefreshPlan fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroark::BarkRefreshPlan(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "tip"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "round_blocks"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "refresh_by"))),
+        JSIConverter<bool>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "due_now"))),
+        JSIConverter<std::vector<margelo::nitro::nitroark::BarkPlannedVtxo>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "vtxos"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "total_sat"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "next_refresh_by")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroark::BarkRefreshPlan& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "tip"), JSIConverter<double>::toJSI(runtime, arg.tip));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "round_blocks"), JSIConverter<double>::toJSI(runtime, arg.round_blocks));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "refresh_by"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.refresh_by));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "due_now"), JSIConverter<bool>::toJSI(runtime, arg.due_now));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "vtxos"), JSIConverter<std::vector<margelo::nitro::nitroark::BarkPlannedVtxo>>::toJSI(runtime, arg.vtxos));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "total_sat"), JSIConverter<double>::toJSI(runtime, arg.total_sat));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "next_refresh_by"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.next_refresh_by));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "tip")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "round_blocks")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "refresh_by")))) return false;
+      if (!JSIConverter<bool>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "due_now")))) return false;
+      if (!JSIConverter<std::vector<margelo::nitro::nitroark::BarkPlannedVtxo>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "vtxos")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "total_sat")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "next_refresh_by")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
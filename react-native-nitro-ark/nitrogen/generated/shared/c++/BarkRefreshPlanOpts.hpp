@@ -0,0 +1,91 @@
+///
+/// BarkRefreshPlanOpts.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <optional>
+
+namespace margelo::nitro::nitroark {
+
+  /**
+   * A struct which can be represented as a JavaScript object (BarkRefreshPlanOpts).
+   */
+  struct BarkRefreshPlanOpts final {
+  public:
+    std::optional<double> horizonBlocks     SWIFT_PRIVATE;
+    std::optional<bool> foldDust     SWIFT_PRIVATE;
+    std::optional<double> dustLimitSat     SWIFT_PRIVATE;
+
+  public:
+    BarkRefreshPlanOpts() = default;
+    explicit BarkRefreshPlanOpts(std::optional<double> horizonBlocks, std::optional<bool> foldDust, std::optional<double> dustLimitSat): horizonBlocks(horizonBlocks), foldDust(foldDust), dustLimitSat(dustLimitSat) {}
+
+  public:
+    friend bool operator==(const BarkRefreshPlanOpts& lhs, const BarkRefreshPlanOpts& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroark
+
+namespace margelo::nitro {
+
+  // C++ BarkRefreshPlanOpts <> JS BarkRefreshPlanOpts (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroark::BarkRefreshPlanOpts> final {
+    static inline margelo::nitro::nitroark::BarkRefreshPlanOpts fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroark::BarkRefreshPlanOpts(
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "horizonBlocks"))),
+        JSIConverter<std::optional<bool>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "foldDust"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "dustLimitSat")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroark::BarkRefreshPlanOpts& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "horizonBlocks"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.horizonBlocks));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "foldDust"), JSIConverter<std::optional<bool>>::toJSI(runtime, arg.foldDust));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "dustLimitSat"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.dustLimitSat));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "horizonBlocks")))) return false;
+      if (!JSIConverter<std::optional<bool>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "foldDust")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "dustLimitSat")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
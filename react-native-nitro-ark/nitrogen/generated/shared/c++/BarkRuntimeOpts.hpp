@@ -0,0 +1,99 @@
+///
+/// BarkRuntimeOpts.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <optional>
+
+namespace margelo::nitro::nitroark {
+
+  /**
+   * A struct which can be represented as a JavaScript object (BarkRuntimeOpts).
+   */
+  struct BarkRuntimeOpts final {
+  public:
+    std::optional<double> worker_threads     SWIFT_PRIVATE;
+    std::optional<bool> current_thread     SWIFT_PRIVATE;
+    std::optional<double> thread_stack_size     SWIFT_PRIVATE;
+    std::optional<double> max_blocking_threads     SWIFT_PRIVATE;
+    std::optional<double> blocking_keep_alive_ms     SWIFT_PRIVATE;
+
+  public:
+    BarkRuntimeOpts() = default;
+    explicit BarkRuntimeOpts(std::optional<double> worker_threads, std::optional<bool> current_thread, std::optional<double> thread_stack_size, std::optional<double> max_blocking_threads, std::optional<double> blocking_keep_alive_ms): worker_threads(worker_threads), current_thread(current_thread), thread_stack_size(thread_stack_size), max_blocking_threads(max_blocking_threads), blocking_keep_alive_ms(blocking_keep_alive_ms) {}
+
+  public:
+    friend bool operator==(const BarkRuntimeOpts& lhs, const BarkRuntimeOpts& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroark
+
+namespace margelo::nitro {
+
+  // C++ BarkRuntimeOpts <> JS BarkRuntimeOpts (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroark::BarkRuntimeOpts> final {
+    static inline margelo::nitro::nitroark::BarkRuntimeOpts fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroark::BarkRuntimeOpts(
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "worker_threads"))),
+        JSIConverter<std::optional<bool>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "current_thread"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "thread_stack_size"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "max_blocking_threads"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "blocking_keep_alive_ms")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroark::BarkRuntimeOpts& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "worker_threads"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.worker_threads));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "current_thread"), JSIConverter<std::optional<bool>>::toJSI(runtime, arg.current_thread));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "thread_stack_size"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.thread_stack_size));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "max_blocking_threads"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.max_blocking_threads));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "blocking_keep_alive_ms"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.blocking_keep_alive_ms));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "worker_threads")))) return false;
+      if (!JSIConverter<std::optional<bool>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "current_thread")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "thread_stack_size")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "max_blocking_threads")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "blocking_keep_alive_ms")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
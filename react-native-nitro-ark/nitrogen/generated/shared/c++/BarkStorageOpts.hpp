@@ -0,0 +1,100 @@
+///
+/// BarkStorageOpts.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <string>
+#include <optional>
+
+namespace margelo::nitro::nitroark {
+
+  /**
+   * A struct which can be represented as a JavaScript object (BarkStorageOpts).
+   */
+  struct BarkStorageOpts final {
+  public:
+    std::optional<std::string> journal_mode     SWIFT_PRIVATE;
+    std::optional<std::string> synchronous     SWIFT_PRIVATE;
+    std::optional<double> mmap_size     SWIFT_PRIVATE;
+    std::optional<double> cache_size_kib     SWIFT_PRIVATE;
+    std::optional<double> page_size     SWIFT_PRIVATE;
+
+  public:
+    BarkStorageOpts() = default;
+    explicit BarkStorageOpts(std::optional<std::string> journal_mode, std::optional<std::string> synchronous, std::optional<double> mmap_size, std::optional<double> cache_size_kib, std::optional<double> page_size): journal_mode(journal_mode), synchronous(synchronous), mmap_size(mmap_size), cache_size_kib(cache_size_kib), page_size(page_size) {}
+
+  public:
+    friend bool operator==(const BarkStorageOpts& lhs, const BarkStorageOpts& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroark
+
+namespace margelo::nitro {
+
+  // C++ BarkStorageOpts <> JS BarkStorageOpts (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroark::BarkStorageOpts> final {
+    static inline margelo::nitro::nitroark::BarkStorageOpts fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroark::BarkStorageOpts(
+        JSIConverter<std::optional<std::string>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "journal_mode"))),
+        JSIConverter<std::optional<std::string>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "synchronous"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "mmap_size"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "cache_size_kib"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "page_size")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroark::BarkStorageOpts& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "journal_mode"), JSIConverter<std::optional<std::string>>::toJSI(runtime, arg.journal_mode));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "synchronous"), JSIConverter<std::optional<std::string>>::toJSI(runtime, arg.synchronous));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "mmap_size"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.mmap_size));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "cache_size_kib"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.cache_size_kib));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "page_size"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.page_size));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<std::optional<std::string>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "journal_mode")))) return false;
+      if (!JSIConverter<std::optional<std::string>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "synchronous")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "mmap_size")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "cache_size_kib")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "page_size")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,95 @@
+///
+/// BarkSubsystemAllocStats.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <string>
+
+namespace margelo::nitro::nitroark {
+
+  /**
+   * A struct which can be represented as a JavaScript object (BarkSubsystemAllocStats).
+   */
+  struct BarkSubsystemAllocStats final {
+  public:
+    std::string name     SWIFT_PRIVATE;
+    double current_bytes     SWIFT_PRIVATE;
+    double peak_bytes     SWIFT_PRIVATE;
+    double allocations     SWIFT_PRIVATE;
+
+  public:
+    BarkSubsystemAllocStats() = default;
+    explicit BarkSubsystemAllocStats(std::string name, double current_bytes, double peak_bytes, double allocations): name(name), current_bytes(current_bytes), peak_bytes(peak_bytes), allocations(allocations) {}
+
+  public:
+    friend bool operator==(const BarkSubsystemAllocStats& lhs, const BarkSubsystemAllocStats& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroark
+
+namespace margelo::nitro {
+
+  // C++ BarkSubsystemAllocStats <> JS BarkSubsystemAllocStats (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroark::BarkSubsystemAllocStats> final {
+    static inline margelo::nitro::nitroark::BarkSubsystemAllocStats fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroark::BarkSubsystemAllocStats(
+        JSIConverter<std::string>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "name"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "current_bytes"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "peak_bytes"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "allocations")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroark::BarkSubsystemAllocStats& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "name"), JSIConverter<std::string>::toJSI(runtime, arg.name));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "current_bytes"), JSIConverter<double>::toJSI(runtime, arg.current_bytes));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "peak_bytes"), JSIConverter<double>::toJSI(runtime, arg.peak_bytes));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "allocations"), JSIConverter<double>::toJSI(runtime, arg.allocations));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<std::string>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "name")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "current_bytes")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "peak_bytes")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "allocations")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,111 @@
+///
+/// BarkWalletOpenTimings.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+
+
+namespace margelo::nitro::nitroark {
+
+  /**
+   * A struct which can be represented as a JavaScript object (BarkWalletOpenTimings).
+   */
+  struct BarkWalletOpenTimings final {
+  public:
+    bool recorded     SWIFT_PRIVATE;
+    double db_open_ms     SWIFT_PRIVATE;
+    double read_properties_ms     SWIFT_PRIVATE;
+    double seed_ms     SWIFT_PRIVATE;
+    bool seed_cached     SWIFT_PRIVATE;
+    double onchain_load_ms     SWIFT_PRIVATE;
+    double wallet_open_ms     SWIFT_PRIVATE;
+    double total_ms     SWIFT_PRIVATE;
+
+  public:
+    BarkWalletOpenTimings() = default;
+    explicit BarkWalletOpenTimings(bool recorded, double db_open_ms, double read_properties_ms, double seed_ms, bool seed_cached, double onchain_load_ms, double wallet_open_ms, double total_ms): recorded(recorded), db_open_ms(db_open_ms), read_properties_ms(read_properties_ms), seed_ms(seed_ms), seed_cached(seed_cached), onchain_load_ms(onchain_load_ms), wallet_open_ms(wallet_open_ms), total_ms(total_ms) {}
+
+  public:
+    friend bool operator==(const BarkWalletOpenTimings& lhs, const BarkWalletOpenTimings& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroark
+
+namespace margelo::nitro {
+
+  // C++ BarkWalletOpenTimings <> JS BarkWalletOpenTimings (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroark::BarkWalletOpenTimings> final {
+    static inline margelo::nitro::nitroark::BarkWalletOpenTimings fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroark::BarkWalletOpenTimings(
+        JSIConverter<bool>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "recorded"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "db_open_ms"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "read_properties_ms"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "seed_ms"))),
+        JSIConverter<bool>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "seed_cached"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "onchain_load_ms"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "wallet_open_ms"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "total_ms")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroark::BarkWalletOpenTimings& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "recorded"), JSIConverter<bool>::toJSI(runtime, arg.recorded));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "db_open_ms"), JSIConverter<double>::toJSI(runtime, arg.db_open_ms));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "read_properties_ms"), JSIConverter<double>::toJSI(runtime, arg.read_properties_ms));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "seed_ms"), JSIConverter<double>::toJSI(runtime, arg.seed_ms));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "seed_cached"), JSIConverter<bool>::toJSI(runtime, arg.seed_cached));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "onchain_load_ms"), JSIConverter<double>::toJSI(runtime, arg.onchain_load_ms));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "wallet_open_ms"), JSIConverter<double>::toJSI(runtime, arg.wallet_open_ms));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "total_ms"), JSIConverter<double>::toJSI(runtime, arg.total_ms));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<bool>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "recorded")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "db_open_ms")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "read_properties_ms")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "seed_ms")))) return false;
+      if (!JSIConverter<bool>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "seed_cached")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "onchain_load_ms")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "wallet_open_ms")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "total_ms")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
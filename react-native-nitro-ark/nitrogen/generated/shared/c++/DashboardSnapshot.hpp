@@ -0,0 +1,111 @@
+///
+/// DashboardSnapshot.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `OffchainBalanceResult` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct OffchainBalanceResult; }
+// Forward declaration of `OnchainBalanceResult` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct OnchainBalanceResult; }
+// Forward declaration of `BarkArkInfo` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkArkInfo; }
+// Forward declaration of `BarkVtxo` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkVtxo; }
+
+#include "OffchainBalanceResult.hpp"
+#include "OnchainBalanceResult.hpp"
+#include "BarkArkInfo.hpp"
+#include <optional>
+#include "BarkVtxo.hpp"
+#include <vector>
+
+namespace margelo::nitro::nitroark {
+
+  /**
+   * A struct which can be represented as a JavaScript object (DashboardSnapshot).
+   */
+  struct DashboardSnapshot final {
+  public:
+    OffchainBalanceResult offchain_balance     SWIFT_PRIVATE;
+    OnchainBalanceResult onchain_balance     SWIFT_PRIVATE;
+    std::optional<BarkArkInfo> ark_info     SWIFT_PRIVATE;
+    std::optional<double> next_required_refresh_blockheight     SWIFT_PRIVATE;
+    std::vector<BarkVtxo> vtxos     SWIFT_PRIVATE;
+
+  public:
+    DashboardSnapshot() = default;
+    explicit DashboardSnapshot(OffchainBalanceResult offchain_balance, OnchainBalanceResult onchain_balance, std::optional<BarkArkInfo> ark_info, std::optional<double> next_required_refresh_blockheight, std::vector<BarkVtxo> vtxos): offchain_balance(offchain_balance), onchain_balance(onchain_balance), ark_info(ark_info), next_required_refresh_blockheight(next_required_refresh_blockheight), vtxos(vtxos) {}
+
+  public:
+    friend bool operator==(const DashboardSnapshot& lhs, const DashboardSnapshot& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroark
+
+namespace margelo::nitro {
+
+  // C++ DashboardSnapshot <> JS DashboardSnapshot (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroark::DashboardSnapshot> final {
+    static inline margelo::nitro::nitroark::DashboardSnapshot fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroark::DashboardSnapshot(
+        JSIConverter<margelo::nitro::nitroark::OffchainBalanceResult>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "offchain_balance"))),
+        JSIConverter<margelo::nitro::nitroark::OnchainBalanceResult>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "onchain_balance"))),
+        JSIConverter<std::optional<margelo::nitro::nitroark::BarkArkInfo>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "ark_info"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "next_required_refresh_blockheight"))),
+        JSIConverter<std::vector<margelo::nitro::nitroark::BarkVtxo>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "vtxos")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroark::DashboardSnapshot& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "offchain_balance"), JSIConverter<margelo::nitro::nitroark::OffchainBalanceResult>::toJSI(runtime, arg.offchain_balance));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "onchain_balance"), JSIConverter<margelo::nitro::nitroark::OnchainBalanceResult>::toJSI(runtime, arg.onchain_balance));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "ark_info"), JSIConverter<std::optional<margelo::nitro::nitroark::BarkArkInfo>>::toJSI(runtime, arg.ark_info));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "next_required_refresh_blockheight"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.next_required_refresh_blockheight));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "vtxos"), JSIConverter<std::vector<margelo::nitro::nitroark::BarkVtxo>>::toJSI(runtime, arg.vtxos));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<margelo::nitro::nitroark::OffchainBalanceResult>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "offchain_balance")))) return false;
+      if (!JSIConverter<margelo::nitro::nitroark::OnchainBalanceResult>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "onchain_balance")))) return false;
+      if (!JSIConverter<std::optional<margelo::nitro::nitroark::BarkArkInfo>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "ark_info")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "next_required_refresh_blockheight")))) return false;
+      if (!JSIConverter<std::vector<margelo::nitro::nitroark::BarkVtxo>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "vtxos")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -14,11 +14,31 @@ namespace margelo::nitro::nitroark {
     HybridObject::loadHybridMethods();
     // load custom methods/properties
     registerHybrids(this, [](Prototype& prototype) {
+      prototype.registerHybridMethod("configureRuntime", &HybridNitroArkSpec::configureRuntime);
+      prototype.registerHybridMethod("configureLogging", &HybridNitroArkSpec::configureLogging);
+      prototype.registerHybridMethod("setLogFilter", &HybridNitroArkSpec::setLogFilter);
+      prototype.registerHybridMethod("dumpLogs", &HybridNitroArkSpec::dumpLogs);
+      prototype.registerHybridMethod("clearLogs", &HybridNitroArkSpec::clearLogs);
+      prototype.registerHybridMethod("createCancelToken", &HybridNitroArkSpec::createCancelToken);
+      prototype.registerHybridMethod("cancelCall", &HybridNitroArkSpec::cancelCall);
+      prototype.registerHybridMethod("releaseCancelToken", &HybridNitroArkSpec::releaseCancelToken);
       prototype.registerHybridMethod("createMnemonic", &HybridNitroArkSpec::createMnemonic);
       prototype.registerHybridMethod("createWallet", &HybridNitroArkSpec::createWallet);
       prototype.registerHybridMethod("loadWallet", &HybridNitroArkSpec::loadWallet);
       prototype.registerHybridMethod("isWalletLoaded", &HybridNitroArkSpec::isWalletLoaded);
+      prototype.registerHybridMethod("getWalletOpenTimings", &HybridNitroArkSpec::getWalletOpenTimings);
+      prototype.registerHybridMethod("forgetCachedSeed", &HybridNitroArkSpec::forgetCachedSeed);
+      prototype.registerHybridMethod("setMetricsEnabled", &HybridNitroArkSpec::setMetricsEnabled);
+      prototype.registerHybridMethod("getMetrics", &HybridNitroArkSpec::getMetrics);
+      prototype.registerHybridMethod("resetMetrics", &HybridNitroArkSpec::resetMetrics);
+      prototype.registerHybridMethod("getAllocStats", &HybridNitroArkSpec::getAllocStats);
+      prototype.registerHybridMethod("resetAllocStats", &HybridNitroArkSpec::resetAllocStats);
+      prototype.registerHybridMethod("setReadCoalesceWindow", &HybridNitroArkSpec::setReadCoalesceWindow);
+      prototype.registerHybridMethod("setArkInfoTtl", &HybridNitroArkSpec::setArkInfoTtl);
       prototype.registerHybridMethod("closeWallet", &HybridNitroArkSpec::closeWallet);
+      prototype.registerHybridMethod("closeWalletAt", &HybridNitroArkSpec::closeWalletAt);
+      prototype.registerHybridMethod("selectWallet", &HybridNitroArkSpec::selectWallet);
+      prototype.registerHybridMethod("openWallets", &HybridNitroArkSpec::openWallets);
       prototype.registerHybridMethod("refreshServer", &HybridNitroArkSpec::refreshServer);
       prototype.registerHybridMethod("syncPendingBoards", &HybridNitroArkSpec::syncPendingBoards);
       prototype.registerHybridMethod("maintenance", &HybridNitroArkSpec::maintenance);
@@ -26,37 +46,56 @@ namespace margelo::nitro::nitroark {
       prototype.registerHybridMethod("maintenanceDelegated", &HybridNitroArkSpec::maintenanceDelegated);
       prototype.registerHybridMethod("maintenanceWithOnchainDelegated", &HybridNitroArkSpec::maintenanceWithOnchainDelegated);
       prototype.registerHybridMethod("maintenanceRefresh", &HybridNitroArkSpec::maintenanceRefresh);
+      prototype.registerHybridMethod("maintenanceScheduled", &HybridNitroArkSpec::maintenanceScheduled);
+      prototype.registerHybridMethod("planRefresh", &HybridNitroArkSpec::planRefresh);
+      prototype.registerHybridMethod("executeRefreshPlan", &HybridNitroArkSpec::executeRefreshPlan);
       prototype.registerHybridMethod("sync", &HybridNitroArkSpec::sync);
       prototype.registerHybridMethod("syncExits", &HybridNitroArkSpec::syncExits);
       prototype.registerHybridMethod("syncPendingRounds", &HybridNitroArkSpec::syncPendingRounds);
+      prototype.registerHybridMethod("subscribeWalletEvents", &HybridNitroArkSpec::subscribeWalletEvents);
+      prototype.registerHybridMethod("unsubscribeWalletEvents", &HybridNitroArkSpec::unsubscribeWalletEvents);
       prototype.registerHybridMethod("getArkInfo", &HybridNitroArkSpec::getArkInfo);
       prototype.registerHybridMethod("offchainBalance", &HybridNitroArkSpec::offchainBalance);
       prototype.registerHybridMethod("deriveStoreNextKeypair", &HybridNitroArkSpec::deriveStoreNextKeypair);
       prototype.registerHybridMethod("peakKeyPair", &HybridNitroArkSpec::peakKeyPair);
+      prototype.registerHybridMethod("peakKeyPairs", &HybridNitroArkSpec::peakKeyPairs);
       prototype.registerHybridMethod("peakAddress", &HybridNitroArkSpec::peakAddress);
+      prototype.registerHybridMethod("peakAddresses", &HybridNitroArkSpec::peakAddresses);
       prototype.registerHybridMethod("newAddress", &HybridNitroArkSpec::newAddress);
       prototype.registerHybridMethod("signMessage", &HybridNitroArkSpec::signMessage);
       prototype.registerHybridMethod("signMesssageWithMnemonic", &HybridNitroArkSpec::signMesssageWithMnemonic);
       prototype.registerHybridMethod("deriveKeypairFromMnemonic", &HybridNitroArkSpec::deriveKeypairFromMnemonic);
+      prototype.registerHybridMethod("deriveKeypairsFromMnemonic", &HybridNitroArkSpec::deriveKeypairsFromMnemonic);
       prototype.registerHybridMethod("verifyMessage", &HybridNitroArkSpec::verifyMessage);
       prototype.registerHybridMethod("history", &HybridNitroArkSpec::history);
+      prototype.registerHybridMethod("historyPage", &HybridNitroArkSpec::historyPage);
+      prototype.registerHybridMethod("exportHistory", &HybridNitroArkSpec::exportHistory);
       prototype.registerHybridMethod("vtxos", &HybridNitroArkSpec::vtxos);
+      prototype.registerHybridMethod("vtxosColumnar", &HybridNitroArkSpec::vtxosColumnar);
       prototype.registerHybridMethod("getFirstExpiringVtxoBlockheight", &HybridNitroArkSpec::getFirstExpiringVtxoBlockheight);
       prototype.registerHybridMethod("getNextRequiredRefreshBlockheight", &HybridNitroArkSpec::getNextRequiredRefreshBlockheight);
       prototype.registerHybridMethod("getExpiringVtxos", &HybridNitroArkSpec::getExpiringVtxos);
+      prototype.registerHybridMethod("getCachedWalletSnapshot", &HybridNitroArkSpec::getCachedWalletSnapshot);
+      prototype.registerHybridMethod("dashboardSnapshot", &HybridNitroArkSpec::dashboardSnapshot);
       prototype.registerHybridMethod("onchainBalance", &HybridNitroArkSpec::onchainBalance);
       prototype.registerHybridMethod("onchainSync", &HybridNitroArkSpec::onchainSync);
+      prototype.registerHybridMethod("onchainSyncIncremental", &HybridNitroArkSpec::onchainSyncIncremental);
       prototype.registerHybridMethod("onchainListUnspent", &HybridNitroArkSpec::onchainListUnspent);
       prototype.registerHybridMethod("onchainUtxos", &HybridNitroArkSpec::onchainUtxos);
+      prototype.registerHybridMethod("onchainUnspentOutputs", &HybridNitroArkSpec::onchainUnspentOutputs);
+      prototype.registerHybridMethod("onchainUtxoList", &HybridNitroArkSpec::onchainUtxoList);
       prototype.registerHybridMethod("onchainAddress", &HybridNitroArkSpec::onchainAddress);
       prototype.registerHybridMethod("onchainSend", &HybridNitroArkSpec::onchainSend);
       prototype.registerHybridMethod("onchainDrain", &HybridNitroArkSpec::onchainDrain);
       prototype.registerHybridMethod("onchainSendMany", &HybridNitroArkSpec::onchainSendMany);
       prototype.registerHybridMethod("boardAmount", &HybridNitroArkSpec::boardAmount);
       prototype.registerHybridMethod("boardAll", &HybridNitroArkSpec::boardAll);
+      prototype.registerHybridMethod("parseDestination", &HybridNitroArkSpec::parseDestination);
       prototype.registerHybridMethod("validateArkoorAddress", &HybridNitroArkSpec::validateArkoorAddress);
       prototype.registerHybridMethod("sendArkoorPayment", &HybridNitroArkSpec::sendArkoorPayment);
+      prototype.registerHybridMethod("sendArkoorMany", &HybridNitroArkSpec::sendArkoorMany);
       prototype.registerHybridMethod("payLightningInvoice", &HybridNitroArkSpec::payLightningInvoice);
+      prototype.registerHybridMethod("payLightningInvoices", &HybridNitroArkSpec::payLightningInvoices);
       prototype.registerHybridMethod("payLightningOffer", &HybridNitroArkSpec::payLightningOffer);
       prototype.registerHybridMethod("payLightningAddress", &HybridNitroArkSpec::payLightningAddress);
       prototype.registerHybridMethod("sendOnchain", &HybridNitroArkSpec::sendOnchain);
@@ -65,6 +104,7 @@ namespace margelo::nitro::nitroark {
       prototype.registerHybridMethod("checkLightningPayment", &HybridNitroArkSpec::checkLightningPayment);
       prototype.registerHybridMethod("tryClaimLightningReceive", &HybridNitroArkSpec::tryClaimLightningReceive);
       prototype.registerHybridMethod("tryClaimAllLightningReceives", &HybridNitroArkSpec::tryClaimAllLightningReceives);
+      prototype.registerHybridMethod("cancelLightningWait", &HybridNitroArkSpec::cancelLightningWait);
       prototype.registerHybridMethod("offboardSpecific", &HybridNitroArkSpec::offboardSpecific);
       prototype.registerHybridMethod("offboardAll", &HybridNitroArkSpec::offboardAll);
     });
@@ -13,8 +13,30 @@
 #error NitroModules cannot be found! Are you sure you installed NitroModules properly?
 #endif
 
+// Forward declaration of `BarkRuntimeOpts` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkRuntimeOpts; }
+// Forward declaration of `BarkLogOpts` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkLogOpts; }
+// Forward declaration of `BarkCallOpts` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkCallOpts; }
 // Forward declaration of `BarkCreateOpts` to properly resolve imports.
 namespace margelo::nitro::nitroark { struct BarkCreateOpts; }
+// Forward declaration of `BarkWalletOpenTimings` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkWalletOpenTimings; }
+// Forward declaration of `BarkCallMetrics` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkCallMetrics; }
+// Forward declaration of `BarkAllocStats` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkAllocStats; }
+// Forward declaration of `BarkMaintenanceReport` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkMaintenanceReport; }
+// Forward declaration of `BarkRefreshPlan` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkRefreshPlan; }
+// Forward declaration of `BarkRefreshPlanOpts` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkRefreshPlanOpts; }
+// Forward declaration of `BarkRoundStatus` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkRoundStatus; }
+// Forward declaration of `BarkWalletEvent` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkWalletEvent; }
 // Forward declaration of `BarkArkInfo` to properly resolve imports.
 namespace margelo::nitro::nitroark { struct BarkArkInfo; }
 // Forward declaration of `OffchainBalanceResult` to properly resolve imports.
@@ -25,10 +47,28 @@ namespace margelo::nitro::nitroark { struct KeyPairResult; }
 namespace margelo::nitro::nitroark { struct NewAddressResult; }
 // Forward declaration of `BarkMovement` to properly resolve imports.
 namespace margelo::nitro::nitroark { struct BarkMovement; }
+// Forward declaration of `BarkHistoryPage` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkHistoryPage; }
+// Forward declaration of `BarkHistoryQuery` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkHistoryQuery; }
+// Forward declaration of `BarkHistoryExportProgress` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkHistoryExportProgress; }
+// Forward declaration of `BarkHistoryExportOpts` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkHistoryExportOpts; }
 // Forward declaration of `BarkVtxo` to properly resolve imports.
 namespace margelo::nitro::nitroark { struct BarkVtxo; }
+// Forward declaration of `WalletSnapshot` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct WalletSnapshot; }
+// Forward declaration of `DashboardSnapshot` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct DashboardSnapshot; }
 // Forward declaration of `OnchainBalanceResult` to properly resolve imports.
 namespace margelo::nitro::nitroark { struct OnchainBalanceResult; }
+// Forward declaration of `BarkOnchainSyncReport` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkOnchainSyncReport; }
+// Forward declaration of `BarkOnchainUtxo` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkOnchainUtxo; }
+// Forward declaration of `BarkOnchainUtxoFilter` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkOnchainUtxoFilter; }
 // Forward declaration of `OnchainPaymentResult` to properly resolve imports.
 namespace margelo::nitro::nitroark { struct OnchainPaymentResult; }
 // Forward declaration of `BarkSendManyOutput` to properly resolve imports.
@@ -37,30 +77,64 @@ namespace margelo::nitro::nitroark { struct BarkSendManyOutput; }
 namespace margelo::nitro::nitroark { struct BoardResult; }
 // Forward declaration of `ArkoorPaymentResult` to properly resolve imports.
 namespace margelo::nitro::nitroark { struct ArkoorPaymentResult; }
+// Forward declaration of `BarkParsedDestination` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkParsedDestination; }
+// Forward declaration of `ArkoorBatchResult` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct ArkoorBatchResult; }
 // Forward declaration of `LightningSendResult` to properly resolve imports.
 namespace margelo::nitro::nitroark { struct LightningSendResult; }
+// Forward declaration of `LightningBatchResult` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct LightningBatchResult; }
+// Forward declaration of `BarkLightningInvoicePayment` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkLightningInvoicePayment; }
 // Forward declaration of `Bolt11Invoice` to properly resolve imports.
 namespace margelo::nitro::nitroark { struct Bolt11Invoice; }
 // Forward declaration of `LightningReceive` to properly resolve imports.
 namespace margelo::nitro::nitroark { struct LightningReceive; }
 
+#include "BarkRuntimeOpts.hpp"
+#include "BarkLogOpts.hpp"
+#include "BarkCallOpts.hpp"
 #include <string>
 #include <NitroModules/Promise.hpp>
 #include "BarkCreateOpts.hpp"
+#include "BarkWalletOpenTimings.hpp"
+#include "BarkCallMetrics.hpp"
+#include "BarkAllocStats.hpp"
+#include <vector>
+#include "BarkMaintenanceReport.hpp"
+#include "BarkRefreshPlan.hpp"
+#include "BarkRefreshPlanOpts.hpp"
+#include "BarkRoundStatus.hpp"
+#include <optional>
+#include "BarkWalletEvent.hpp"
+#include <functional>
 #include "BarkArkInfo.hpp"
 #include "OffchainBalanceResult.hpp"
 #include "KeyPairResult.hpp"
 #include "NewAddressResult.hpp"
 #include "BarkMovement.hpp"
-#include <vector>
+#include "BarkHistoryPage.hpp"
+#include "BarkHistoryQuery.hpp"
+#include "BarkHistoryExportProgress.hpp"
+#include "BarkHistoryExportOpts.hpp"
 #include "BarkVtxo.hpp"
-#include <optional>
+#include <NitroModules/ArrayBuffer.hpp>
+#include "WalletSnapshot.hpp"
+#include "DashboardSnapshot.hpp"
 #include "OnchainBalanceResult.hpp"
+#include "BarkOnchainSyncReport.hpp"
+#include "BarkOnchainUtxo.hpp"
+#include "BarkOnchainUtxoFilter.hpp"
 #include "OnchainPaymentResult.hpp"
 #include "BarkSendManyOutput.hpp"
 #include "BoardResult.hpp"
 #include "ArkoorPaymentResult.hpp"
+#include "BarkParsedDestination.hpp"
+#include "ArkoorBatchResult.hpp"
 #include "LightningSendResult.hpp"
+#include "LightningBatchResult.hpp"
+#include "BarkLightningInvoicePayment.hpp"
 #include "Bolt11Invoice.hpp"
 #include "LightningReceive.hpp"
 #include <NitroModules/Null.hpp>
@@ -97,49 +171,88 @@ namespace margelo::nitro::nitroark {
 
     public:
       // Methods
+      virtual void configureRuntime(const BarkRuntimeOpts& opts) = 0;
+      virtual void configureLogging(const BarkLogOpts& opts) = 0;
+      virtual void setLogFilter(const std::string& filter) = 0;
+      virtual std::vector<std::string> dumpLogs() = 0;
+      virtual void clearLogs() = 0;
+      virtual double createCancelToken() = 0;
+      virtual bool cancelCall(double token) = 0;
+      virtual void releaseCancelToken(double token) = 0;
       virtual std::shared_ptr<Promise<std::string>> createMnemonic() = 0;
       virtual std::shared_ptr<Promise<void>> createWallet(const std::string& datadir, const BarkCreateOpts& opts) = 0;
       virtual std::shared_ptr<Promise<void>> loadWallet(const std::string& datadir, const BarkCreateOpts& config) = 0;
       virtual std::shared_ptr<Promise<bool>> isWalletLoaded() = 0;
+      virtual BarkWalletOpenTimings getWalletOpenTimings() = 0;
+      virtual void forgetCachedSeed() = 0;
+      virtual void setMetricsEnabled(bool enabled) = 0;
+      virtual std::vector<BarkCallMetrics> getMetrics() = 0;
+      virtual void resetMetrics() = 0;
+      virtual BarkAllocStats getAllocStats() = 0;
+      virtual void resetAllocStats() = 0;
+      virtual void setReadCoalesceWindow(double windowMs) = 0;
+      virtual void setArkInfoTtl(double ttlSecs) = 0;
       virtual std::shared_ptr<Promise<void>> closeWallet() = 0;
+      virtual std::shared_ptr<Promise<void>> closeWalletAt(const std::string& datadir) = 0;
+      virtual std::shared_ptr<Promise<void>> selectWallet(const std::string& datadir) = 0;
+      virtual std::shared_ptr<Promise<std::vector<std::string>>> openWallets() = 0;
       virtual std::shared_ptr<Promise<void>> refreshServer() = 0;
       virtual std::shared_ptr<Promise<void>> syncPendingBoards() = 0;
       virtual std::shared_ptr<Promise<void>> maintenance() = 0;
-      virtual std::shared_ptr<Promise<void>> maintenanceWithOnchain() = 0;
+      virtual std::shared_ptr<Promise<void>> maintenanceWithOnchain(const std::optional<BarkCallOpts>& opts) = 0;
       virtual std::shared_ptr<Promise<void>> maintenanceDelegated() = 0;
       virtual std::shared_ptr<Promise<void>> maintenanceWithOnchainDelegated() = 0;
       virtual std::shared_ptr<Promise<void>> maintenanceRefresh() = 0;
+      virtual std::shared_ptr<Promise<BarkMaintenanceReport>> maintenanceScheduled(const std::optional<std::vector<std::string>>& forceStages) = 0;
+      virtual std::shared_ptr<Promise<BarkRefreshPlan>> planRefresh(const std::optional<BarkRefreshPlanOpts>& opts) = 0;
+      virtual std::shared_ptr<Promise<std::optional<BarkRoundStatus>>> executeRefreshPlan(const std::vector<std::string>& vtxoIds) = 0;
       virtual std::shared_ptr<Promise<void>> sync() = 0;
-      virtual std::shared_ptr<Promise<void>> syncExits() = 0;
+      virtual std::shared_ptr<Promise<void>> syncExits(const std::optional<BarkCallOpts>& opts) = 0;
       virtual std::shared_ptr<Promise<void>> syncPendingRounds() = 0;
+      virtual void subscribeWalletEvents(const std::function<void(const std::vector<BarkWalletEvent>& /* events */)>& onEvents) = 0;
+      virtual void unsubscribeWalletEvents() = 0;
       virtual std::shared_ptr<Promise<BarkArkInfo>> getArkInfo() = 0;
       virtual std::shared_ptr<Promise<OffchainBalanceResult>> offchainBalance() = 0;
       virtual std::shared_ptr<Promise<KeyPairResult>> deriveStoreNextKeypair() = 0;
       virtual std::shared_ptr<Promise<KeyPairResult>> peakKeyPair(double index) = 0;
+      virtual std::shared_ptr<Promise<std::vector<KeyPairResult>>> peakKeyPairs(double start, double count) = 0;
       virtual std::shared_ptr<Promise<NewAddressResult>> peakAddress(double index) = 0;
+      virtual std::shared_ptr<Promise<std::vector<NewAddressResult>>> peakAddresses(double start, double count) = 0;
       virtual std::shared_ptr<Promise<NewAddressResult>> newAddress() = 0;
       virtual std::shared_ptr<Promise<std::string>> signMessage(const std::string& message, double index) = 0;
       virtual std::shared_ptr<Promise<std::string>> signMesssageWithMnemonic(const std::string& message, const std::string& mnemonic, const std::string& network, double index) = 0;
       virtual std::shared_ptr<Promise<KeyPairResult>> deriveKeypairFromMnemonic(const std::string& mnemonic, const std::string& network, double index) = 0;
+      virtual std::shared_ptr<Promise<std::vector<KeyPairResult>>> deriveKeypairsFromMnemonic(const std::string& mnemonic, const std::string& network, double start, double count) = 0;
       virtual std::shared_ptr<Promise<bool>> verifyMessage(const std::string& message, const std::string& signature, const std::string& publicKey) = 0;
       virtual std::shared_ptr<Promise<std::vector<BarkMovement>>> history() = 0;
+      virtual std::shared_ptr<Promise<BarkHistoryPage>> historyPage(const BarkHistoryQuery& query) = 0;
+      virtual std::shared_ptr<Promise<BarkHistoryExportProgress>> exportHistory(const std::string& path, const BarkHistoryExportOpts& opts, const std::function<void(const BarkHistoryExportProgress& /* progress */)>& onProgress, const std::optional<BarkCallOpts>& callOpts) = 0;
       virtual std::shared_ptr<Promise<std::vector<BarkVtxo>>> vtxos() = 0;
+      virtual std::shared_ptr<Promise<std::shared_ptr<ArrayBuffer>>> vtxosColumnar() = 0;
       virtual std::shared_ptr<Promise<std::optional<double>>> getFirstExpiringVtxoBlockheight() = 0;
       virtual std::shared_ptr<Promise<std::optional<double>>> getNextRequiredRefreshBlockheight() = 0;
       virtual std::shared_ptr<Promise<std::vector<BarkVtxo>>> getExpiringVtxos(double threshold) = 0;
+      virtual WalletSnapshot getCachedWalletSnapshot() = 0;
+      virtual std::shared_ptr<Promise<DashboardSnapshot>> dashboardSnapshot() = 0;
       virtual std::shared_ptr<Promise<OnchainBalanceResult>> onchainBalance() = 0;
       virtual std::shared_ptr<Promise<void>> onchainSync() = 0;
+      virtual std::shared_ptr<Promise<BarkOnchainSyncReport>> onchainSyncIncremental(std::optional<bool> force) = 0;
       virtual std::shared_ptr<Promise<std::string>> onchainListUnspent() = 0;
       virtual std::shared_ptr<Promise<std::string>> onchainUtxos() = 0;
+      virtual std::shared_ptr<Promise<std::vector<BarkOnchainUtxo>>> onchainUnspentOutputs(const std::optional<BarkOnchainUtxoFilter>& filter) = 0;
+      virtual std::shared_ptr<Promise<std::vector<BarkOnchainUtxo>>> onchainUtxoList(const std::optional<BarkOnchainUtxoFilter>& filter) = 0;
       virtual std::shared_ptr<Promise<std::string>> onchainAddress() = 0;
       virtual std::shared_ptr<Promise<OnchainPaymentResult>> onchainSend(const std::string& destination, double amountSat, std::optional<double> feeRate) = 0;
       virtual std::shared_ptr<Promise<std::string>> onchainDrain(const std::string& destination, std::optional<double> feeRate) = 0;
       virtual std::shared_ptr<Promise<std::string>> onchainSendMany(const std::vector<BarkSendManyOutput>& outputs, std::optional<double> feeRate) = 0;
       virtual std::shared_ptr<Promise<BoardResult>> boardAmount(double amountSat) = 0;
-      virtual std::shared_ptr<Promise<BoardResult>> boardAll() = 0;
+      virtual std::shared_ptr<Promise<BoardResult>> boardAll(const std::optional<BarkCallOpts>& opts) = 0;
+      virtual std::shared_ptr<Promise<BarkParsedDestination>> parseDestination(const std::string& destination, bool resolve) = 0;
       virtual std::shared_ptr<Promise<void>> validateArkoorAddress(const std::string& address) = 0;
       virtual std::shared_ptr<Promise<ArkoorPaymentResult>> sendArkoorPayment(const std::string& destination, double amountSat) = 0;
+      virtual std::shared_ptr<Promise<std::vector<ArkoorBatchResult>>> sendArkoorMany(const std::vector<BarkSendManyOutput>& outputs) = 0;
       virtual std::shared_ptr<Promise<LightningSendResult>> payLightningInvoice(const std::string& destination, std::optional<double> amountSat) = 0;
+      virtual std::shared_ptr<Promise<std::vector<LightningBatchResult>>> payLightningInvoices(const std::vector<BarkLightningInvoicePayment>& payments) = 0;
       virtual std::shared_ptr<Promise<LightningSendResult>> payLightningOffer(const std::string& offer, std::optional<double> amountSat) = 0;
       virtual std::shared_ptr<Promise<LightningSendResult>> payLightningAddress(const std::string& addr, double amountSat, const std::string& comment) = 0;
       virtual std::shared_ptr<Promise<std::string>> sendOnchain(const std::string& destination, double amountSat) = 0;
@@ -148,8 +261,9 @@ namespace margelo::nitro::nitroark {
       virtual std::shared_ptr<Promise<std::variant<nitro::NullType, std::string>>> checkLightningPayment(const std::string& paymentHash, bool wait) = 0;
       virtual std::shared_ptr<Promise<LightningReceive>> tryClaimLightningReceive(const std::string& paymentHash, bool wait, const std::optional<std::string>& token) = 0;
       virtual std::shared_ptr<Promise<void>> tryClaimAllLightningReceives(bool wait) = 0;
+      virtual double cancelLightningWait(const std::string& paymentHash) = 0;
       virtual std::shared_ptr<Promise<std::string>> offboardSpecific(const std::vector<std::string>& vtxoIds, const std::string& destinationAddress) = 0;
-      virtual std::shared_ptr<Promise<std::string>> offboardAll(const std::string& destinationAddress) = 0;
+      virtual std::shared_ptr<Promise<std::string>> offboardAll(const std::string& destinationAddress, const std::optional<BarkCallOpts>& opts) = 0;
 
     protected:
       // Hybrid Setup
@@ -0,0 +1,94 @@
+///
+/// LightningBatchResult.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `LightningSendResult` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct LightningSendResult; }
+
+#include <string>
+#include <optional>
+#include "LightningSendResult.hpp"
+
+namespace margelo::nitro::nitroark {
+
+  /**
+   * A struct which can be represented as a JavaScript object (LightningBatchResult).
+   */
+  struct LightningBatchResult final {
+  public:
+    std::string invoice     SWIFT_PRIVATE;
+    std::optional<LightningSendResult> payment     SWIFT_PRIVATE;
+    std::optional<std::string> error     SWIFT_PRIVATE;
+
+  public:
+    LightningBatchResult() = default;
+    explicit LightningBatchResult(std::string invoice, std::optional<LightningSendResult> payment, std::optional<std::string> error): invoice(invoice), payment(payment), error(error) {}
+
+  public:
+    friend bool operator==(const LightningBatchResult& lhs, const LightningBatchResult& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroark
+
+namespace margelo::nitro {
+
+  // C++ LightningBatchResult <> JS LightningBatchResult (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroark::LightningBatchResult> final {
+    static inline margelo::nitro::nitroark::LightningBatchResult fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroark::LightningBatchResult(
+        JSIConverter<std::string>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "invoice"))),
+        JSIConverter<std::optional<margelo::nitro::nitroark::LightningSendResult>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "payment"))),
+        JSIConverter<std::optional<std::string>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "error")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroark::LightningBatchResult& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "invoice"), JSIConverter<std::string>::toJSI(runtime, arg.invoice));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "payment"), JSIConverter<std::optional<margelo::nitro::nitroark::LightningSendResult>>::toJSI(runtime, arg.payment));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "error"), JSIConverter<std::optional<std::string>>::toJSI(runtime, arg.error));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<std::string>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "invoice")))) return false;
+      if (!JSIConverter<std::optional<margelo::nitro::nitroark::LightningSendResult>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "payment")))) return false;
+      if (!JSIConverter<std::optional<std::string>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "error")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,108 @@
+///
+/// WalletSnapshot.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `OffchainBalanceResult` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct OffchainBalanceResult; }
+// Forward declaration of `OnchainBalanceResult` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct OnchainBalanceResult; }
+// Forward declaration of `BarkVtxo` to properly resolve imports.
+namespace margelo::nitro::nitroark { struct BarkVtxo; }
+
+#include "OffchainBalanceResult.hpp"
+#include <optional>
+#include "OnchainBalanceResult.hpp"
+#include "BarkVtxo.hpp"
+#include <vector>
+
+namespace margelo::nitro::nitroark {
+
+  /**
+   * A struct which can be represented as a JavaScript object (WalletSnapshot).
+   */
+  struct WalletSnapshot final {
+  public:
+    std::optional<OffchainBalanceResult> offchain_balance     SWIFT_PRIVATE;
+    std::optional<OnchainBalanceResult> onchain_balance     SWIFT_PRIVATE;
+    std::optional<std::vector<BarkVtxo>> vtxos     SWIFT_PRIVATE;
+    bool has_first_expiring_vtxo_blockheight     SWIFT_PRIVATE;
+    std::optional<double> first_expiring_vtxo_blockheight     SWIFT_PRIVATE;
+
+  public:
+    WalletSnapshot() = default;
+    explicit WalletSnapshot(std::optional<OffchainBalanceResult> offchain_balance, std::optional<OnchainBalanceResult> onchain_balance, std::optional<std::vector<BarkVtxo>> vtxos, bool has_first_expiring_vtxo_blockheight, std::optional<double> first_expiring_vtxo_blockheight): offchain_balance(offchain_balance), onchain_balance(onchain_balance), vtxos(vtxos), has_first_expiring_vtxo_blockheight(has_first_expiring_vtxo_blockheight), first_expiring_vtxo_blockheight(first_expiring_vtxo_blockheight) {}
+
+  public:
+    friend bool operator==(const WalletSnapshot& lhs, const WalletSnapshot& rhs) = default;
+  };
+
+} // namespace margelo::nitro::nitroark
+
+namespace margelo::nitro {
+
+  // C++ WalletSnapshot <> JS WalletSnapshot (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitroark::WalletSnapshot> final {
+    static inline margelo::nitro::nitroark::WalletSnapshot fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitroark::WalletSnapshot(
+        JSIConverter<std::optional<margelo::nitro::nitroark::OffchainBalanceResult>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "offchain_balance"))),
+        JSIConverter<std::optional<margelo::nitro::nitroark::OnchainBalanceResult>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "onchain_balance"))),
+        JSIConverter<std::optional<std::vector<margelo::nitro::nitroark::BarkVtxo>>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "vtxos"))),
+        JSIConverter<bool>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "has_first_expiring_vtxo_blockheight"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "first_expiring_vtxo_blockheight")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitroark::WalletSnapshot& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "offchain_balance"), JSIConverter<std::optional<margelo::nitro::nitroark::OffchainBalanceResult>>::toJSI(runtime, arg.offchain_balance));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "onchain_balance"), JSIConverter<std::optional<margelo::nitro::nitroark::OnchainBalanceResult>>::toJSI(runtime, arg.onchain_balance));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "vtxos"), JSIConverter<std::optional<std::vector<margelo::nitro::nitroark::BarkVtxo>>>::toJSI(runtime, arg.vtxos));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "has_first_expiring_vtxo_blockheight"), JSIConverter<bool>::toJSI(runtime, arg.has_first_expiring_vtxo_blockheight));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "first_expiring_vtxo_blockheight"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.first_expiring_vtxo_blockheight));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<std::optional<margelo::nitro::nitroark::OffchainBalanceResult>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "offchain_balance")))) return false;
+      if (!JSIConverter<std::optional<margelo::nitro::nitroark::OnchainBalanceResult>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "onchain_balance")))) return false;
+      if (!JSIConverter<std::optional<std::vector<margelo::nitro::nitroark::BarkVtxo>>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "vtxos")))) return false;
+      if (!JSIConverter<bool>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "has_first_expiring_vtxo_blockheight")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "first_expiring_vtxo_blockheight")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -16,6 +16,16 @@ export interface BarkConfigOpts {
   htlc_recv_claim_delta: number;
   vtxo_exit_margin: number;
   round_tx_required_confirmations: number;
+  storage?: BarkStorageOpts;
+}
+
+// SQLite settings of the wallet database, omitted fields keep the default
+export interface BarkStorageOpts {
+  journal_mode?: string; // 'wal' (default) | 'delete' | 'truncate'
+  synchronous?: string; // 'off' | 'normal' | 'full' (default) | 'extra'
+  mmap_size?: number; // bytes, 0 disables memory mapping
+  cache_size_kib?: number;
+  page_size?: number; // only applied when the wallet is created
 }
 
 export interface BarkCreateOpts {
@@ -27,6 +37,28 @@ export interface BarkCreateOpts {
   config?: BarkConfigOpts;
 }
 
+// Sizing of the native runtime. Unset fields keep the default, which is one
+// worker thread per core.
+// Limits for boardAll, offboardAll, maintenanceWithOnchain and syncExits
+export interface BarkCallOpts {
+  cancel_token?: number; // From createCancelToken
+  timeout_ms?: number;
+}
+
+export interface BarkLogOpts {
+  filter?: string; // e.g. 'info,bark=warn,bark_cpp::events=debug', defaults to info in release builds
+  ring_buffer_lines?: number; // lines kept for dumpLogs, 0 (the default) disables the buffer
+  ring_buffer_level?: string; // 'error' | 'warn' | 'info' | 'debug' | 'trace', defaults to debug
+}
+
+export interface BarkRuntimeOpts {
+  worker_threads?: number;
+  current_thread?: boolean; // run all work on a single runtime thread
+  thread_stack_size?: number; // bytes
+  max_blocking_threads?: number;
+  blocking_keep_alive_ms?: number;
+}
+
 export interface BarkArkInfo {
   network: string;
   server_pubkey: string;
@@ -81,6 +113,40 @@ export interface LightningSendResult {
   preimage: string | null;
 }
 
+// A destination recognised by parseDestination. The `lnurl_` fields are set
+// for a lightning address resolved with `resolve`
+export interface BarkParsedDestination {
+  kind: string; // 'ark' | 'bolt11' | 'bolt12_invoice' | 'bolt12_offer' | 'lightning_address' | 'onchain'
+  amount_msat?: number; // Amount requested by the invoice
+  expires_at?: number; // Unix seconds
+  expired: boolean;
+  lnurl_min_sendable_msat?: number;
+  lnurl_max_sendable_msat?: number;
+  lnurl_comment_allowed?: number; // Longest accepted comment, 0 if none
+  lnurl_description?: string;
+}
+
+// Outcome of one output of sendArkoorMany, `error` is set if it failed
+export interface ArkoorBatchResult {
+  destination: string;
+  amount_sat: number; // u64
+  vtxos: BarkVtxo[];
+  error?: string;
+}
+
+export interface BarkLightningInvoicePayment {
+  invoice: string;
+  amountSat?: number; // Omit to pay the invoice amount
+}
+
+// Outcome of one invoice of payLightningInvoices, exactly one of `payment`
+// and `error` is set
+export interface LightningBatchResult {
+  invoice: string;
+  payment?: LightningSendResult;
+  error?: string;
+}
+
 export interface OnchainPaymentResult {
   txid: string; // Transaction ID
   amount_sat: number; // Amount in satoshis
@@ -106,6 +172,18 @@ export interface OnchainBalanceResult {
   confirmed: number;
 }
 
+export interface BarkOnchainUtxo {
+  outpoint: string; // txid:vout
+  amount_sat: number; // u64
+  confirmation_height: number; // u32, 0 while unconfirmed
+  kind: string; // external or internal output, local or exit utxo
+}
+
+export interface BarkOnchainUtxoFilter {
+  min_amount_sat?: number; // Skips smaller outputs
+  confirmed_only?: boolean;
+}
+
 export interface NewAddressResult {
   user_pubkey: string;
   ark_id: string;
@@ -154,32 +232,217 @@ export interface BarkMovement {
   completed_at?: string;
 }
 
+export interface BarkHistoryQuery {
+  cursor?: number; // next_cursor of the previous page, omit for the newest
+  limit?: number; // defaults to 50
+  status?: string; // 'pending' | 'finished' | 'failed' | 'cancelled'
+  subsystem_kind?: string;
+  created_after?: number; // unix seconds, inclusive
+  created_before?: number; // unix seconds, exclusive
+  include_metadata?: boolean; // defaults to false, metadata_json is empty otherwise
+}
+
+export interface BarkHistoryPage {
+  movements: BarkMovement[];
+  next_cursor?: number;
+  has_more: boolean;
+}
+
+export interface BarkHistoryExportOpts {
+  format: string; // 'csv' | 'jsonl'
+  query?: BarkHistoryQuery; // limit defaults to every matching movement
+  chunk_size?: number; // movements read and written between progress reports, defaults to 500
+}
+
+export interface BarkHistoryExportProgress {
+  written: number; // the total is only known once done, as pages are read one by one
+  done: boolean; // the file is complete at its final path
+}
+
+export interface BarkWalletEvent {
+  kind: string; // 'movement_created' | 'movement_updated' | 'vtxo_state_changed' | 'round_status' | 'lightning_receive_settled' | 'onchain_sync'
+  id: string; // movement id, vtxo id, round funding txid, payment hash or 'onchain'
+  status: string; // new movement status, vtxo state, round status or 'started' | 'skipped' | 'finished' | 'failed' for syncs
+  detail: string; // previous status for movements and vtxos, the error for rounds, 'checkpoint:tip' for syncs
+}
+
+export interface BarkOnchainSyncReport {
+  skipped: boolean; // nothing changed since the last sync
+  from_height: number; // tip of the previous sync, 0 if there was none
+  tip_height: number;
+  duration_ms: number;
+}
+
+// Summary of a scheduled maintenance pass. Stages are 'sync' | 'onchain' |
+// 'boards' | 'rounds' | 'exits' | 'refresh'.
+export interface BarkMaintenanceReport {
+  ran: string[]; // stages that ran, including failed ones
+  skipped: string[]; // stages that had nothing to do
+  failed: string[];
+  errors: string[]; // one entry per failed stage, prefixed with the stage name
+  coalesced: boolean; // joined a pass another caller started
+  duration_ms: number;
+}
+
+export interface BarkRefreshPlanOpts {
+  horizonBlocks?: number; // blocks past the first due VTXO that join its round, default 144
+  foldDust?: boolean; // default true
+  dustLimitSat?: number; // default 330
+}
+
+export interface BarkPlannedVtxo {
+  id: string;
+  amount_sat: number; // u64
+  expiry_height: number; // u32
+  reason: string; // 'due' | 'horizon' | 'dust'
+}
+
+// The next refresh round for the spendable VTXOs
+export interface BarkRefreshPlan {
+  tip: number;
+  round_blocks: number; // blocks between two rounds
+  refresh_by?: number; // height the round has to happen by, unset if empty
+  due_now: boolean; // waiting for a later round would pass the threshold
+  vtxos: BarkPlannedVtxo[];
+  total_sat: number; // u64
+  next_refresh_by?: number; // next round needed for the VTXOs left out
+}
+
+export interface BarkRoundStatus {
+  status: string; // 'confirmed' | 'unconfirmed' | 'pending' | 'failed' | 'canceled'
+  funding_txid?: string;
+  unsigned_funding_txids: string[];
+  error?: string;
+  is_final: boolean;
+  is_success: boolean;
+}
+
+// Phases of the most recent wallet open in this process
+export interface BarkWalletOpenTimings {
+  recorded: boolean; // false until a wallet was opened
+  db_open_ms: number;
+  read_properties_ms: number;
+  seed_ms: number;
+  seed_cached: boolean; // seed reused from an earlier open
+  onchain_load_ms: number;
+  wallet_open_ms: number; // includes the server handshake
+  total_ms: number;
+}
+
+// Latency samples of one call phase. Bucket i counts samples below 2^i
+// microseconds, the last bucket everything above.
+export interface BarkLatencyHistogram {
+  count: number;
+  sum_us: number;
+  max_us: number;
+  buckets: number[];
+}
+
+// Latency of one bridge function, split by phase
+export interface BarkCallMetrics {
+  name: string; // bridge function, e.g. 'offchain_balance'
+  queue_wait: BarkLatencyHistogram; // until a native thread picked it up
+  lock_wait: BarkLatencyHistogram; // waiting for the wallet locks
+  execution: BarkLatencyHistogram;
+  conversion: BarkLatencyHistogram; // converting arguments and results
+}
+
+export interface BarkSubsystemAllocStats {
+  name: string; // 'bridge' | 'wallet' | 'runtime' | 'sqlite'
+  current_bytes: number;
+  peak_bytes: number; // since the last reset
+  allocations: number; // since the last reset, 0 for sqlite
+}
+
+// Allocations made by one bridge function while its future ran
+export interface BarkCallAllocStats {
+  name: string;
+  calls: number;
+  allocations: number;
+  bytes: number;
+}
+
+export interface BarkAllocStats {
+  enabled: boolean; // false unless built with the alloc-profiling feature
+  subsystems: BarkSubsystemAllocStats[];
+  calls: BarkCallAllocStats[];
+}
+
+// Cached wallet state, served without touching the database. Fields are only
+// present once the matching getter has been called since the last mutation.
+export interface WalletSnapshot {
+  offchain_balance?: OffchainBalanceResult;
+  onchain_balance?: OnchainBalanceResult;
+  vtxos?: BarkVtxo[];
+  // True when the first expiring height is cached, even if there is none
+  has_first_expiring_vtxo_blockheight: boolean;
+  first_expiring_vtxo_blockheight?: number;
+}
+
+// Everything the wallet overview shows, read from the wallet in one call
+export interface DashboardSnapshot {
+  offchain_balance: OffchainBalanceResult;
+  onchain_balance: OnchainBalanceResult;
+  ark_info?: BarkArkInfo; // Missing until the server info is known
+  next_required_refresh_blockheight?: number;
+  vtxos: BarkVtxo[];
+}
+
 // --- Nitro Module Interface ---
 
 export interface NitroArk extends HybridObject<{ ios: 'c++'; android: 'c++' }> {
   // --- Management ---
+  configureRuntime(opts: BarkRuntimeOpts): void; // Synchronous
+  configureLogging(opts: BarkLogOpts): void; // Synchronous
+  setLogFilter(filter: string): void; // Synchronous
+  dumpLogs(): string[]; // Synchronous
+  clearLogs(): void; // Synchronous
+  createCancelToken(): number; // Synchronous
+  cancelCall(token: number): boolean; // Synchronous
+  releaseCancelToken(token: number): void; // Synchronous
   createMnemonic(): Promise<string>;
   createWallet(datadir: string, opts: BarkCreateOpts): Promise<void>;
   loadWallet(datadir: string, config: BarkCreateOpts): Promise<void>;
   isWalletLoaded(): Promise<boolean>;
+  getWalletOpenTimings(): BarkWalletOpenTimings; // Synchronous
+  forgetCachedSeed(): void; // Synchronous
+  setMetricsEnabled(enabled: boolean): void; // Synchronous
+  getMetrics(): BarkCallMetrics[]; // Synchronous
+  resetMetrics(): void; // Synchronous
+  getAllocStats(): BarkAllocStats; // Synchronous
+  resetAllocStats(): void; // Synchronous
+  setReadCoalesceWindow(windowMs: number): void; // Synchronous
+  setArkInfoTtl(ttlSecs: number): void; // Synchronous
   closeWallet(): Promise<void>;
+  closeWalletAt(datadir: string): Promise<void>;
+  selectWallet(datadir: string): Promise<void>;
+  openWallets(): Promise<string[]>;
   refreshServer(): Promise<void>;
   syncPendingBoards(): Promise<void>;
   maintenance(): Promise<void>;
-  maintenanceWithOnchain(): Promise<void>;
+  maintenanceWithOnchain(opts?: BarkCallOpts): Promise<void>;
   maintenanceDelegated(): Promise<void>;
   maintenanceWithOnchainDelegated(): Promise<void>;
   maintenanceRefresh(): Promise<void>;
+  maintenanceScheduled(forceStages?: string[]): Promise<BarkMaintenanceReport>;
+  planRefresh(opts?: BarkRefreshPlanOpts): Promise<BarkRefreshPlan>;
+  executeRefreshPlan(vtxoIds: string[]): Promise<BarkRoundStatus | undefined>;
   sync(): Promise<void>;
-  syncExits(): Promise<void>;
+  syncExits(opts?: BarkCallOpts): Promise<void>;
   syncPendingRounds(): Promise<void>;
 
+  // --- Events ---
+  subscribeWalletEvents(onEvents: (events: BarkWalletEvent[]) => void): void;
+  unsubscribeWalletEvents(): void;
+
   // --- Wallet Info ---
   getArkInfo(): Promise<BarkArkInfo>;
   offchainBalance(): Promise<OffchainBalanceResult>;
   deriveStoreNextKeypair(): Promise<KeyPairResult>;
   peakKeyPair(index: number): Promise<KeyPairResult>;
+  peakKeyPairs(start: number, count: number): Promise<KeyPairResult[]>;
   peakAddress(index: number): Promise<NewAddressResult>;
+  peakAddresses(start: number, count: number): Promise<NewAddressResult[]>;
   newAddress(): Promise<NewAddressResult>;
   signMessage(message: string, index: number): Promise<string>;
   signMesssageWithMnemonic(
@@ -193,22 +456,43 @@ export interface NitroArk extends HybridObject<{ ios: 'c++'; android: 'c++' }> {
     network: string,
     index: number
   ): Promise<KeyPairResult>;
+  deriveKeypairsFromMnemonic(
+    mnemonic: string,
+    network: string,
+    start: number,
+    count: number
+  ): Promise<KeyPairResult[]>;
   verifyMessage(
     message: string,
     signature: string,
     publicKey: string
   ): Promise<boolean>;
   history(): Promise<BarkMovement[]>;
+  historyPage(query: BarkHistoryQuery): Promise<BarkHistoryPage>;
+  exportHistory(
+    path: string,
+    opts: BarkHistoryExportOpts,
+    onProgress: (progress: BarkHistoryExportProgress) => void,
+    callOpts?: BarkCallOpts
+  ): Promise<BarkHistoryExportProgress>;
   vtxos(): Promise<BarkVtxo[]>;
+  vtxosColumnar(): Promise<ArrayBuffer>; // Layout in bark-cpp/src/columnar.rs
   getFirstExpiringVtxoBlockheight(): Promise<number | undefined>;
   getNextRequiredRefreshBlockheight(): Promise<number | undefined>;
   getExpiringVtxos(threshold: number): Promise<BarkVtxo[]>;
+  getCachedWalletSnapshot(): WalletSnapshot; // Synchronous
+  dashboardSnapshot(): Promise<DashboardSnapshot>;
 
   // --- Onchain Operations ---
   onchainBalance(): Promise<OnchainBalanceResult>;
   onchainSync(): Promise<void>;
+  onchainSyncIncremental(force?: boolean): Promise<BarkOnchainSyncReport>;
   onchainListUnspent(): Promise<string>; // Returns JSON string
   onchainUtxos(): Promise<string>; // Returns JSON string
+  onchainUnspentOutputs(
+    filter?: BarkOnchainUtxoFilter
+  ): Promise<BarkOnchainUtxo[]>;
+  onchainUtxoList(filter?: BarkOnchainUtxoFilter): Promise<BarkOnchainUtxo[]>;
   onchainAddress(): Promise<string>; // Returns address string
   onchainSend(
     destination: string,
@@ -229,16 +513,24 @@ export interface NitroArk extends HybridObject<{ ios: 'c++'; android: 'c++' }> {
 
   // --- Ark & Lightning Payments ---
   boardAmount(amountSat: number): Promise<BoardResult>; // Returns JSON status
-  boardAll(): Promise<BoardResult>; // Returns JSON status
+  boardAll(opts?: BarkCallOpts): Promise<BoardResult>; // Returns JSON status
+  parseDestination(
+    destination: string,
+    resolve: boolean
+  ): Promise<BarkParsedDestination>;
   validateArkoorAddress(address: string): Promise<void>;
   sendArkoorPayment(
     destination: string,
     amountSat: number
   ): Promise<ArkoorPaymentResult>;
+  sendArkoorMany(outputs: BarkSendManyOutput[]): Promise<ArkoorBatchResult[]>;
   payLightningInvoice(
     destination: string,
     amountSat?: number
   ): Promise<LightningSendResult>;
+  payLightningInvoices(
+    payments: BarkLightningInvoicePayment[]
+  ): Promise<LightningBatchResult[]>;
   payLightningOffer(
     offer: string,
     amountSat?: number
@@ -265,11 +557,15 @@ export interface NitroArk extends HybridObject<{ ios: 'c++'; android: 'c++' }> {
     token?: string
   ): Promise<LightningReceive>; // Throws on error
   tryClaimAllLightningReceives(wait: boolean): Promise<void>; // Throws on error
+  cancelLightningWait(paymentHash: string): number; // Synchronous
 
   // --- Offboarding / Exiting ---
   offboardSpecific(
     vtxoIds: string[],
     destinationAddress: string
   ): Promise<string>;
-  offboardAll(destinationAddress: string): Promise<string>;
+  offboardAll(
+    destinationAddress: string,
+    opts?: BarkCallOpts
+  ): Promise<string>;
 }
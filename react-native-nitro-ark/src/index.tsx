@@ -2,11 +2,16 @@ import { NitroModules } from 'react-native-nitro-modules';
 import type {
   NitroArk,
   BarkCreateOpts,
+  BarkStorageOpts,
   BarkArkInfo,
   Bolt11Invoice,
   BarkSendManyOutput,
   ArkoorPaymentResult,
+  ArkoorBatchResult,
+  BarkParsedDestination,
   LightningSendResult,
+  BarkLightningInvoicePayment,
+  LightningBatchResult,
   OnchainPaymentResult,
   OffchainBalanceResult,
   OnchainBalanceResult,
@@ -16,6 +21,27 @@ import type {
   BarkMovement as NitroBarkMovement,
   BarkMovementDestination as NitroBarkMovementDestination,
   BoardResult,
+  WalletSnapshot as NitroWalletSnapshot,
+  DashboardSnapshot as NitroDashboardSnapshot,
+  BarkHistoryQuery,
+  BarkHistoryPage as NitroBarkHistoryPage,
+  BarkHistoryExportOpts,
+  BarkHistoryExportProgress,
+  BarkWalletEvent,
+  BarkOnchainUtxo,
+  BarkOnchainUtxoFilter,
+  BarkOnchainSyncReport,
+  BarkMaintenanceReport,
+  BarkRefreshPlanOpts,
+  BarkRefreshPlan,
+  BarkRoundStatus,
+  BarkWalletOpenTimings,
+  BarkLatencyHistogram,
+  BarkCallMetrics,
+  BarkAllocStats,
+  BarkRuntimeOpts,
+  BarkLogOpts,
+  BarkCallOpts,
 } from './NitroArk.nitro';
 
 export type BarkVtxo = {
@@ -47,12 +73,106 @@ export type BarkMovement = NitroBarkMovement & {
   received_on: BarkMovementDestination[];
 };
 
+export type BarkHistoryPage = NitroBarkHistoryPage & {
+  movements: BarkMovement[];
+};
+
+export type WalletSnapshot = NitroWalletSnapshot & {
+  vtxos?: BarkVtxo[];
+};
+
+export type DashboardSnapshot = NitroDashboardSnapshot & {
+  vtxos: BarkVtxo[];
+};
+
 // Create the hybrid object instance
 export const NitroArkHybridObject =
   NitroModules.createHybridObject<NitroArk>('NitroArk');
 
 // --- Management ---
 
+/**
+ * Sets how many native threads the wallet runtime uses. The runtime starts
+ * with the first wallet call, so this must be called before that, e.g. before
+ * `loadWallet`. On phones a couple of workers, or `current_thread`, avoid
+ * keeping one idle thread per core around.
+ * @param opts The runtime sizing, unset fields keep the default.
+ * @throws If the runtime is already running.
+ */
+export function configureRuntime(opts: BarkRuntimeOpts): void {
+  NitroArkHybridObject.configureRuntime(opts);
+}
+
+/**
+ * Sets which log records reach the system log and whether recent records are
+ * kept in memory. Can be called at any time, before or after loading a wallet.
+ * @param opts `filter` takes directives like `'info,bark=warn'`: a bare level
+ * sets the default, `module=level` overrides it for that module. Set
+ * `ring_buffer_lines` to keep that many recent lines for `dumpLogs`.
+ * @throws If the filter or level can't be parsed.
+ */
+export function configureLogging(opts: BarkLogOpts): void {
+  NitroArkHybridObject.configureLogging(opts);
+}
+
+/**
+ * Replaces the log filter, keeping the ring buffer settings.
+ * @param filter Directives like `'debug'` or `'info,bark_cpp::events=trace'`.
+ * @throws If the filter can't be parsed.
+ */
+export function setLogFilter(filter: string): void {
+  NitroArkHybridObject.setLogFilter(filter);
+}
+
+/**
+ * Lines held by the log ring buffer, oldest first. Empty unless enabled with
+ * `configureLogging`.
+ * @returns The buffered log lines.
+ */
+export function dumpLogs(): string[] {
+  return NitroArkHybridObject.dumpLogs();
+}
+
+/**
+ * Empties the log ring buffer.
+ */
+export function clearLogs(): void {
+  NitroArkHybridObject.clearLogs();
+}
+
+/**
+ * Creates a token for stopping `boardAll`, `offboardAll`,
+ * `maintenanceWithOnchain`, `syncExits` or `exportHistory` early, e.g. when the screen is left
+ * or the app is about to be suspended. One token can be shared by several
+ * calls.
+ * @returns The token, to pass as `cancel_token`.
+ */
+export function createCancelToken(): number {
+  return NitroArkHybridObject.createCancelToken();
+}
+
+/**
+ * Cancels the calls running with `token` and every later call using it. A
+ * cancelled call rejects and releases the wallet. Boarding and offboarding
+ * can only be cancelled until they start moving funds; after that they
+ * finish normally. Maintenance stops after the stage it is running. Exit
+ * syncing can only be cancelled until exits start being progressed. A
+ * history export stops at once and removes its partial file.
+ * @param token A token from `createCancelToken`.
+ * @returns False if the token is unknown.
+ */
+export function cancelCall(token: number): boolean {
+  return NitroArkHybridObject.cancelCall(token);
+}
+
+/**
+ * Forgets a token once no call uses it anymore.
+ * @param token A token from `createCancelToken`.
+ */
+export function releaseCancelToken(token: number): void {
+  NitroArkHybridObject.releaseCancelToken(token);
+}
+
 /**
  * Creates a new BIP39 mnemonic phrase.
  * @returns A promise resolving to the mnemonic string.
@@ -76,7 +196,9 @@ export function createWallet(
 
 /**
  * Loads an existing wallet or creates a new one at the specified directory.
- * Once loaded, the wallet state is managed internally.
+ * Once loaded, the wallet state is managed internally and it becomes the
+ * active wallet. Wallets loaded before stay open, loading one of them again
+ * only makes it active.
  * @param datadir Path to the data directory.
  * @param config The configuration options for the wallet.
  * @returns A promise that resolves on success or rejects on error.
@@ -90,12 +212,41 @@ export function loadWallet(
 
 /**
  * Closes the currently loaded wallet, clearing its state from memory.
+ * Other wallets opened with {@link loadWallet} stay open, but none of them
+ * is active until selected with {@link selectWallet}.
  * @returns A promise that resolves on success or rejects on error.
  */
 export function closeWallet(): Promise<void> {
   return NitroArkHybridObject.closeWallet();
 }
 
+/**
+ * Closes the open wallet in the given data directory, active or not.
+ * @param datadir Path to the data directory of the wallet.
+ * @returns A promise that resolves on success or rejects on error.
+ */
+export function closeWalletAt(datadir: string): Promise<void> {
+  return NitroArkHybridObject.closeWalletAt(datadir);
+}
+
+/**
+ * Makes an already open wallet the one all other calls act on. Switching
+ * does not reopen the wallet, so it is instant.
+ * @param datadir Path to the data directory of a wallet opened with {@link loadWallet}.
+ * @returns A promise that resolves on success or rejects if no wallet is open there.
+ */
+export function selectWallet(datadir: string): Promise<void> {
+  return NitroArkHybridObject.selectWallet(datadir);
+}
+
+/**
+ * Lists the data directories of the open wallets.
+ * @returns A promise resolving to the data directories, the active wallet first.
+ */
+export function openWallets(): Promise<string[]> {
+  return NitroArkHybridObject.openWallets();
+}
+
 /**
  * Refreshes the server state.
  * @returns A promise that resolves on success or rejects on error.
@@ -112,6 +263,119 @@ export function isWalletLoaded(): Promise<boolean> {
   return NitroArkHybridObject.isWalletLoaded();
 }
 
+/**
+ * Returns how long each phase of the most recent wallet open took, to tell
+ * database, key derivation and server handshake time apart.
+ * @returns The timings, with `recorded` false if no wallet was opened yet.
+ */
+export function getWalletOpenTimings(): BarkWalletOpenTimings {
+  return NitroArkHybridObject.getWalletOpenTimings();
+}
+
+/**
+ * Wipes the seed kept in memory to speed up reopening the same wallet. Call
+ * this when the wallet is removed or the user signs out.
+ */
+export function forgetCachedSeed(): void {
+  NitroArkHybridObject.forgetCachedSeed();
+}
+
+/**
+ * Turns per-call latency metrics on or off. They are off by default; while
+ * off, the bridge skips all timing.
+ * @param enabled Whether to record metrics.
+ */
+export function setMetricsEnabled(enabled: boolean): void {
+  NitroArkHybridObject.setMetricsEnabled(enabled);
+}
+
+/**
+ * Returns latency histograms per bridge function, split into queue wait, lock
+ * wait, execution and conversion time, for calls made since metrics were
+ * enabled or last reset.
+ * @returns One entry per bridge function that was called, sorted by name.
+ */
+export function getMetrics(): BarkCallMetrics[] {
+  return NitroArkHybridObject.getMetrics();
+}
+
+/**
+ * Clears all recorded metrics.
+ */
+export function resetMetrics(): void {
+  NitroArkHybridObject.resetMetrics();
+}
+
+/**
+ * Returns how much native memory the library holds, per subsystem: `wallet`
+ * for work done by bridge calls, `runtime` for background tasks, `bridge` for
+ * converting arguments and results, and `sqlite` for the database cache. Also
+ * counts the allocations each bridge function made. Everything except
+ * `sqlite` requires a build with the `alloc-profiling` Cargo feature, see
+ * `enabled`.
+ * @returns Current and peak bytes per subsystem and allocations per call.
+ */
+export function getAllocStats(): BarkAllocStats {
+  return NitroArkHybridObject.getAllocStats();
+}
+
+/**
+ * Lowers the peaks to the current usage and clears the allocation counts.
+ */
+export function resetAllocStats(): void {
+  NitroArkHybridObject.resetAllocStats();
+}
+
+/**
+ * Calls to `sync`, `refreshServer`, `maintenance` and `getArkInfo` that
+ * overlap an identical call already in flight share its result instead of
+ * repeating the work. This sets how long a finished `getArkInfo` result is
+ * also handed to later calls.
+ * @param windowMs Freshness window in milliseconds, 0 (the default) to only
+ * share results between overlapping calls.
+ */
+export function setReadCoalesceWindow(windowMs: number): void {
+  NitroArkHybridObject.setReadCoalesceWindow(windowMs);
+}
+
+/**
+ * Sets how long the Ark server info returned by {@link getArkInfo} and used
+ * by send, offboard and refresh calls is cached. Older info is still returned
+ * while a fresh copy is fetched in the background, reconnecting to the server
+ * if needed. The cache is dropped by {@link refreshServer} and when the
+ * active wallet changes.
+ * @param ttlSecs Age in seconds after which the info is revalidated, 300 by
+ * default. 0 disables the cache.
+ */
+export function setArkInfoTtl(ttlSecs: number): void {
+  NitroArkHybridObject.setArkInfoTtl(ttlSecs);
+}
+
+/**
+ * Estimates a percentile from a latency histogram, as the upper bound of the
+ * bucket that contains it.
+ * @param histogram The histogram to read.
+ * @param percentile The percentile, between 0 and 100.
+ * @returns The estimate in microseconds, or 0 for an empty histogram.
+ */
+export function latencyPercentileUs(
+  histogram: BarkLatencyHistogram,
+  percentile: number
+): number {
+  const target = Math.ceil((histogram.count * percentile) / 100);
+  let seen = 0;
+  for (let i = 0; i < histogram.buckets.length; i++) {
+    seen += histogram.buckets[i] ?? 0;
+    if (seen >= Math.max(target, 1)) {
+      // The last bucket is unbounded, the max is the best estimate there
+      return i === histogram.buckets.length - 1
+        ? histogram.max_us
+        : Math.min(2 ** i, histogram.max_us);
+    }
+  }
+  return histogram.max_us;
+}
+
 /**
  * Registers all confirmed boards with the server.
  * @returns A promise that resolves on success.
@@ -132,10 +396,12 @@ export function maintenance(): Promise<void> {
 /**
  * Runs wallet maintenance tasks for both offchain and onchain.
  * This includes refreshing vtxos that need to be refreshed.
+ * @param opts Optional cancel token and timeout, see `createCancelToken`.
+ * A cancelled call finishes the stage it is running and skips the rest.
  * @returns A promise that resolves on success.
  */
-export function maintenanceWithOnchain(): Promise<void> {
-  return NitroArkHybridObject.maintenanceWithOnchain();
+export function maintenanceWithOnchain(opts?: BarkCallOpts): Promise<void> {
+  return NitroArkHybridObject.maintenanceWithOnchain(opts);
 }
 
 /**
@@ -164,6 +430,56 @@ export function maintenanceRefresh(): Promise<void> {
   return NitroArkHybridObject.maintenanceRefresh();
 }
 
+/** Stages a scheduled maintenance pass can run, in the order it runs them. */
+export type MaintenanceStage =
+  | 'sync'
+  | 'onchain'
+  | 'boards'
+  | 'rounds'
+  | 'exits'
+  | 'refresh';
+
+/**
+ * Runs only the maintenance stages that have work to do. The server sync
+ * runs at most every 30 seconds, the onchain sync only when the chain moved,
+ * and boards, rounds, exits and refreshes only when the balance or the next
+ * refresh height says they are pending. Calls that overlap a running pass
+ * share its result.
+ * @param forceStages Stages to run even if they are not due.
+ * @returns A promise resolving to the stages that ran, were skipped or failed.
+ */
+export function maintenanceScheduled(
+  forceStages?: MaintenanceStage[]
+): Promise<BarkMaintenanceReport> {
+  return NitroArkHybridObject.maintenanceScheduled(forceStages);
+}
+
+/**
+ * Plans the next refresh round without running it. The round is timed by the
+ * first VTXO that reaches the refresh threshold, and every VTXO that would
+ * become due within the horizon joins it, together with dust, so expiring
+ * VTXOs need as few rounds as possible.
+ * @param opts Horizon and dust settings, defaults apply to omitted fields.
+ * @returns A promise resolving to the planned VTXOs and when to refresh them.
+ */
+export function planRefresh(
+  opts?: BarkRefreshPlanOpts
+): Promise<BarkRefreshPlan> {
+  return NitroArkHybridObject.planRefresh(opts);
+}
+
+/**
+ * Refreshes the VTXOs of a plan in one round. Rejects without refreshing
+ * anything if one of them is no longer spendable.
+ * @param vtxoIds The ids of the planned VTXOs.
+ * @returns A promise resolving to the round status, or undefined if no round was started.
+ */
+export function executeRefreshPlan(
+  vtxoIds: string[]
+): Promise<BarkRoundStatus | undefined> {
+  return NitroArkHybridObject.executeRefreshPlan(vtxoIds);
+}
+
 /**
  * Synchronizes the wallet with the blockchain.
  * @returns A promise that resolves on success.
@@ -174,10 +490,12 @@ export function sync(): Promise<void> {
 
 /**
  * Synchronizes the Ark-specific exits.
+ * @param opts Optional cancel token and timeout, see `createCancelToken`.
+ * They only apply until exits start being progressed.
  * @returns A promise that resolves on success.
  */
-export function syncExits(): Promise<void> {
-  return NitroArkHybridObject.syncExits();
+export function syncExits(opts?: BarkCallOpts): Promise<void> {
+  return NitroArkHybridObject.syncExits(opts);
 }
 
 /**
@@ -188,10 +506,35 @@ export function syncPendingRounds(): Promise<void> {
   return NitroArkHybridObject.syncPendingRounds();
 }
 
+// --- Events ---
+
+/**
+ * Subscribes to wallet change events: movements created or updated, VTXO
+ * state transitions, round status and settled lightning receives.
+ * Events are coalesced per entity and delivered in one batch per frame.
+ * Only one subscription is active at a time; subscribing again replaces it.
+ * @param onEvents Called with each batch of events.
+ * @returns A function that ends the subscription.
+ */
+export function subscribeWalletEvents(
+  onEvents: (events: BarkWalletEvent[]) => void
+): () => void {
+  NitroArkHybridObject.subscribeWalletEvents(onEvents);
+  return () => NitroArkHybridObject.unsubscribeWalletEvents();
+}
+
+/**
+ * Ends the active wallet event subscription, if any.
+ */
+export function unsubscribeWalletEvents(): void {
+  NitroArkHybridObject.unsubscribeWalletEvents();
+}
+
 // --- Wallet Info ---
 
 /**
- * Gets the Ark-specific information.
+ * Gets the Ark-specific information. It is served from a cache that is
+ * revalidated in the background, see {@link setArkInfoTtl}.
  * @returns A promise resolving to the BarkArkInfo object.
  */
 export function getArkInfo(): Promise<BarkArkInfo> {
@@ -223,6 +566,19 @@ export function peakKeyPair(index: number): Promise<KeyPairResult> {
   return NitroArkHybridObject.peakKeyPair(index);
 }
 
+/**
+ * Gets the wallet's keypairs for a range of indexes in one call.
+ * @param start Index of the first keypair.
+ * @param count Number of keypairs, at most 10000.
+ * @returns A promise resolving to the keypairs in index order.
+ */
+export function peakKeyPairs(
+  start: number,
+  count: number
+): Promise<KeyPairResult[]> {
+  return NitroArkHybridObject.peakKeyPairs(start, count);
+}
+
 /**
  * Peeks a derived address without advancing the wallet's address index.
  * @param index Index of the address to preview.
@@ -232,6 +588,20 @@ export function peakAddress(index: number): Promise<NewAddressResult> {
   return NitroArkHybridObject.peakAddress(index);
 }
 
+/**
+ * Peeks a range of derived addresses without advancing the wallet's address
+ * index, e.g. to pre-generate an address pool.
+ * @param start Index of the first address.
+ * @param count Number of addresses, at most 10000.
+ * @returns A promise resolving to the addresses in index order.
+ */
+export function peakAddresses(
+  start: number,
+  count: number
+): Promise<NewAddressResult[]> {
+  return NitroArkHybridObject.peakAddresses(start, count);
+}
+
 /**
  * Gets the wallet's Address.
  * @returns A promise resolving to NewAddressResult object.
@@ -292,6 +662,29 @@ export function deriveKeypairFromMnemonic(
   );
 }
 
+/**
+ * Derives the keypairs for a range of indexes from a mnemonic, e.g. for a gap
+ * limit scan during restore. The seed is derived once for the whole range.
+ * @param mnemonic The mnemonic to derive the keypairs from.
+ * @param network The network to derive the keypairs for.
+ * @param start Index of the first keypair.
+ * @param count Number of keypairs, at most 10000.
+ * @returns A promise resolving to the keypairs in index order.
+ */
+export function deriveKeypairsFromMnemonic(
+  mnemonic: string,
+  network: string,
+  start: number,
+  count: number
+): Promise<KeyPairResult[]> {
+  return NitroArkHybridObject.deriveKeypairsFromMnemonic(
+    mnemonic,
+    network,
+    start,
+    count
+  );
+}
+
 /**
  * Verifies a signed message.
  * @param message The original message.
@@ -315,6 +708,38 @@ export function history(): Promise<BarkMovement[]> {
   return NitroArkHybridObject.history() as Promise<BarkMovement[]>;
 }
 
+/**
+ * Gets one page of movements matching the query, newest first.
+ * Only the requested page is converted, which keeps large histories cheap.
+ * @param query Cursor, page size and optional status, subsystem kind and time filters.
+ * @returns A promise resolving to the BarkHistoryPage; pass next_cursor back to fetch the following page.
+ */
+export function historyPage(
+  query: BarkHistoryQuery
+): Promise<BarkHistoryPage> {
+  return NitroArkHybridObject.historyPage(query) as Promise<BarkHistoryPage>;
+}
+
+/**
+ * Writes every movement matching the query to a CSV or JSONL file, newest
+ * first. Movements are read page by page and go straight from the native
+ * layer to the file, so large histories never pass through the JS heap. The
+ * file only appears at `path` once it is complete.
+ * @param path File to write, replaced if it exists.
+ * @param opts Format, optional history filters and chunk size. The query limit defaults to every match.
+ * @param onProgress Called after each chunk with the rows written so far.
+ * @param callOpts Optional cancel token and timeout for the whole export. A stopped export rejects and leaves no file behind.
+ * @returns A promise resolving to the final progress once the file is complete.
+ */
+export function exportHistory(
+  path: string,
+  opts: BarkHistoryExportOpts,
+  onProgress: (progress: BarkHistoryExportProgress) => void = () => {},
+  callOpts?: BarkCallOpts
+): Promise<BarkHistoryExportProgress> {
+  return NitroArkHybridObject.exportHistory(path, opts, onProgress, callOpts);
+}
+
 /**
  * Gets the list of VTXOs as a JSON string for the loaded wallet.
  * @param no_sync If true, skips synchronization with the blockchain. Defaults to false.
@@ -324,6 +749,83 @@ export function vtxos(): Promise<BarkVtxo[]> {
   return NitroArkHybridObject.vtxos() as Promise<BarkVtxo[]>;
 }
 
+/**
+ * Gets the VTXOs of the loaded wallet in a compact columnar layout, without
+ * creating an object per VTXO. Read it with `decodeVtxoColumns`.
+ * @returns A promise resolving to the encoded ArrayBuffer.
+ */
+export function vtxosColumnar(): Promise<ArrayBuffer> {
+  return NitroArkHybridObject.vtxosColumnar();
+}
+
+export type VtxoColumns = {
+  count: number;
+  expiry_heights: Uint32Array;
+  exit_deltas: Uint16Array;
+  states: Uint8Array; // 0 Spendable, 1 Spent, 2 Locked
+  amountSat(index: number): number;
+  state(index: number): BarkVtxo['state'];
+  point(index: number): string; // "txid:vout"
+  anchorPoint(index: number): string; // "txid:vout"
+};
+
+const VTXO_COLUMNS_VERSION = 1;
+const POINT_RECORD_LEN = 36;
+const VTXO_STATES: BarkVtxo['state'][] = ['Spendable', 'Spent', 'Locked'];
+
+function readPoint(view: DataView, offset: number): string {
+  let txid = '';
+  for (let i = 0; i < 32; i++) {
+    txid += view
+      .getUint8(offset + i)
+      .toString(16)
+      .padStart(2, '0');
+  }
+  return `${txid}:${view.getUint32(offset + 32, true)}`;
+}
+
+/**
+ * Decodes the result of `vtxosColumnar`. Heights, exit deltas and states are
+ * typed array views into the buffer, the remaining fields are read on demand.
+ * @param buffer The ArrayBuffer returned by `vtxosColumnar`.
+ * @returns Accessors for the encoded VTXOs.
+ */
+export function decodeVtxoColumns(buffer: ArrayBuffer): VtxoColumns {
+  const view = new DataView(buffer);
+  const version = view.getUint32(0, true);
+  if (version !== VTXO_COLUMNS_VERSION) {
+    throw new Error(`Unsupported vtxo columns version ${version}`);
+  }
+  const count = view.getUint32(4, true);
+  const amountsOffset = 8;
+  const expiryOffset = amountsOffset + count * 8;
+  const exitDeltaOffset = expiryOffset + count * 4;
+  const stateOffset = exitDeltaOffset + count * 2;
+  const pointsOffset = Math.ceil((stateOffset + count) / 4) * 4;
+  const anchorsOffset = pointsOffset + count * POINT_RECORD_LEN;
+
+  return {
+    count,
+    expiry_heights: new Uint32Array(buffer, expiryOffset, count),
+    exit_deltas: new Uint16Array(buffer, exitDeltaOffset, count),
+    states: new Uint8Array(buffer, stateOffset, count),
+    amountSat: (index: number) => {
+      const offset = amountsOffset + index * 8;
+      // Split in two halves, sat amounts stay well below 2^53
+      return (
+        view.getUint32(offset, true) +
+        view.getUint32(offset + 4, true) * 2 ** 32
+      );
+    },
+    state: (index: number) =>
+      VTXO_STATES[view.getUint8(stateOffset + index)] ?? 'unknown',
+    point: (index: number) =>
+      readPoint(view, pointsOffset + index * POINT_RECORD_LEN),
+    anchorPoint: (index: number) =>
+      readPoint(view, anchorsOffset + index * POINT_RECORD_LEN),
+  };
+}
+
 /**
  * Gets the first expiring VTXO blockheight for the loaded wallet.
  * @returns A promise resolving to the first expiring VTXO blockheight.
@@ -354,6 +856,28 @@ export function getExpiringVtxos(threshold: number): Promise<BarkVtxo[]> {
   >;
 }
 
+/**
+ * Synchronously returns the wallet state cached by previous calls to
+ * offchainBalance, onchainBalance, vtxos and getFirstExpiringVtxoBlockheight.
+ * The cache is cleared whenever sync, maintenance, board or send operations
+ * change the wallet, so a missing field means the async getter must be called.
+ * @returns The WalletSnapshot object.
+ */
+export function getCachedWalletSnapshot(): WalletSnapshot {
+  return NitroArkHybridObject.getCachedWalletSnapshot() as WalletSnapshot;
+}
+
+/**
+ * Reads the offchain and onchain balances, the Ark server info, the next
+ * required refresh height and the vtxos in a single call. This is cheaper than
+ * calling the individual getters back to back, and refreshes the cache used by
+ * getCachedWalletSnapshot.
+ * @returns A promise resolving to the DashboardSnapshot object.
+ */
+export function dashboardSnapshot(): Promise<DashboardSnapshot> {
+  return NitroArkHybridObject.dashboardSnapshot() as Promise<DashboardSnapshot>;
+}
+
 // --- Onchain Operations ---
 
 /**
@@ -372,8 +896,23 @@ export function onchainSync(): Promise<void> {
   return NitroArkHybridObject.onchainSync();
 }
 
+/**
+ * Synchronizes the onchain wallet, skipping the sync when no block was mined
+ * since the last one and it is less than ten minutes old. Only blocks mined
+ * since the last sync are fetched. Progress is delivered as `onchain_sync`
+ * events to `subscribeWalletEvents` listeners.
+ * @param force Sync even if nothing changed since the last sync.
+ * @returns A promise resolving to a report of the sync.
+ */
+export function onchainSyncIncremental(
+  force?: boolean
+): Promise<BarkOnchainSyncReport> {
+  return NitroArkHybridObject.onchainSyncIncremental(force);
+}
+
 /**
  * Gets the list of unspent onchain outputs as a JSON Object of type BarkVtxo.
+ * @deprecated Use `onchainUnspentOutputs`, which skips the JSON round trip.
  * @returns A promise resolving to the JSON string of unspent outputs.
  */
 export function onchainListUnspent(): Promise<string> {
@@ -382,12 +921,36 @@ export function onchainListUnspent(): Promise<string> {
 
 /**
  * Gets the list of onchain UTXOs as a JSON string for the loaded wallet.
+ * @deprecated Use `onchainUtxoList`, which skips the JSON round trip.
  * @returns A promise resolving to the JSON string of UTXOs.
  */
 export function onchainUtxos(): Promise<string> {
   return NitroArkHybridObject.onchainUtxos();
 }
 
+/**
+ * Gets the unspent outputs of the onchain wallet as typed objects.
+ * @param filter Optional minimum amount and confirmation filter.
+ * @returns A promise resolving to the matching outputs.
+ */
+export function onchainUnspentOutputs(
+  filter?: BarkOnchainUtxoFilter
+): Promise<BarkOnchainUtxo[]> {
+  return NitroArkHybridObject.onchainUnspentOutputs(filter);
+}
+
+/**
+ * Gets the onchain UTXOs, including those of unilateral exits, as typed
+ * objects.
+ * @param filter Optional minimum amount and confirmation filter.
+ * @returns A promise resolving to the matching UTXOs.
+ */
+export function onchainUtxoList(
+  filter?: BarkOnchainUtxoFilter
+): Promise<BarkOnchainUtxo[]> {
+  return NitroArkHybridObject.onchainUtxoList(filter);
+}
+
 /**
  * Gets a fresh onchain address for the loaded wallet.
  * @returns A promise resolving to the Bitcoin address string.
@@ -454,7 +1017,8 @@ export function lightningReceiveStatus(
 /**
  * Checks if a Lightning payment has been received and returns the preimage if available.
  * @param paymentHash The payment hash of the Lightning payment.
- * @param wait Whether to wait for the payment to be received.
+ * @param wait Whether to wait for the payment to be received. Waiting does not
+ * hold a native thread and can be aborted with `cancelLightningWait`.
  * @returns A promise resolving to the preimage string if payment received, or null if not.
  */
 export function checkLightningPayment(
@@ -467,7 +1031,8 @@ export function checkLightningPayment(
 /**
  * Attempts to claim a Lightning payment, optionally using a claim token.
  * @param paymentHash The payment hash of the Lightning payment.
- * @param wait Whether to wait for the claim to complete.
+ * @param wait Whether to wait for the claim to complete. Waiting does not
+ * hold a native thread and can be aborted with `cancelLightningWait`.
  * @param token Optional claim token used when no spendable VTXOs are owned.
  * @returns A promise resolving to the claimed LightningReceive if successful, or null if not.
  */
@@ -483,6 +1048,16 @@ export function tryClaimLightningReceive(
   );
 }
 
+/**
+ * Cancels pending waits started by `checkLightningPayment` or
+ * `tryClaimLightningReceive` with `wait` set. Their promises reject.
+ * @param paymentHash The payment hash the waits were started for.
+ * @returns The number of waits that were cancelled.
+ */
+export function cancelLightningWait(paymentHash: string): number {
+  return NitroArkHybridObject.cancelLightningWait(paymentHash);
+}
+
 /**
  * Checks and claims all open Lightning receives.
  * @param wait Whether to wait for the claim to complete.
@@ -505,6 +1080,21 @@ export function payLightningInvoice(
   return NitroArkHybridObject.payLightningInvoice(destination, amountSat);
 }
 
+/**
+ * Pays several invoices while taking the wallet lock once.
+ * Expired or amountless invoices and insufficient funds reject the whole
+ * batch before anything is paid. After that every invoice is attempted and a
+ * failed one does not stop the others, so a server failure mid-batch still
+ * leaves the earlier invoices paid: check each result.
+ * @param payments The invoices to pay, with an optional amount for each.
+ * @returns A promise resolving to one LightningBatchResult per invoice, in order.
+ */
+export function payLightningInvoices(
+  payments: BarkLightningInvoicePayment[]
+): Promise<LightningBatchResult[]> {
+  return NitroArkHybridObject.payLightningInvoices(payments);
+}
+
 /**
  * Sends a payment to a Bolt12 offer.
  * @param offer The Bolt12 offer.
@@ -546,10 +1136,32 @@ export function boardAmount(amountSat: number): Promise<BoardResult> {
 
 /**
  * Boards all available funds from the onchain wallet into Ark.
+ * @param opts Optional cancel token and timeout, see `createCancelToken`.
+ * They only apply until the board starts.
  * @returns A promise resolving to a BoardResult object.
  */
-export function boardAll(): Promise<BoardResult> {
-  return NitroArkHybridObject.boardAll();
+export function boardAll(opts?: BarkCallOpts): Promise<BoardResult> {
+  return NitroArkHybridObject.boardAll(opts);
+}
+
+/**
+ * Recognises a payment destination: an Ark address, bolt11 invoice, bolt12
+ * offer, lightning address or bitcoin address. The result is cached by the
+ * string, so calling this on every keystroke is cheap, and the send functions
+ * reuse the parsed destination when given the same string.
+ * @param destination The destination as entered or scanned, a `lightning:`
+ * prefix is accepted.
+ * @param resolve Whether to look up what a lightning address accepts over
+ * LNURL. The lookup is cached for ten minutes.
+ * @returns A promise resolving to the kind of destination and, for invoices,
+ * the requested amount and expiry.
+ * @throws If the destination isn't recognised or the LNURL lookup fails.
+ */
+export function parseDestination(
+  destination: string,
+  resolve: boolean = false
+): Promise<BarkParsedDestination> {
+  return NitroArkHybridObject.parseDestination(destination, resolve);
 }
 
 /**
@@ -574,6 +1186,19 @@ export function sendArkoorPayment(
   return NitroArkHybridObject.sendArkoorPayment(destination, amountSat);
 }
 
+/**
+ * Sends Arkoor payments to several destinations while taking the wallet lock once.
+ * All destinations and the total amount are checked before anything is sent,
+ * so an invalid address or insufficient funds rejects the whole batch.
+ * @param outputs An array of objects containing destination address and amountSat.
+ * @returns A promise resolving to one ArkoorBatchResult per output, in order.
+ */
+export function sendArkoorMany(
+  outputs: BarkSendManyOutput[]
+): Promise<ArkoorBatchResult[]> {
+  return NitroArkHybridObject.sendArkoorMany(outputs);
+}
+
 /**
  * Sends an onchain payment via an Ark round.
  * @param destination The destination Bitcoin address.
@@ -605,10 +1230,15 @@ export function offboardSpecific(
 /**
  * Offboards all VTXOs to a destination address.
  * @param destinationAddress Destination Bitcoin address (if empty, sends to internal wallet).
+ * @param opts Optional cancel token and timeout, see `createCancelToken`.
+ * They only apply until the offboard starts.
  * @returns A promise resolving to the txid string.
  */
-export function offboardAll(destinationAddress: string): Promise<string> {
-  return NitroArkHybridObject.offboardAll(destinationAddress);
+export function offboardAll(
+  destinationAddress: string,
+  opts?: BarkCallOpts
+): Promise<string> {
+  return NitroArkHybridObject.offboardAll(destinationAddress, opts);
 }
 
 // --- Re-export types and enums ---
@@ -616,16 +1246,40 @@ export type {
   NitroArk,
   BarkCreateOpts,
   BarkConfigOpts,
+  BarkStorageOpts,
   BarkArkInfo,
   Bolt11Invoice,
   BoardResult,
   BarkSendManyOutput,
   ArkoorPaymentResult,
+  ArkoorBatchResult,
+  BarkParsedDestination,
   LightningSendResult,
+  BarkLightningInvoicePayment,
+  LightningBatchResult,
   OnchainPaymentResult,
   OffchainBalanceResult,
   OnchainBalanceResult,
   NewAddressResult,
   KeyPairResult,
   LightningReceive,
+  BarkHistoryQuery,
+  BarkHistoryExportOpts,
+  BarkHistoryExportProgress,
+  BarkWalletEvent,
+  BarkOnchainUtxo,
+  BarkOnchainUtxoFilter,
+  BarkOnchainSyncReport,
+  BarkMaintenanceReport,
+  BarkRefreshPlanOpts,
+  BarkPlannedVtxo,
+  BarkRefreshPlan,
+  BarkRoundStatus,
+  BarkWalletOpenTimings,
+  BarkLatencyHistogram,
+  BarkCallMetrics,
+  BarkAllocStats,
+  BarkRuntimeOpts,
+  BarkLogOpts,
+  BarkCallOpts,
 } from './NitroArk.nitro';